@@ -67,6 +67,10 @@ function doWrapp(funcIndex_dw) {
 		if (fullName_dw == "Engine_executeCommand") {
 			doWrapp_dw = 0;
 		}
+		# bulk functions on caller-provided arrays, plain C only
+		if (fullName_dw == "getUnitStates" || fullName_dw == "Engine_handleCommands") {
+			doWrapp_dw = 0;
+		}
 	} else {
 		print("Java-AIInterface: NOTE: native level: Callback: intentionally not wrapped: " fullName_dw);
 	}
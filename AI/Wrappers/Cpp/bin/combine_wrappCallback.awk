@@ -62,6 +62,10 @@ function doWrapp(funcIndex_dw) {
 		if (fullName_dw == "Engine_executeCommand") {
 			doWrapp_dw = 0;
 		}
+		# bulk functions on caller-provided arrays, plain C only
+		if (fullName_dw == "getUnitStates" || fullName_dw == "Engine_handleCommands") {
+			doWrapp_dw = 0;
+		}
 	}
 
 	return doWrapp_dw;
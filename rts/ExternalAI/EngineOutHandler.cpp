@@ -19,16 +19,23 @@
 #include "Sim/Units/CommandAI/Command.h"
 #include "Sim/Weapons/WeaponDef.h"
 #include "Net/Protocol/NetProtocol.h"
+#include "System/Config/ConfigHandler.h"
 #include "System/Log/ILog.h"
+#include "System/Threading/ThreadPool.h"
 #include "System/TimeProfiler.h"
 #include "System/SafeUtil.h"
 
+CONFIG(bool, ThreadedSkirmishAI).defaultValue(false).description("Runs native Skirmish AIs in parallel on worker threads once per sim-frame. Events are queued and delivered at the start of each AI's update instead of as they happen, so unit queries in event handlers see the state at that point. Engine callbacks are executed one at a time, only the AIs' own code runs in parallel. Lua messages sent to AIs from within an AI update are delivered after it and get no replies.");
+
 
 CR_BIND(CEngineOutHandler, )
 CR_REG_METADATA(CEngineOutHandler, (
 	CR_IGNORED(hostSkirmishAIs),
 	CR_IGNORED(teamSkirmishAIs),
 	CR_IGNORED(activeSkirmishAIs),
+	CR_IGNORED(threadedSkirmishAIs),
+	CR_IGNORED(updatingSkirmishAIs),
+	CR_IGNORED(deferredLuaMessages),
 
 	CR_POSTLOAD(PostLoad)
 ))
@@ -65,6 +72,12 @@ void CEngineOutHandler::Create() {
 	numInstances += 1;
 }
 
+void CEngineOutHandler::Init() {
+	activeSkirmishAIs.reserve(16);
+
+	threadedSkirmishAIs = configHandler->GetBool("ThreadedSkirmishAI");
+}
+
 void CEngineOutHandler::Destroy() {
 	if (numInstances != 1)
 		return;
@@ -127,7 +140,38 @@ void CEngineOutHandler::Save(std::ostream* s, const uint8_t skirmishAIId) {
 
 void CEngineOutHandler::Update() {
 	AI_SCOPED_TIMER();
-	DO_FOR_SKIRMISH_AIS(Update(gs->frameNum))
+
+	if (!threadedSkirmishAIs) {
+		DO_FOR_SKIRMISH_AIS(Update(gs->frameNum))
+		return;
+	}
+
+	// the sim does not advance until every AI is done; every callback entry
+	// point is serialized (see SSkirmishAICallbackImpl), so only the AIs' own
+	// code runs in parallel and orders go through the network like always
+	const int frameNum = gs->frameNum;
+
+	updatingSkirmishAIs = true;
+
+	for_mt(0, activeSkirmishAIs.size(), [&](const int i) {
+		CSkirmishAIWrapper& ai = hostSkirmishAIs[ activeSkirmishAIs[i] ];
+
+		ai.HandleQueuedEvents();
+		ai.Update(frameNum);
+	});
+
+	updatingSkirmishAIs = false;
+
+	// a message can only be answered by running the receiving AI's handler,
+	// which is not safe from another AI's thread; the replies are dropped
+	std::vector<const char*> outData;
+
+	for (const auto& msg: deferredLuaMessages) {
+		SendLuaMessages(msg.first, msg.second.c_str(), outData);
+		outData.clear();
+	}
+
+	deferredLuaMessages.clear();
 }
 
 
@@ -487,6 +531,13 @@ bool CEngineOutHandler::SendLuaMessages(int aiTeam, const char* inData, std::vec
 	if (activeSkirmishAIs.empty())
 		return false;
 
+	// only reachable from an AI callback (e.g. callLuaRules) at this point,
+	// which are serialized, so no other thread touches the buffer meanwhile
+	if (updatingSkirmishAIs) {
+		deferredLuaMessages.emplace_back(aiTeam, inData);
+		return false;
+	}
+
 	unsigned int n = 0;
 
 	if (aiTeam != -1) {
@@ -537,6 +588,7 @@ void CEngineOutHandler::CreateSkirmishAI(const uint8_t skirmishAIId, bool savedG
 	}
 
 	aiInst.PreInit(skirmishAIId);
+	aiInst.SetQueueEvents(threadedSkirmishAIs);
 
 	teamSkirmishAIs[ aiInst.GetTeamId() ].push_back(skirmishAIId);
 	activeSkirmishAIs.push_back(skirmishAIId);
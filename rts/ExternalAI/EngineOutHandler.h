@@ -10,6 +10,7 @@
 #include <array>
 #include <vector>
 #include <string>
+#include <utility>
 
 struct Command;
 class float3;
@@ -31,7 +32,7 @@ public:
 	static void Create();
 	static void Destroy();
 
-	void Init() { activeSkirmishAIs.reserve(16); }
+	void Init();
 	void Kill() {
 		PreDestroy();
 
@@ -77,7 +78,11 @@ public:
 	void CommandFinished(const CUnit& unit, const Command& command);
 	void SendChatMessage(const char* msg, int playerId);
 
-	/// send a raw string from unsynced Lua to one or all active skirmish AI's
+	/**
+	 * send a raw string from unsynced Lua to one or all active skirmish AI's
+	 * while the AIs are being updated in parallel the message is delivered
+	 * after the update instead and no responses are returned
+	 */
 	bool SendLuaMessages(int aiTeam, const char* inData, std::vector<const char*>& outData);
 
 
@@ -106,6 +111,8 @@ public:
 	void Load(std::istream* s, const uint8_t skirmishAIId);
 	void Save(std::ostream* s, const uint8_t skirmishAIId);
 
+	bool ThreadedSkirmishAIs() const { return threadedSkirmishAIs; }
+
 private:
 	/// Contains all local Skirmish AIs, indexed by their ID
 	std::array<CSkirmishAIWrapper, MAX_AIS > hostSkirmishAIs;
@@ -117,6 +124,14 @@ private:
 	std::array<std::vector<uint8_t>, MAX_TEAMS> teamSkirmishAIs;
 
 	std::vector<uint8_t> activeSkirmishAIs;
+
+	/// if true, AIs are updated in parallel and receive their events once per frame
+	bool threadedSkirmishAIs = false;
+	/// true while Update runs the AIs on worker threads
+	bool updatingSkirmishAIs = false;
+
+	/// <aiTeam, inData> of Lua messages sent during a parallel update
+	std::vector<std::pair<int, std::string>> deferredLuaMessages;
 };
 
 #define eoh CEngineOutHandler::GetInstance()
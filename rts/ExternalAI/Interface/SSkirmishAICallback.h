@@ -2256,6 +2256,27 @@ struct SSkirmishAICallback {
 
 	bool              (CALLING_CONV *Debug_GraphDrawer_isEnabled)(int skirmishAIId);
 
+	/**
+	 * Bulk version of Unit_getDef, Unit_getPos, Unit_getVel, Unit_getHealth
+	 * and Unit_getMaxHealth, with the same visibility rules.
+	 * The values for unitIds[i] are written to index i of each output array,
+	 * positions and velocities take three floats (x, y, z) per unit.
+	 * Any of the output arrays may be NULL, to skip that property.
+	 * @return the number of units written, which is unitIds_size
+	 */
+	int               (CALLING_CONV *getUnitStates)(int skirmishAIId, int* unitIds, int unitIds_size, int* unitDefIds, float* positions, float* velocities, float* healths, float* maxHealths);
+
+	/**
+	 * Bulk version of Engine_handleCommand, handles commands_size commands
+	 * in order, with a single call across the interface.
+	 * @param commandTopics  topic of each command, see Engine_handleCommand
+	 * @param commandData    data of each command, see Engine_handleCommand
+	 * @param results        receives the Engine_handleCommand return value
+	 *                       of each command, may be NULL
+	 * @return the number of commands that were handled ok
+	 */
+	int               (CALLING_CONV *Engine_handleCommands)(int skirmishAIId, int toId, int* commandTopics, void** commandData, int* results, int commands_size);
+
 };
 
 #if	defined(__cplusplus)
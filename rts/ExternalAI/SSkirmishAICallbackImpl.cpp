@@ -3,6 +3,7 @@
 #include "ExternalAI/AICallback.h"
 #include "ExternalAI/AICheats.h"
 #include "ExternalAI/AILibraryManager.h"
+#include "ExternalAI/EngineOutHandler.h"
 #include "ExternalAI/SSkirmishAICallbackImpl.h"
 #include "ExternalAI/SkirmishAILibraryInfo.h"
 #include "ExternalAI/SkirmishAIWrapper.h"
@@ -47,6 +48,7 @@
 #include "System/SpringMath.h"
 #include "System/FileSystem/ArchiveScanner.h"
 #include "System/Log/ILog.h"
+#include "System/Threading/SpringThreading.h"
 
 
 static std::array<std::pair<CAICallback, CAICheats>, MAX_AIS> AI_LEGACY_CALLBACKS;
@@ -61,6 +63,23 @@ static std::vector<LineMarker> AI_TMP_LINE_MARKERS[MAX_AIS];
 
 static constexpr size_t MAX_NUM_MARKERS = 16384;
 
+// AIs can run concurrently (see ThreadedSkirmishAI) but the engine side
+// of the callback is not thread-safe (shared quadfield query caches, static
+// unit-filter state, path caches, Lua, ...), so in that mode every entry point
+// is executed one at a time; AIs only run in parallel between their callback
+// calls
+static spring::recursive_mutex AI_COMMAND_MUTEX;
+
+template<auto Func> struct SerializedCallback;
+
+template<typename R, typename... Args, R (CALLING_CONV *Func)(Args...)>
+struct SerializedCallback<Func> {
+	static R CALLING_CONV Call(Args... args) {
+		std::lock_guard<spring::recursive_mutex> lock(AI_COMMAND_MUTEX);
+		return Func(args...);
+	}
+};
+
 
 static inline CAICallback* GetCallBack(int skirmishAIId) { return &AI_LEGACY_CALLBACKS[skirmishAIId].first; }
 static inline CAICheats* GetCheatCallBack(int skirmishAIId) { return &AI_LEGACY_CALLBACKS[skirmishAIId].second; }
@@ -4911,6 +4930,82 @@ EXPORT(bool) skirmishAiCallback_Debug_GraphDrawer_isEnabled(int skirmishAIId) {
 	return GetCallBack(skirmishAIId)->IsDebugDrawerEnabled();
 }
 
+
+template<typename LegacyCallback>
+static void GetUnitStates(
+	LegacyCallback* clb,
+	const int* unitIds,
+	int numUnits,
+	int* unitDefIds,
+	float* positions,
+	float* velocities,
+	float* healths,
+	float* maxHealths
+) {
+	for (int i = 0; i < numUnits; i++) {
+		const int unitId = unitIds[i];
+
+		if (unitDefIds != nullptr) {
+			const UnitDef* unitDef = clb->GetUnitDef(unitId);
+			unitDefIds[i] = (unitDef != nullptr)? unitDef->id: -1;
+		}
+
+		if (positions != nullptr)
+			clb->GetUnitPos(unitId).copyInto(&positions[i * 3]);
+		if (velocities != nullptr)
+			clb->GetUnitVelocity(unitId).copyInto(&velocities[i * 3]);
+
+		if (healths != nullptr)
+			healths[i] = clb->GetUnitHealth(unitId);
+		if (maxHealths != nullptr)
+			maxHealths[i] = clb->GetUnitMaxHealth(unitId);
+	}
+}
+
+EXPORT(int) skirmishAiCallback_getUnitStates(
+	int skirmishAIId,
+	int* unitIds,
+	int unitIds_size,
+	int* unitDefIds,
+	float* positions,
+	float* velocities,
+	float* healths,
+	float* maxHealths
+) {
+	if (unitIds == nullptr || unitIds_size <= 0)
+		return 0;
+
+	if (skirmishAiCallback_Cheats_isEnabled(skirmishAIId)) {
+		GetUnitStates(GetCheatCallBack(skirmishAIId), unitIds, unitIds_size, unitDefIds, positions, velocities, healths, maxHealths);
+	} else {
+		GetUnitStates(GetCallBack(skirmishAIId), unitIds, unitIds_size, unitDefIds, positions, velocities, healths, maxHealths);
+	}
+
+	return unitIds_size;
+}
+
+EXPORT(int) skirmishAiCallback_Engine_handleCommands(
+	int skirmishAIId,
+	int toId,
+	int* commandTopics,
+	void** commandData,
+	int* results,
+	int commands_size
+) {
+	int numHandled = 0;
+
+	for (int i = 0; i < commands_size; i++) {
+		const int ret = skirmishAiCallback_Engine_handleCommand(skirmishAIId, toId, -1, commandTopics[i], commandData[i]);
+
+		if (results != nullptr)
+			results[i] = ret;
+
+		numHandled += (ret == 0);
+	}
+
+	return numHandled;
+}
+
 EXPORT(int) skirmishAiCallback_getGroups(int skirmishAIId, int* groupIds, int maxGroups) {
 	const CGroupHandler& gh = uiGroupHandlers[ AI_TEAM_IDS[skirmishAIId] ];
 	const std::vector<CGroup>& gs = gh.GetGroups();
@@ -5039,601 +5134,608 @@ EXPORT(bool) skirmishAiCallback_Group_isSelected(int skirmishAIId, int groupId)
 
 
 
-static void skirmishAiCallback_init(SSkirmishAICallback* callback) {
+static void skirmishAiCallback_init(SSkirmishAICallback* callback, bool serialized) {
 	memset(callback, 0, sizeof(SSkirmishAICallback));
 
+	// the lock is only needed when AIs run concurrently
+	#define AI_CALLBACK_FUNC(func) (serialized? &SerializedCallback<&func>::Call: &func)
+
 	// register function pointers to accessors (which wrap around the legacy callbacks)
-	callback->Engine_handleCommand = &skirmishAiCallback_Engine_handleCommand;
-	callback->Engine_executeCommand = &skirmishAiCallback_Engine_executeCommand;
-
-	callback->Engine_Version_getMajor = &skirmishAiCallback_Engine_Version_getMajor;
-	callback->Engine_Version_getMinor = &skirmishAiCallback_Engine_Version_getMinor;
-	callback->Engine_Version_getPatchset = &skirmishAiCallback_Engine_Version_getPatchset;
-	callback->Engine_Version_getCommits = &skirmishAiCallback_Engine_Version_getCommits;
-	callback->Engine_Version_getHash = &skirmishAiCallback_Engine_Version_getHash;
-	callback->Engine_Version_getBranch = &skirmishAiCallback_Engine_Version_getBranch;
-	callback->Engine_Version_getAdditional = &skirmishAiCallback_Engine_Version_getAdditional;
-	callback->Engine_Version_getBuildTime = &skirmishAiCallback_Engine_Version_getBuildTime;
-	callback->Engine_Version_isRelease = &skirmishAiCallback_Engine_Version_isRelease;
-	callback->Engine_Version_getNormal = &skirmishAiCallback_Engine_Version_getNormal;
-	callback->Engine_Version_getSync = &skirmishAiCallback_Engine_Version_getSync;
-	callback->Engine_Version_getFull = &skirmishAiCallback_Engine_Version_getFull;
-	callback->getNumTeams = &skirmishAiCallback_getNumTeams;
-	callback->getNumSkirmishAIs = &skirmishAiCallback_getNumSkirmishAIs;
-	callback->getMaxSkirmishAIs = &skirmishAiCallback_getMaxSkirmishAIs;
-	callback->SkirmishAI_getTeamId = &skirmishAiCallback_SkirmishAI_getTeamId;
-	callback->SkirmishAI_Info_getSize = &skirmishAiCallback_SkirmishAI_Info_getSize;
-	callback->SkirmishAI_Info_getKey = &skirmishAiCallback_SkirmishAI_Info_getKey;
-	callback->SkirmishAI_Info_getValue = &skirmishAiCallback_SkirmishAI_Info_getValue;
-	callback->SkirmishAI_Info_getDescription = &skirmishAiCallback_SkirmishAI_Info_getDescription;
-	callback->SkirmishAI_Info_getValueByKey = &skirmishAiCallback_SkirmishAI_Info_getValueByKey;
-	callback->SkirmishAI_OptionValues_getSize = &skirmishAiCallback_SkirmishAI_OptionValues_getSize;
-	callback->SkirmishAI_OptionValues_getKey = &skirmishAiCallback_SkirmishAI_OptionValues_getKey;
-	callback->SkirmishAI_OptionValues_getValue = &skirmishAiCallback_SkirmishAI_OptionValues_getValue;
-	callback->SkirmishAI_OptionValues_getValueByKey = &skirmishAiCallback_SkirmishAI_OptionValues_getValueByKey;
-	callback->Log_log = &skirmishAiCallback_Log_log;
-	callback->Log_exception = &skirmishAiCallback_Log_exception;
-	callback->DataDirs_getPathSeparator = &skirmishAiCallback_DataDirs_getPathSeparator;
-	callback->DataDirs_getConfigDir = &skirmishAiCallback_DataDirs_getConfigDir;
-	callback->DataDirs_getWriteableDir = &skirmishAiCallback_DataDirs_getWriteableDir;
-	callback->DataDirs_locatePath = &skirmishAiCallback_DataDirs_locatePath;
-	callback->DataDirs_Roots_getSize = &skirmishAiCallback_DataDirs_Roots_getSize;
-	callback->DataDirs_Roots_getDir = &skirmishAiCallback_DataDirs_Roots_getDir;
-	callback->DataDirs_Roots_locatePath = &skirmishAiCallback_DataDirs_Roots_locatePath;
-	callback->Game_getCurrentFrame = &skirmishAiCallback_Game_getCurrentFrame;
-	callback->Game_getAiInterfaceVersion = &skirmishAiCallback_Game_getAiInterfaceVersion;
-	callback->Game_getMyTeam = &skirmishAiCallback_Game_getMyTeam;
-	callback->Game_getMyAllyTeam = &skirmishAiCallback_Game_getMyAllyTeam;
-	callback->Game_getPlayerTeam = &skirmishAiCallback_Game_getPlayerTeam;
-	callback->Game_getTeams = &skirmishAiCallback_Game_getTeams;
-	callback->Game_getTeamSide = &skirmishAiCallback_Game_getTeamSide;
-	callback->Game_getTeamColor = &skirmishAiCallback_Game_getTeamColor;
-	callback->Game_getTeamIncomeMultiplier = &skirmishAiCallback_Game_getTeamIncomeMultiplier;
-	callback->Game_getTeamAllyTeam = &skirmishAiCallback_Game_getTeamAllyTeam;
-	callback->Game_getTeamResourceCurrent = &skirmishAiCallback_Game_getTeamResourceCurrent;
-	callback->Game_getTeamResourceIncome = &skirmishAiCallback_Game_getTeamResourceIncome;
-	callback->Game_getTeamResourceUsage = &skirmishAiCallback_Game_getTeamResourceUsage;
-	callback->Game_getTeamResourceStorage = &skirmishAiCallback_Game_getTeamResourceStorage;
-	callback->Game_getTeamResourcePull = &skirmishAiCallback_Game_getTeamResourcePull;
-	callback->Game_getTeamResourceShare = &skirmishAiCallback_Game_getTeamResourceShare;
-	callback->Game_getTeamResourceSent = &skirmishAiCallback_Game_getTeamResourceSent;
-	callback->Game_getTeamResourceReceived = &skirmishAiCallback_Game_getTeamResourceReceived;
-	callback->Game_getTeamResourceExcess = &skirmishAiCallback_Game_getTeamResourceExcess;
-	callback->Game_isAllied = &skirmishAiCallback_Game_isAllied;
-	callback->Game_isDebugModeEnabled = &skirmishAiCallback_Game_isDebugModeEnabled;
-	callback->Game_isPaused = &skirmishAiCallback_Game_isPaused;
-	callback->Game_getSpeedFactor = &skirmishAiCallback_Game_getSpeedFactor;
-	callback->Game_getSetupScript = &skirmishAiCallback_Game_getSetupScript;
-	callback->Game_getCategoryFlag = &skirmishAiCallback_Game_getCategoryFlag;
-	callback->Game_getCategoriesFlag = &skirmishAiCallback_Game_getCategoriesFlag;
-	callback->Game_getCategoryName = &skirmishAiCallback_Game_getCategoryName;
-	callback->Game_getRulesParamFloat = &skirmishAiCallback_Game_getRulesParamFloat;
-	callback->Game_getRulesParamString = &skirmishAiCallback_Game_getRulesParamString;
-	callback->Cheats_isEnabled = &skirmishAiCallback_Cheats_isEnabled;
-	callback->Cheats_setEnabled = &skirmishAiCallback_Cheats_setEnabled;
-	callback->Cheats_setEventsEnabled = &skirmishAiCallback_Cheats_setEventsEnabled;
-	callback->Cheats_isOnlyPassive = &skirmishAiCallback_Cheats_isOnlyPassive;
-	callback->getResources = &skirmishAiCallback_getResources;
-	callback->getResourceByName = &skirmishAiCallback_getResourceByName;
-	callback->Resource_getName = &skirmishAiCallback_Resource_getName;
-	callback->Resource_getOptimum = &skirmishAiCallback_Resource_getOptimum;
-	callback->Economy_getCurrent = &skirmishAiCallback_Economy_getCurrent;
-	callback->Economy_getIncome = &skirmishAiCallback_Economy_getIncome;
-	callback->Economy_getUsage = &skirmishAiCallback_Economy_getUsage;
-	callback->Economy_getStorage = &skirmishAiCallback_Economy_getStorage;
-	callback->Economy_getPull = &skirmishAiCallback_Economy_getPull;
-	callback->Economy_getShare = &skirmishAiCallback_Economy_getShare;
-	callback->Economy_getSent = &skirmishAiCallback_Economy_getSent;
-	callback->Economy_getReceived = &skirmishAiCallback_Economy_getReceived;
-	callback->Economy_getExcess = &skirmishAiCallback_Economy_getExcess;
-	callback->File_getSize = &skirmishAiCallback_File_getSize;
-	callback->File_getContent = &skirmishAiCallback_File_getContent;
-	callback->getUnitDefs = &skirmishAiCallback_getUnitDefs;
-	callback->getUnitDefByName = &skirmishAiCallback_getUnitDefByName;
-	callback->UnitDef_getHeight = &skirmishAiCallback_UnitDef_getHeight;
-	callback->UnitDef_getRadius = &skirmishAiCallback_UnitDef_getRadius;
-	callback->UnitDef_getName = &skirmishAiCallback_UnitDef_getName;
-	callback->UnitDef_getHumanName = &skirmishAiCallback_UnitDef_getHumanName;
-	callback->UnitDef_getUpkeep = &skirmishAiCallback_UnitDef_getUpkeep;
-	callback->UnitDef_getResourceMake = &skirmishAiCallback_UnitDef_getResourceMake;
-	callback->UnitDef_getMakesResource = &skirmishAiCallback_UnitDef_getMakesResource;
-	callback->UnitDef_getCost = &skirmishAiCallback_UnitDef_getCost;
-	callback->UnitDef_getExtractsResource = &skirmishAiCallback_UnitDef_getExtractsResource;
-	callback->UnitDef_getResourceExtractorRange = &skirmishAiCallback_UnitDef_getResourceExtractorRange;
-	callback->UnitDef_getWindResourceGenerator = &skirmishAiCallback_UnitDef_getWindResourceGenerator;
-	callback->UnitDef_getTidalResourceGenerator = &skirmishAiCallback_UnitDef_getTidalResourceGenerator;
-	callback->UnitDef_getStorage = &skirmishAiCallback_UnitDef_getStorage;
-	callback->UnitDef_getBuildTime = &skirmishAiCallback_UnitDef_getBuildTime;
-	callback->UnitDef_getAutoHeal = &skirmishAiCallback_UnitDef_getAutoHeal;
-	callback->UnitDef_getIdleAutoHeal = &skirmishAiCallback_UnitDef_getIdleAutoHeal;
-	callback->UnitDef_getIdleTime = &skirmishAiCallback_UnitDef_getIdleTime;
-	callback->UnitDef_getPower = &skirmishAiCallback_UnitDef_getPower;
-	callback->UnitDef_getHealth = &skirmishAiCallback_UnitDef_getHealth;
-	callback->UnitDef_getCategory = &skirmishAiCallback_UnitDef_getCategory;
-	callback->UnitDef_getSpeed = &skirmishAiCallback_UnitDef_getSpeed;
-	callback->UnitDef_getTurnRate = &skirmishAiCallback_UnitDef_getTurnRate;
-	callback->UnitDef_isTurnInPlace = &skirmishAiCallback_UnitDef_isTurnInPlace;
-	callback->UnitDef_getTurnInPlaceDistance = &skirmishAiCallback_UnitDef_getTurnInPlaceDistance;
-	callback->UnitDef_getTurnInPlaceSpeedLimit = &skirmishAiCallback_UnitDef_getTurnInPlaceSpeedLimit;
-	callback->UnitDef_isUpright = &skirmishAiCallback_UnitDef_isUpright;
-	callback->UnitDef_isCollide = &skirmishAiCallback_UnitDef_isCollide;
-	callback->UnitDef_getLosRadius = &skirmishAiCallback_UnitDef_getLosRadius;
-	callback->UnitDef_getAirLosRadius = &skirmishAiCallback_UnitDef_getAirLosRadius;
-	callback->UnitDef_getLosHeight = &skirmishAiCallback_UnitDef_getLosHeight;
-	callback->UnitDef_getRadarRadius = &skirmishAiCallback_UnitDef_getRadarRadius;
-	callback->UnitDef_getSonarRadius = &skirmishAiCallback_UnitDef_getSonarRadius;
-	callback->UnitDef_getJammerRadius = &skirmishAiCallback_UnitDef_getJammerRadius;
-	callback->UnitDef_getSonarJamRadius = &skirmishAiCallback_UnitDef_getSonarJamRadius;
-	callback->UnitDef_getSeismicRadius = &skirmishAiCallback_UnitDef_getSeismicRadius;
-	callback->UnitDef_getSeismicSignature = &skirmishAiCallback_UnitDef_getSeismicSignature;
-	callback->UnitDef_isStealth = &skirmishAiCallback_UnitDef_isStealth;
-	callback->UnitDef_isSonarStealth = &skirmishAiCallback_UnitDef_isSonarStealth;
-	callback->UnitDef_isBuildRange3D = &skirmishAiCallback_UnitDef_isBuildRange3D;
-	callback->UnitDef_getBuildDistance = &skirmishAiCallback_UnitDef_getBuildDistance;
-	callback->UnitDef_getBuildSpeed = &skirmishAiCallback_UnitDef_getBuildSpeed;
-	callback->UnitDef_getReclaimSpeed = &skirmishAiCallback_UnitDef_getReclaimSpeed;
-	callback->UnitDef_getRepairSpeed = &skirmishAiCallback_UnitDef_getRepairSpeed;
-	callback->UnitDef_getMaxRepairSpeed = &skirmishAiCallback_UnitDef_getMaxRepairSpeed;
-	callback->UnitDef_getResurrectSpeed = &skirmishAiCallback_UnitDef_getResurrectSpeed;
-	callback->UnitDef_getCaptureSpeed = &skirmishAiCallback_UnitDef_getCaptureSpeed;
-	callback->UnitDef_getTerraformSpeed = &skirmishAiCallback_UnitDef_getTerraformSpeed;
-	callback->UnitDef_getUpDirSmoothing = &skirmishAiCallback_UnitDef_getUpDirSmoothing;
-	callback->UnitDef_getMass = &skirmishAiCallback_UnitDef_getMass;
-	callback->UnitDef_isPushResistant = &skirmishAiCallback_UnitDef_isPushResistant;
-	callback->UnitDef_isStrafeToAttack = &skirmishAiCallback_UnitDef_isStrafeToAttack;
-	callback->UnitDef_getMinCollisionSpeed = &skirmishAiCallback_UnitDef_getMinCollisionSpeed;
-	callback->UnitDef_getSlideTolerance = &skirmishAiCallback_UnitDef_getSlideTolerance;
-	callback->UnitDef_getMaxHeightDif = &skirmishAiCallback_UnitDef_getMaxHeightDif;
-	callback->UnitDef_getMinWaterDepth = &skirmishAiCallback_UnitDef_getMinWaterDepth;
-	callback->UnitDef_getWaterline = &skirmishAiCallback_UnitDef_getWaterline;
-	callback->UnitDef_getMaxWaterDepth = &skirmishAiCallback_UnitDef_getMaxWaterDepth;
-	callback->UnitDef_getArmoredMultiple = &skirmishAiCallback_UnitDef_getArmoredMultiple;
-	callback->UnitDef_getArmorType = &skirmishAiCallback_UnitDef_getArmorType;
-	callback->UnitDef_FlankingBonus_getMode = &skirmishAiCallback_UnitDef_FlankingBonus_getMode;
-	callback->UnitDef_FlankingBonus_getDir = &skirmishAiCallback_UnitDef_FlankingBonus_getDir;
-	callback->UnitDef_FlankingBonus_getMax = &skirmishAiCallback_UnitDef_FlankingBonus_getMax;
-	callback->UnitDef_FlankingBonus_getMin = &skirmishAiCallback_UnitDef_FlankingBonus_getMin;
-	callback->UnitDef_FlankingBonus_getMobilityAdd = &skirmishAiCallback_UnitDef_FlankingBonus_getMobilityAdd;
-	callback->UnitDef_getMaxWeaponRange = &skirmishAiCallback_UnitDef_getMaxWeaponRange;
-	callback->UnitDef_getTooltip = &skirmishAiCallback_UnitDef_getTooltip;
-	callback->UnitDef_getWreckName = &skirmishAiCallback_UnitDef_getWreckName;
-	callback->UnitDef_getDeathExplosion = &skirmishAiCallback_UnitDef_getDeathExplosion;
-	callback->UnitDef_getSelfDExplosion = &skirmishAiCallback_UnitDef_getSelfDExplosion;
-	callback->UnitDef_getCategoryString = &skirmishAiCallback_UnitDef_getCategoryString;
-	callback->UnitDef_isAbleToSelfD = &skirmishAiCallback_UnitDef_isAbleToSelfD;
-	callback->UnitDef_getSelfDCountdown = &skirmishAiCallback_UnitDef_getSelfDCountdown;
-	callback->UnitDef_isAbleToSubmerge = &skirmishAiCallback_UnitDef_isAbleToSubmerge;
-	callback->UnitDef_isAbleToFly = &skirmishAiCallback_UnitDef_isAbleToFly;
-	callback->UnitDef_isAbleToMove = &skirmishAiCallback_UnitDef_isAbleToMove;
-	callback->UnitDef_isAbleToHover = &skirmishAiCallback_UnitDef_isAbleToHover;
-	callback->UnitDef_isFloater = &skirmishAiCallback_UnitDef_isFloater;
-	callback->UnitDef_isBuilder = &skirmishAiCallback_UnitDef_isBuilder;
-	callback->UnitDef_isActivateWhenBuilt = &skirmishAiCallback_UnitDef_isActivateWhenBuilt;
-	callback->UnitDef_isOnOffable = &skirmishAiCallback_UnitDef_isOnOffable;
-	callback->UnitDef_isFullHealthFactory = &skirmishAiCallback_UnitDef_isFullHealthFactory;
-	callback->UnitDef_isFactoryHeadingTakeoff = &skirmishAiCallback_UnitDef_isFactoryHeadingTakeoff;
-	callback->UnitDef_isReclaimable = &skirmishAiCallback_UnitDef_isReclaimable;
-	callback->UnitDef_isCapturable = &skirmishAiCallback_UnitDef_isCapturable;
-	callback->UnitDef_isAbleToRestore = &skirmishAiCallback_UnitDef_isAbleToRestore;
-	callback->UnitDef_isAbleToRepair = &skirmishAiCallback_UnitDef_isAbleToRepair;
-	callback->UnitDef_isAbleToSelfRepair = &skirmishAiCallback_UnitDef_isAbleToSelfRepair;
-	callback->UnitDef_isAbleToReclaim = &skirmishAiCallback_UnitDef_isAbleToReclaim;
-	callback->UnitDef_isAbleToAttack = &skirmishAiCallback_UnitDef_isAbleToAttack;
-	callback->UnitDef_isAbleToPatrol = &skirmishAiCallback_UnitDef_isAbleToPatrol;
-	callback->UnitDef_isAbleToFight = &skirmishAiCallback_UnitDef_isAbleToFight;
-	callback->UnitDef_isAbleToGuard = &skirmishAiCallback_UnitDef_isAbleToGuard;
-	callback->UnitDef_isAbleToAssist = &skirmishAiCallback_UnitDef_isAbleToAssist;
-	callback->UnitDef_isAssistable = &skirmishAiCallback_UnitDef_isAssistable;
-	callback->UnitDef_isAbleToRepeat = &skirmishAiCallback_UnitDef_isAbleToRepeat;
-	callback->UnitDef_isAbleToFireControl = &skirmishAiCallback_UnitDef_isAbleToFireControl;
-	callback->UnitDef_getFireState = &skirmishAiCallback_UnitDef_getFireState;
-	callback->UnitDef_getMoveState = &skirmishAiCallback_UnitDef_getMoveState;
-	callback->UnitDef_getWingDrag = &skirmishAiCallback_UnitDef_getWingDrag;
-	callback->UnitDef_getWingAngle = &skirmishAiCallback_UnitDef_getWingAngle;
-	callback->UnitDef_getFrontToSpeed = &skirmishAiCallback_UnitDef_getFrontToSpeed;
-	callback->UnitDef_getSpeedToFront = &skirmishAiCallback_UnitDef_getSpeedToFront;
-	callback->UnitDef_getMyGravity = &skirmishAiCallback_UnitDef_getMyGravity;
-	callback->UnitDef_getMaxBank = &skirmishAiCallback_UnitDef_getMaxBank;
-	callback->UnitDef_getMaxPitch = &skirmishAiCallback_UnitDef_getMaxPitch;
-	callback->UnitDef_getTurnRadius = &skirmishAiCallback_UnitDef_getTurnRadius;
-	callback->UnitDef_getWantedHeight = &skirmishAiCallback_UnitDef_getWantedHeight;
-	callback->UnitDef_getVerticalSpeed = &skirmishAiCallback_UnitDef_getVerticalSpeed;
-
-	callback->UnitDef_isHoverAttack = &skirmishAiCallback_UnitDef_isHoverAttack;
-	callback->UnitDef_isAirStrafe = &skirmishAiCallback_UnitDef_isAirStrafe;
-
-	callback->UnitDef_getDlHoverFactor = &skirmishAiCallback_UnitDef_getDlHoverFactor;
-	callback->UnitDef_getMaxAcceleration = &skirmishAiCallback_UnitDef_getMaxAcceleration;
-	callback->UnitDef_getMaxDeceleration = &skirmishAiCallback_UnitDef_getMaxDeceleration;
-	callback->UnitDef_getMaxAileron = &skirmishAiCallback_UnitDef_getMaxAileron;
-	callback->UnitDef_getMaxElevator = &skirmishAiCallback_UnitDef_getMaxElevator;
-	callback->UnitDef_getMaxRudder = &skirmishAiCallback_UnitDef_getMaxRudder;
-	callback->UnitDef_getYardMap = &skirmishAiCallback_UnitDef_getYardMap;
-	callback->UnitDef_getXSize = &skirmishAiCallback_UnitDef_getXSize;
-	callback->UnitDef_getZSize = &skirmishAiCallback_UnitDef_getZSize;
-	callback->UnitDef_getLoadingRadius = &skirmishAiCallback_UnitDef_getLoadingRadius;
-	callback->UnitDef_getUnloadSpread = &skirmishAiCallback_UnitDef_getUnloadSpread;
-	callback->UnitDef_getTransportCapacity = &skirmishAiCallback_UnitDef_getTransportCapacity;
-	callback->UnitDef_getTransportSize = &skirmishAiCallback_UnitDef_getTransportSize;
-	callback->UnitDef_getMinTransportSize = &skirmishAiCallback_UnitDef_getMinTransportSize;
-	callback->UnitDef_isAirBase = &skirmishAiCallback_UnitDef_isAirBase;
-	callback->UnitDef_isFirePlatform = &skirmishAiCallback_UnitDef_isFirePlatform;
-	callback->UnitDef_getTransportMass = &skirmishAiCallback_UnitDef_getTransportMass;
-	callback->UnitDef_getMinTransportMass = &skirmishAiCallback_UnitDef_getMinTransportMass;
-	callback->UnitDef_isHoldSteady = &skirmishAiCallback_UnitDef_isHoldSteady;
-	callback->UnitDef_isReleaseHeld = &skirmishAiCallback_UnitDef_isReleaseHeld;
-	callback->UnitDef_isNotTransportable = &skirmishAiCallback_UnitDef_isNotTransportable;
-	callback->UnitDef_isTransportByEnemy = &skirmishAiCallback_UnitDef_isTransportByEnemy;
-	callback->UnitDef_getTransportUnloadMethod = &skirmishAiCallback_UnitDef_getTransportUnloadMethod;
-	callback->UnitDef_getFallSpeed = &skirmishAiCallback_UnitDef_getFallSpeed;
-	callback->UnitDef_getUnitFallSpeed = &skirmishAiCallback_UnitDef_getUnitFallSpeed;
-	callback->UnitDef_isAbleToCloak = &skirmishAiCallback_UnitDef_isAbleToCloak;
-	callback->UnitDef_isStartCloaked = &skirmishAiCallback_UnitDef_isStartCloaked;
-	callback->UnitDef_getCloakCost = &skirmishAiCallback_UnitDef_getCloakCost;
-	callback->UnitDef_getCloakCostMoving = &skirmishAiCallback_UnitDef_getCloakCostMoving;
-	callback->UnitDef_getDecloakDistance = &skirmishAiCallback_UnitDef_getDecloakDistance;
-	callback->UnitDef_isDecloakSpherical = &skirmishAiCallback_UnitDef_isDecloakSpherical;
-	callback->UnitDef_isDecloakOnFire = &skirmishAiCallback_UnitDef_isDecloakOnFire;
-	callback->UnitDef_isAbleToKamikaze = &skirmishAiCallback_UnitDef_isAbleToKamikaze;
-	callback->UnitDef_getKamikazeDist = &skirmishAiCallback_UnitDef_getKamikazeDist;
-	callback->UnitDef_isTargetingFacility = &skirmishAiCallback_UnitDef_isTargetingFacility;
-	callback->UnitDef_canManualFire = &skirmishAiCallback_UnitDef_canManualFire;
-	callback->UnitDef_isNeedGeo = &skirmishAiCallback_UnitDef_isNeedGeo;
-	callback->UnitDef_isFeature = &skirmishAiCallback_UnitDef_isFeature;
-	callback->UnitDef_isHideDamage = &skirmishAiCallback_UnitDef_isHideDamage;
-	callback->UnitDef_isShowPlayerName = &skirmishAiCallback_UnitDef_isShowPlayerName;
-	callback->UnitDef_isAbleToResurrect = &skirmishAiCallback_UnitDef_isAbleToResurrect;
-	callback->UnitDef_isAbleToCapture = &skirmishAiCallback_UnitDef_isAbleToCapture;
-	callback->UnitDef_getHighTrajectoryType = &skirmishAiCallback_UnitDef_getHighTrajectoryType;
-	callback->UnitDef_getNoChaseCategory = &skirmishAiCallback_UnitDef_getNoChaseCategory;
-	callback->UnitDef_isAbleToDropFlare = &skirmishAiCallback_UnitDef_isAbleToDropFlare;
-	callback->UnitDef_getFlareReloadTime = &skirmishAiCallback_UnitDef_getFlareReloadTime;
-	callback->UnitDef_getFlareEfficiency = &skirmishAiCallback_UnitDef_getFlareEfficiency;
-	callback->UnitDef_getFlareDelay = &skirmishAiCallback_UnitDef_getFlareDelay;
-	callback->UnitDef_getFlareDropVector = &skirmishAiCallback_UnitDef_getFlareDropVector;
-	callback->UnitDef_getFlareTime = &skirmishAiCallback_UnitDef_getFlareTime;
-	callback->UnitDef_getFlareSalvoSize = &skirmishAiCallback_UnitDef_getFlareSalvoSize;
-	callback->UnitDef_getFlareSalvoDelay = &skirmishAiCallback_UnitDef_getFlareSalvoDelay;
-	callback->UnitDef_isAbleToLoopbackAttack = &skirmishAiCallback_UnitDef_isAbleToLoopbackAttack;
-	callback->UnitDef_isLevelGround = &skirmishAiCallback_UnitDef_isLevelGround;
-	callback->UnitDef_getMaxThisUnit = &skirmishAiCallback_UnitDef_getMaxThisUnit;
-	callback->UnitDef_getDecoyDef = &skirmishAiCallback_UnitDef_getDecoyDef;
-	callback->UnitDef_isDontLand = &skirmishAiCallback_UnitDef_isDontLand;
-	callback->UnitDef_getShieldDef = &skirmishAiCallback_UnitDef_getShieldDef;
-	callback->UnitDef_getStockpileDef = &skirmishAiCallback_UnitDef_getStockpileDef;
-	callback->UnitDef_getBuildOptions = &skirmishAiCallback_UnitDef_getBuildOptions;
-	callback->UnitDef_getCustomParams = &skirmishAiCallback_UnitDef_getCustomParams;
-	callback->UnitDef_isMoveDataAvailable = &skirmishAiCallback_UnitDef_isMoveDataAvailable;
-	callback->UnitDef_MoveData_getXSize = &skirmishAiCallback_UnitDef_MoveData_getXSize;
-	callback->UnitDef_MoveData_getZSize = &skirmishAiCallback_UnitDef_MoveData_getZSize;
-	callback->UnitDef_MoveData_getDepth = &skirmishAiCallback_UnitDef_MoveData_getDepth;
-	callback->UnitDef_MoveData_getMaxSlope = &skirmishAiCallback_UnitDef_MoveData_getMaxSlope;
-	callback->UnitDef_MoveData_getSlopeMod = &skirmishAiCallback_UnitDef_MoveData_getSlopeMod;
-	callback->UnitDef_MoveData_getDepthMod = &skirmishAiCallback_UnitDef_MoveData_getDepthMod;
-	callback->UnitDef_MoveData_getPathType = &skirmishAiCallback_UnitDef_MoveData_getPathType;
-	callback->UnitDef_MoveData_getCrushStrength = &skirmishAiCallback_UnitDef_MoveData_getCrushStrength;
-	callback->UnitDef_MoveData_getSpeedModClass = &skirmishAiCallback_UnitDef_MoveData_getSpeedModClass;
-	callback->UnitDef_MoveData_getTerrainClass = &skirmishAiCallback_UnitDef_MoveData_getTerrainClass;
-	callback->UnitDef_MoveData_getFollowGround = &skirmishAiCallback_UnitDef_MoveData_getFollowGround;
-	callback->UnitDef_MoveData_isSubMarine = &skirmishAiCallback_UnitDef_MoveData_isSubMarine;
-	callback->UnitDef_MoveData_getName = &skirmishAiCallback_UnitDef_MoveData_getName;
-	callback->UnitDef_getWeaponMounts = &skirmishAiCallback_UnitDef_getWeaponMounts;
-	callback->UnitDef_WeaponMount_getName = &skirmishAiCallback_UnitDef_WeaponMount_getName;
-	callback->UnitDef_WeaponMount_getWeaponDef = &skirmishAiCallback_UnitDef_WeaponMount_getWeaponDef;
-	callback->UnitDef_WeaponMount_getSlavedTo = &skirmishAiCallback_UnitDef_WeaponMount_getSlavedTo;
-	callback->UnitDef_WeaponMount_getMainDir = &skirmishAiCallback_UnitDef_WeaponMount_getMainDir;
-	callback->UnitDef_WeaponMount_getMaxAngleDif = &skirmishAiCallback_UnitDef_WeaponMount_getMaxAngleDif;
-	callback->UnitDef_WeaponMount_getBadTargetCategory = &skirmishAiCallback_UnitDef_WeaponMount_getBadTargetCategory;
-	callback->UnitDef_WeaponMount_getOnlyTargetCategory = &skirmishAiCallback_UnitDef_WeaponMount_getOnlyTargetCategory;
-	callback->Unit_getLimit = &skirmishAiCallback_Unit_getLimit;
-	callback->Unit_getMax = &skirmishAiCallback_Unit_getMax;
-	callback->getEnemyUnits = &skirmishAiCallback_getEnemyUnits;
-	callback->getEnemyUnitsIn = &skirmishAiCallback_getEnemyUnitsIn;
-	callback->getEnemyUnitsInRadarAndLos = &skirmishAiCallback_getEnemyUnitsInRadarAndLos;
-	callback->getFriendlyUnits = &skirmishAiCallback_getFriendlyUnits;
-	callback->getFriendlyUnitsIn = &skirmishAiCallback_getFriendlyUnitsIn;
-	callback->getNeutralUnits = &skirmishAiCallback_getNeutralUnits;
-	callback->getNeutralUnitsIn = &skirmishAiCallback_getNeutralUnitsIn;
-	callback->getTeamUnits = &skirmishAiCallback_getTeamUnits;
-	callback->getSelectedUnits = &skirmishAiCallback_getSelectedUnits;
-	callback->Unit_getDef = &skirmishAiCallback_Unit_getDef;
-	callback->Unit_getRulesParamFloat = &skirmishAiCallback_Unit_getRulesParamFloat;
-	callback->Unit_getRulesParamString = &skirmishAiCallback_Unit_getRulesParamString;
-	callback->Unit_getTeam = &skirmishAiCallback_Unit_getTeam;
-	callback->Unit_getAllyTeam = &skirmishAiCallback_Unit_getAllyTeam;
-	callback->Unit_getStockpile = &skirmishAiCallback_Unit_getStockpile;
-	callback->Unit_getStockpileQueued = &skirmishAiCallback_Unit_getStockpileQueued;
-	callback->Unit_getMaxSpeed = &skirmishAiCallback_Unit_getMaxSpeed;
-	callback->Unit_getMaxRange = &skirmishAiCallback_Unit_getMaxRange;
-	callback->Unit_getMaxHealth = &skirmishAiCallback_Unit_getMaxHealth;
-	callback->Unit_getExperience = &skirmishAiCallback_Unit_getExperience;
-	callback->Unit_getGroup = &skirmishAiCallback_Unit_getGroup;
-	callback->Unit_getCurrentCommands = &skirmishAiCallback_Unit_getCurrentCommands;
-	callback->Unit_CurrentCommand_getType = &skirmishAiCallback_Unit_CurrentCommand_getType;
-	callback->Unit_CurrentCommand_getId = &skirmishAiCallback_Unit_CurrentCommand_getId;
-	callback->Unit_CurrentCommand_getOptions = &skirmishAiCallback_Unit_CurrentCommand_getOptions;
-	callback->Unit_CurrentCommand_getTag = &skirmishAiCallback_Unit_CurrentCommand_getTag;
-	callback->Unit_CurrentCommand_getTimeOut = &skirmishAiCallback_Unit_CurrentCommand_getTimeOut;
-	callback->Unit_CurrentCommand_getParams = &skirmishAiCallback_Unit_CurrentCommand_getParams;
-	callback->Unit_getSupportedCommands = &skirmishAiCallback_Unit_getSupportedCommands;
-	callback->Unit_SupportedCommand_getId = &skirmishAiCallback_Unit_SupportedCommand_getId;
-	callback->Unit_SupportedCommand_getName = &skirmishAiCallback_Unit_SupportedCommand_getName;
-	callback->Unit_SupportedCommand_getToolTip = &skirmishAiCallback_Unit_SupportedCommand_getToolTip;
-	callback->Unit_SupportedCommand_isShowUnique = &skirmishAiCallback_Unit_SupportedCommand_isShowUnique;
-	callback->Unit_SupportedCommand_isDisabled = &skirmishAiCallback_Unit_SupportedCommand_isDisabled;
-	callback->Unit_SupportedCommand_getParams = &skirmishAiCallback_Unit_SupportedCommand_getParams;
-	callback->Unit_getHealth = &skirmishAiCallback_Unit_getHealth;
-	callback->Unit_getParalyzeDamage = &skirmishAiCallback_Unit_getParalyzeDamage;
-	callback->Unit_getCaptureProgress = &skirmishAiCallback_Unit_getCaptureProgress;
-	callback->Unit_getBuildProgress = &skirmishAiCallback_Unit_getBuildProgress;
-	callback->Unit_getSpeed = &skirmishAiCallback_Unit_getSpeed;
-	callback->Unit_getPower = &skirmishAiCallback_Unit_getPower;
-	callback->Unit_getResourceUse = &skirmishAiCallback_Unit_getResourceUse;
-	callback->Unit_getResourceMake = &skirmishAiCallback_Unit_getResourceMake;
-	callback->Unit_getPos = &skirmishAiCallback_Unit_getPos;
-	callback->Unit_getVel = &skirmishAiCallback_Unit_getVel;
-	callback->Unit_isActivated = &skirmishAiCallback_Unit_isActivated;
-	callback->Unit_isBeingBuilt = &skirmishAiCallback_Unit_isBeingBuilt;
-	callback->Unit_isCloaked = &skirmishAiCallback_Unit_isCloaked;
-	callback->Unit_isParalyzed = &skirmishAiCallback_Unit_isParalyzed;
-	callback->Unit_isNeutral = &skirmishAiCallback_Unit_isNeutral;
-	callback->Unit_getBuildingFacing = &skirmishAiCallback_Unit_getBuildingFacing;
-	callback->Unit_getLastUserOrderFrame = &skirmishAiCallback_Unit_getLastUserOrderFrame;
-	callback->Unit_getWeapons = &skirmishAiCallback_Unit_getWeapons;
-	callback->Unit_getWeapon = &skirmishAiCallback_Unit_getWeapon;
-	callback->Team_hasAIController = &skirmishAiCallback_Team_hasAIController;
-	callback->getEnemyTeams = &skirmishAiCallback_getEnemyTeams;
-	callback->getAlliedTeams = &skirmishAiCallback_getAlliedTeams;
-	callback->Team_getRulesParamFloat = &skirmishAiCallback_Team_getRulesParamFloat;
-	callback->Team_getRulesParamString = &skirmishAiCallback_Team_getRulesParamString;
-	callback->getGroups = &skirmishAiCallback_getGroups;
-	callback->Group_getSupportedCommands = &skirmishAiCallback_Group_getSupportedCommands;
-	callback->Group_SupportedCommand_getId = &skirmishAiCallback_Group_SupportedCommand_getId;
-	callback->Group_SupportedCommand_getName = &skirmishAiCallback_Group_SupportedCommand_getName;
-	callback->Group_SupportedCommand_getToolTip = &skirmishAiCallback_Group_SupportedCommand_getToolTip;
-	callback->Group_SupportedCommand_isShowUnique = &skirmishAiCallback_Group_SupportedCommand_isShowUnique;
-	callback->Group_SupportedCommand_isDisabled = &skirmishAiCallback_Group_SupportedCommand_isDisabled;
-	callback->Group_SupportedCommand_getParams = &skirmishAiCallback_Group_SupportedCommand_getParams;
-	callback->Group_OrderPreview_getId = &skirmishAiCallback_Group_OrderPreview_getId;
-	callback->Group_OrderPreview_getOptions = &skirmishAiCallback_Group_OrderPreview_getOptions;
-	callback->Group_OrderPreview_getTag = &skirmishAiCallback_Group_OrderPreview_getTag;
-	callback->Group_OrderPreview_getTimeOut = &skirmishAiCallback_Group_OrderPreview_getTimeOut;
-	callback->Group_OrderPreview_getParams = &skirmishAiCallback_Group_OrderPreview_getParams;
-	callback->Group_isSelected = &skirmishAiCallback_Group_isSelected;
-	callback->Mod_getFileName = &skirmishAiCallback_Mod_getFileName;
-	callback->Mod_getHash = &skirmishAiCallback_Mod_getHash;
-	callback->Mod_getHumanName = &skirmishAiCallback_Mod_getHumanName;
-	callback->Mod_getShortName = &skirmishAiCallback_Mod_getShortName;
-	callback->Mod_getVersion = &skirmishAiCallback_Mod_getVersion;
-	callback->Mod_getMutator = &skirmishAiCallback_Mod_getMutator;
-	callback->Mod_getDescription = &skirmishAiCallback_Mod_getDescription;
-	callback->Mod_getConstructionDecay = &skirmishAiCallback_Mod_getConstructionDecay;
-	callback->Mod_getConstructionDecayTime = &skirmishAiCallback_Mod_getConstructionDecayTime;
-	callback->Mod_getConstructionDecaySpeed = &skirmishAiCallback_Mod_getConstructionDecaySpeed;
-	callback->Mod_getMultiReclaim = &skirmishAiCallback_Mod_getMultiReclaim;
-	callback->Mod_getReclaimMethod = &skirmishAiCallback_Mod_getReclaimMethod;
-	callback->Mod_getReclaimUnitMethod = &skirmishAiCallback_Mod_getReclaimUnitMethod;
-	callback->Mod_getReclaimUnitEnergyCostFactor = &skirmishAiCallback_Mod_getReclaimUnitEnergyCostFactor;
-	callback->Mod_getReclaimUnitEfficiency = &skirmishAiCallback_Mod_getReclaimUnitEfficiency;
-	callback->Mod_getReclaimFeatureEnergyCostFactor = &skirmishAiCallback_Mod_getReclaimFeatureEnergyCostFactor;
-	callback->Mod_getReclaimAllowEnemies = &skirmishAiCallback_Mod_getReclaimAllowEnemies;
-	callback->Mod_getReclaimAllowAllies = &skirmishAiCallback_Mod_getReclaimAllowAllies;
-	callback->Mod_getRepairEnergyCostFactor = &skirmishAiCallback_Mod_getRepairEnergyCostFactor;
-	callback->Mod_getResurrectEnergyCostFactor = &skirmishAiCallback_Mod_getResurrectEnergyCostFactor;
-	callback->Mod_getCaptureEnergyCostFactor = &skirmishAiCallback_Mod_getCaptureEnergyCostFactor;
-	callback->Mod_getTransportGround = &skirmishAiCallback_Mod_getTransportGround;
-	callback->Mod_getTransportHover = &skirmishAiCallback_Mod_getTransportHover;
-	callback->Mod_getTransportShip = &skirmishAiCallback_Mod_getTransportShip;
-	callback->Mod_getTransportAir = &skirmishAiCallback_Mod_getTransportAir;
-	callback->Mod_getFireAtKilled = &skirmishAiCallback_Mod_getFireAtKilled;
-	callback->Mod_getFireAtCrashing = &skirmishAiCallback_Mod_getFireAtCrashing;
-	callback->Mod_getFlankingBonusModeDefault = &skirmishAiCallback_Mod_getFlankingBonusModeDefault;
-	callback->Mod_getLosMipLevel = &skirmishAiCallback_Mod_getLosMipLevel;
-	callback->Mod_getAirMipLevel = &skirmishAiCallback_Mod_getAirMipLevel;
-	callback->Mod_getRadarMipLevel = &skirmishAiCallback_Mod_getRadarMipLevel;
-	callback->Mod_getRequireSonarUnderWater = &skirmishAiCallback_Mod_getRequireSonarUnderWater;
-	callback->Map_getChecksum = &skirmishAiCallback_Map_getChecksum;
-	callback->Map_getStartPos = &skirmishAiCallback_Map_getStartPos;
-	callback->Map_getMousePos = &skirmishAiCallback_Map_getMousePos;
-	callback->Map_isPosInCamera = &skirmishAiCallback_Map_isPosInCamera;
-	callback->Map_getWidth = &skirmishAiCallback_Map_getWidth;
-	callback->Map_getHeight = &skirmishAiCallback_Map_getHeight;
-	callback->Map_getHeightMap = &skirmishAiCallback_Map_getHeightMap;
-	callback->Map_getCornersHeightMap = &skirmishAiCallback_Map_getCornersHeightMap;
-	callback->Map_getMinHeight = &skirmishAiCallback_Map_getMinHeight;
-	callback->Map_getMaxHeight = &skirmishAiCallback_Map_getMaxHeight;
-	callback->Map_getSlopeMap = &skirmishAiCallback_Map_getSlopeMap;
-	callback->Map_getLosMap = &skirmishAiCallback_Map_getLosMap;
-	callback->Map_getAirLosMap = &skirmishAiCallback_Map_getAirLosMap;
-	callback->Map_getRadarMap = &skirmishAiCallback_Map_getRadarMap;
-	callback->Map_getSonarMap = &skirmishAiCallback_Map_getSonarMap;
-	callback->Map_getSeismicMap = &skirmishAiCallback_Map_getSeismicMap;
-	callback->Map_getJammerMap = &skirmishAiCallback_Map_getJammerMap;
-	callback->Map_getSonarJammerMap = &skirmishAiCallback_Map_getSonarJammerMap;
-	callback->Map_getResourceMapRaw = &skirmishAiCallback_Map_getResourceMapRaw;
-	callback->Map_getResourceMapSpotsPositions = &skirmishAiCallback_Map_getResourceMapSpotsPositions;
-	callback->Map_getResourceMapSpotsAverageIncome = &skirmishAiCallback_Map_getResourceMapSpotsAverageIncome;
-	callback->Map_getResourceMapSpotsNearest = &skirmishAiCallback_Map_getResourceMapSpotsNearest;
-	callback->Map_getHash = &skirmishAiCallback_Map_getHash;
-	callback->Map_getName = &skirmishAiCallback_Map_getName;
-	callback->Map_getHumanName = &skirmishAiCallback_Map_getHumanName;
-	callback->Map_getElevationAt = &skirmishAiCallback_Map_getElevationAt;
-	callback->Map_getMaxResource = &skirmishAiCallback_Map_getMaxResource;
-	callback->Map_getExtractorRadius = &skirmishAiCallback_Map_getExtractorRadius;
-	callback->Map_getMinWind = &skirmishAiCallback_Map_getMinWind;
-	callback->Map_getMaxWind = &skirmishAiCallback_Map_getMaxWind;
-	callback->Map_getCurWind = &skirmishAiCallback_Map_getCurWind;
-	callback->Map_getTidalStrength = &skirmishAiCallback_Map_getTidalStrength;
-	callback->Map_getGravity = &skirmishAiCallback_Map_getGravity;
-	callback->Map_getWaterDamage = &skirmishAiCallback_Map_getWaterDamage;
-	callback->Map_isDeformable = &skirmishAiCallback_Map_isDeformable;
-	callback->Map_getHardness = &skirmishAiCallback_Map_getHardness;
-	callback->Map_getHardnessModMap = &skirmishAiCallback_Map_getHardnessModMap;
-	callback->Map_getSpeedModMap = &skirmishAiCallback_Map_getSpeedModMap;
-	callback->Map_getPoints = &skirmishAiCallback_Map_getPoints;
-	callback->Map_Point_getPosition = &skirmishAiCallback_Map_Point_getPosition;
-	callback->Map_Point_getColor = &skirmishAiCallback_Map_Point_getColor;
-	callback->Map_Point_getLabel = &skirmishAiCallback_Map_Point_getLabel;
-	callback->Map_getLines = &skirmishAiCallback_Map_getLines;
-	callback->Map_Line_getFirstPosition = &skirmishAiCallback_Map_Line_getFirstPosition;
-	callback->Map_Line_getSecondPosition = &skirmishAiCallback_Map_Line_getSecondPosition;
-	callback->Map_Line_getColor = &skirmishAiCallback_Map_Line_getColor;
-	callback->Map_isPossibleToBuildAt = &skirmishAiCallback_Map_isPossibleToBuildAt;
-	callback->Map_findClosestBuildSite = &skirmishAiCallback_Map_findClosestBuildSite;
-	callback->getFeatureDefs = &skirmishAiCallback_getFeatureDefs;
-	callback->FeatureDef_getName = &skirmishAiCallback_FeatureDef_getName;
-	callback->FeatureDef_getDescription = &skirmishAiCallback_FeatureDef_getDescription;
-	callback->FeatureDef_getContainedResource = &skirmishAiCallback_FeatureDef_getContainedResource;
-	callback->FeatureDef_getMaxHealth = &skirmishAiCallback_FeatureDef_getMaxHealth;
-	callback->FeatureDef_getReclaimTime = &skirmishAiCallback_FeatureDef_getReclaimTime;
-	callback->FeatureDef_getMass = &skirmishAiCallback_FeatureDef_getMass;
-	callback->FeatureDef_isUpright = &skirmishAiCallback_FeatureDef_isUpright;
-	callback->FeatureDef_getDrawType = &skirmishAiCallback_FeatureDef_getDrawType;
-	callback->FeatureDef_getModelName = &skirmishAiCallback_FeatureDef_getModelName;
-	callback->FeatureDef_getResurrectable = &skirmishAiCallback_FeatureDef_getResurrectable;
-	callback->FeatureDef_getSmokeTime = &skirmishAiCallback_FeatureDef_getSmokeTime;
-	callback->FeatureDef_isDestructable = &skirmishAiCallback_FeatureDef_isDestructable;
-	callback->FeatureDef_isReclaimable = &skirmishAiCallback_FeatureDef_isReclaimable;
-	callback->FeatureDef_isAutoreclaimable = &skirmishAiCallback_FeatureDef_isAutoreclaimable;
-	callback->FeatureDef_isBlocking = &skirmishAiCallback_FeatureDef_isBlocking;
-	callback->FeatureDef_isBurnable = &skirmishAiCallback_FeatureDef_isBurnable;
-	callback->FeatureDef_isFloating = &skirmishAiCallback_FeatureDef_isFloating;
-	callback->FeatureDef_isNoSelect = &skirmishAiCallback_FeatureDef_isNoSelect;
-	callback->FeatureDef_isGeoThermal = &skirmishAiCallback_FeatureDef_isGeoThermal;
-	callback->FeatureDef_getXSize = &skirmishAiCallback_FeatureDef_getXSize;
-	callback->FeatureDef_getZSize = &skirmishAiCallback_FeatureDef_getZSize;
-	callback->FeatureDef_getCustomParams = &skirmishAiCallback_FeatureDef_getCustomParams;
-	callback->getFeatures = &skirmishAiCallback_getFeatures;
-	callback->getFeaturesIn = &skirmishAiCallback_getFeaturesIn;
-	callback->Feature_getDef = &skirmishAiCallback_Feature_getDef;
-	callback->Feature_getHealth = &skirmishAiCallback_Feature_getHealth;
-	callback->Feature_getReclaimLeft = &skirmishAiCallback_Feature_getReclaimLeft;
-	callback->Feature_getPosition = &skirmishAiCallback_Feature_getPosition;
-	callback->Feature_getRulesParamFloat = &skirmishAiCallback_Feature_getRulesParamFloat;
-	callback->Feature_getRulesParamString = &skirmishAiCallback_Feature_getRulesParamString;
-	callback->Feature_getResurrectDef = &skirmishAiCallback_Feature_getResurrectDef;
-	callback->Feature_getBuildingFacing = &skirmishAiCallback_Feature_getBuildingFacing;
-	callback->getWeaponDefs = &skirmishAiCallback_getWeaponDefs;
-	callback->getWeaponDefByName = &skirmishAiCallback_getWeaponDefByName;
-	callback->WeaponDef_getName = &skirmishAiCallback_WeaponDef_getName;
-	callback->WeaponDef_getType = &skirmishAiCallback_WeaponDef_getType;
-	callback->WeaponDef_getDescription = &skirmishAiCallback_WeaponDef_getDescription;
-	callback->WeaponDef_getRange = &skirmishAiCallback_WeaponDef_getRange;
-	callback->WeaponDef_getHeightMod = &skirmishAiCallback_WeaponDef_getHeightMod;
-	callback->WeaponDef_getAccuracy = &skirmishAiCallback_WeaponDef_getAccuracy;
-	callback->WeaponDef_getSprayAngle = &skirmishAiCallback_WeaponDef_getSprayAngle;
-	callback->WeaponDef_getMovingAccuracy = &skirmishAiCallback_WeaponDef_getMovingAccuracy;
-	callback->WeaponDef_getTargetMoveError = &skirmishAiCallback_WeaponDef_getTargetMoveError;
-	callback->WeaponDef_getLeadLimit = &skirmishAiCallback_WeaponDef_getLeadLimit;
-	callback->WeaponDef_getLeadBonus = &skirmishAiCallback_WeaponDef_getLeadBonus;
-	callback->WeaponDef_getPredictBoost = &skirmishAiCallback_WeaponDef_getPredictBoost;
-	callback->WeaponDef_getNumDamageTypes = &skirmishAiCallback_WeaponDef_getNumDamageTypes;
-	callback->WeaponDef_Damage_getParalyzeDamageTime = &skirmishAiCallback_WeaponDef_Damage_getParalyzeDamageTime;
-	callback->WeaponDef_Damage_getImpulseFactor = &skirmishAiCallback_WeaponDef_Damage_getImpulseFactor;
-	callback->WeaponDef_Damage_getImpulseBoost = &skirmishAiCallback_WeaponDef_Damage_getImpulseBoost;
-	callback->WeaponDef_Damage_getCraterMult = &skirmishAiCallback_WeaponDef_Damage_getCraterMult;
-	callback->WeaponDef_Damage_getCraterBoost = &skirmishAiCallback_WeaponDef_Damage_getCraterBoost;
-	callback->WeaponDef_Damage_getTypes = &skirmishAiCallback_WeaponDef_Damage_getTypes;
-	callback->WeaponDef_getAreaOfEffect = &skirmishAiCallback_WeaponDef_getAreaOfEffect;
-	callback->WeaponDef_isNoSelfDamage = &skirmishAiCallback_WeaponDef_isNoSelfDamage;
-	callback->WeaponDef_getFireStarter = &skirmishAiCallback_WeaponDef_getFireStarter;
-	callback->WeaponDef_getEdgeEffectiveness = &skirmishAiCallback_WeaponDef_getEdgeEffectiveness;
-	callback->WeaponDef_getSize = &skirmishAiCallback_WeaponDef_getSize;
-	callback->WeaponDef_getSizeGrowth = &skirmishAiCallback_WeaponDef_getSizeGrowth;
-	callback->WeaponDef_getCollisionSize = &skirmishAiCallback_WeaponDef_getCollisionSize;
-	callback->WeaponDef_getSalvoSize = &skirmishAiCallback_WeaponDef_getSalvoSize;
-	callback->WeaponDef_getSalvoDelay = &skirmishAiCallback_WeaponDef_getSalvoDelay;
-	callback->WeaponDef_getReload = &skirmishAiCallback_WeaponDef_getReload;
-	callback->WeaponDef_getBeamTime = &skirmishAiCallback_WeaponDef_getBeamTime;
-	callback->WeaponDef_isBeamBurst = &skirmishAiCallback_WeaponDef_isBeamBurst;
-	callback->WeaponDef_isWaterBounce = &skirmishAiCallback_WeaponDef_isWaterBounce;
-	callback->WeaponDef_isGroundBounce = &skirmishAiCallback_WeaponDef_isGroundBounce;
-	callback->WeaponDef_getBounceRebound = &skirmishAiCallback_WeaponDef_getBounceRebound;
-	callback->WeaponDef_getBounceSlip = &skirmishAiCallback_WeaponDef_getBounceSlip;
-	callback->WeaponDef_getNumBounce = &skirmishAiCallback_WeaponDef_getNumBounce;
-	callback->WeaponDef_getMaxAngle = &skirmishAiCallback_WeaponDef_getMaxAngle;
-	callback->WeaponDef_getUpTime = &skirmishAiCallback_WeaponDef_getUpTime;
-	callback->WeaponDef_getFlightTime = &skirmishAiCallback_WeaponDef_getFlightTime;
-	callback->WeaponDef_getCost = &skirmishAiCallback_WeaponDef_getCost;
-	callback->WeaponDef_getProjectilesPerShot = &skirmishAiCallback_WeaponDef_getProjectilesPerShot;
-	callback->WeaponDef_isTurret = &skirmishAiCallback_WeaponDef_isTurret;
-	callback->WeaponDef_isOnlyForward = &skirmishAiCallback_WeaponDef_isOnlyForward;
-	callback->WeaponDef_isFixedLauncher = &skirmishAiCallback_WeaponDef_isFixedLauncher;
-	callback->WeaponDef_isWaterWeapon = &skirmishAiCallback_WeaponDef_isWaterWeapon;
-	callback->WeaponDef_isFireSubmersed = &skirmishAiCallback_WeaponDef_isFireSubmersed;
-	callback->WeaponDef_isSubMissile = &skirmishAiCallback_WeaponDef_isSubMissile;
-	callback->WeaponDef_isTracks = &skirmishAiCallback_WeaponDef_isTracks;
-	callback->WeaponDef_isDropped = &skirmishAiCallback_WeaponDef_isDropped;
-	callback->WeaponDef_isParalyzer = &skirmishAiCallback_WeaponDef_isParalyzer;
-	callback->WeaponDef_isImpactOnly = &skirmishAiCallback_WeaponDef_isImpactOnly;
-	callback->WeaponDef_isNoAutoTarget = &skirmishAiCallback_WeaponDef_isNoAutoTarget;
-	callback->WeaponDef_isManualFire = &skirmishAiCallback_WeaponDef_isManualFire;
-	callback->WeaponDef_getInterceptor = &skirmishAiCallback_WeaponDef_getInterceptor;
-	callback->WeaponDef_getTargetable = &skirmishAiCallback_WeaponDef_getTargetable;
-	callback->WeaponDef_isStockpileable = &skirmishAiCallback_WeaponDef_isStockpileable;
-	callback->WeaponDef_getCoverageRange = &skirmishAiCallback_WeaponDef_getCoverageRange;
-	callback->WeaponDef_getStockpileTime = &skirmishAiCallback_WeaponDef_getStockpileTime;
-	callback->WeaponDef_getIntensity = &skirmishAiCallback_WeaponDef_getIntensity;
-	callback->WeaponDef_getDuration = &skirmishAiCallback_WeaponDef_getDuration;
-	callback->WeaponDef_getFalloffRate = &skirmishAiCallback_WeaponDef_getFalloffRate;
-	callback->WeaponDef_isSelfExplode = &skirmishAiCallback_WeaponDef_isSelfExplode;
-	callback->WeaponDef_isGravityAffected = &skirmishAiCallback_WeaponDef_isGravityAffected;
-	callback->WeaponDef_getHighTrajectory = &skirmishAiCallback_WeaponDef_getHighTrajectory;
-	callback->WeaponDef_getMyGravity = &skirmishAiCallback_WeaponDef_getMyGravity;
-	callback->WeaponDef_isNoExplode = &skirmishAiCallback_WeaponDef_isNoExplode;
-	callback->WeaponDef_getStartVelocity = &skirmishAiCallback_WeaponDef_getStartVelocity;
-	callback->WeaponDef_getWeaponAcceleration = &skirmishAiCallback_WeaponDef_getWeaponAcceleration;
-	callback->WeaponDef_getTurnRate = &skirmishAiCallback_WeaponDef_getTurnRate;
-	callback->WeaponDef_getMaxVelocity = &skirmishAiCallback_WeaponDef_getMaxVelocity;
-	callback->WeaponDef_getProjectileSpeed = &skirmishAiCallback_WeaponDef_getProjectileSpeed;
-	callback->WeaponDef_getExplosionSpeed = &skirmishAiCallback_WeaponDef_getExplosionSpeed;
-	callback->WeaponDef_getOnlyTargetCategory = &skirmishAiCallback_WeaponDef_getOnlyTargetCategory;
-	callback->WeaponDef_getWobble = &skirmishAiCallback_WeaponDef_getWobble;
-	callback->WeaponDef_getDance = &skirmishAiCallback_WeaponDef_getDance;
-	callback->WeaponDef_getTrajectoryHeight = &skirmishAiCallback_WeaponDef_getTrajectoryHeight;
-	callback->WeaponDef_isLargeBeamLaser = &skirmishAiCallback_WeaponDef_isLargeBeamLaser;
-	callback->WeaponDef_isShield = &skirmishAiCallback_WeaponDef_isShield;
-	callback->WeaponDef_isShieldRepulser = &skirmishAiCallback_WeaponDef_isShieldRepulser;
-	callback->WeaponDef_isSmartShield = &skirmishAiCallback_WeaponDef_isSmartShield;
-	callback->WeaponDef_isExteriorShield = &skirmishAiCallback_WeaponDef_isExteriorShield;
-	callback->WeaponDef_isVisibleShield = &skirmishAiCallback_WeaponDef_isVisibleShield;
-	callback->WeaponDef_isVisibleShieldRepulse = &skirmishAiCallback_WeaponDef_isVisibleShieldRepulse;
-	callback->WeaponDef_getVisibleShieldHitFrames = &skirmishAiCallback_WeaponDef_getVisibleShieldHitFrames;
-	callback->WeaponDef_Shield_getResourceUse = &skirmishAiCallback_WeaponDef_Shield_getResourceUse;
-	callback->WeaponDef_Shield_getRadius = &skirmishAiCallback_WeaponDef_Shield_getRadius;
-	callback->WeaponDef_Shield_getForce = &skirmishAiCallback_WeaponDef_Shield_getForce;
-	callback->WeaponDef_Shield_getMaxSpeed = &skirmishAiCallback_WeaponDef_Shield_getMaxSpeed;
-	callback->WeaponDef_Shield_getPower = &skirmishAiCallback_WeaponDef_Shield_getPower;
-	callback->WeaponDef_Shield_getPowerRegen = &skirmishAiCallback_WeaponDef_Shield_getPowerRegen;
-	callback->WeaponDef_Shield_getPowerRegenResource = &skirmishAiCallback_WeaponDef_Shield_getPowerRegenResource;
-	callback->WeaponDef_Shield_getStartingPower = &skirmishAiCallback_WeaponDef_Shield_getStartingPower;
-	callback->WeaponDef_Shield_getRechargeDelay = &skirmishAiCallback_WeaponDef_Shield_getRechargeDelay;
-	callback->WeaponDef_Shield_getInterceptType = &skirmishAiCallback_WeaponDef_Shield_getInterceptType;
-	callback->WeaponDef_getInterceptedByShieldType = &skirmishAiCallback_WeaponDef_getInterceptedByShieldType;
-	callback->WeaponDef_isAvoidFriendly = &skirmishAiCallback_WeaponDef_isAvoidFriendly;
-	callback->WeaponDef_isAvoidFeature = &skirmishAiCallback_WeaponDef_isAvoidFeature;
-	callback->WeaponDef_isAvoidNeutral = &skirmishAiCallback_WeaponDef_isAvoidNeutral;
-	callback->WeaponDef_getTargetBorder = &skirmishAiCallback_WeaponDef_getTargetBorder;
-	callback->WeaponDef_getCylinderTargetting = &skirmishAiCallback_WeaponDef_getCylinderTargetting;
-	callback->WeaponDef_getMinIntensity = &skirmishAiCallback_WeaponDef_getMinIntensity;
-	callback->WeaponDef_getHeightBoostFactor = &skirmishAiCallback_WeaponDef_getHeightBoostFactor;
-	callback->WeaponDef_getProximityPriority = &skirmishAiCallback_WeaponDef_getProximityPriority;
-	callback->WeaponDef_getCollisionFlags = &skirmishAiCallback_WeaponDef_getCollisionFlags;
-	callback->WeaponDef_isSweepFire = &skirmishAiCallback_WeaponDef_isSweepFire;
-	callback->WeaponDef_isAbleToAttackGround = &skirmishAiCallback_WeaponDef_isAbleToAttackGround;
-	callback->WeaponDef_getCameraShake = &skirmishAiCallback_WeaponDef_getCameraShake;
-	callback->WeaponDef_getDynDamageExp = &skirmishAiCallback_WeaponDef_getDynDamageExp;
-	callback->WeaponDef_getDynDamageMin = &skirmishAiCallback_WeaponDef_getDynDamageMin;
-	callback->WeaponDef_getDynDamageRange = &skirmishAiCallback_WeaponDef_getDynDamageRange;
-	callback->WeaponDef_isDynDamageInverted = &skirmishAiCallback_WeaponDef_isDynDamageInverted;
-	callback->WeaponDef_getCustomParams = &skirmishAiCallback_WeaponDef_getCustomParams;
-	callback->Unit_Weapon_getDef = &skirmishAiCallback_Unit_Weapon_getDef;
-	callback->Unit_Weapon_getReloadFrame = &skirmishAiCallback_Unit_Weapon_getReloadFrame;
-	callback->Unit_Weapon_getReloadTime = &skirmishAiCallback_Unit_Weapon_getReloadTime;
-	callback->Unit_Weapon_getRange = &skirmishAiCallback_Unit_Weapon_getRange;
-	callback->Unit_Weapon_isShieldEnabled = &skirmishAiCallback_Unit_Weapon_isShieldEnabled;
-	callback->Unit_Weapon_getShieldPower = &skirmishAiCallback_Unit_Weapon_getShieldPower;
-	callback->Debug_GraphDrawer_isEnabled = &skirmishAiCallback_Debug_GraphDrawer_isEnabled;
+	callback->Engine_handleCommand = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_handleCommand);
+	callback->Engine_executeCommand = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_executeCommand);
+
+	callback->Engine_Version_getMajor = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_getMajor);
+	callback->Engine_Version_getMinor = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_getMinor);
+	callback->Engine_Version_getPatchset = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_getPatchset);
+	callback->Engine_Version_getCommits = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_getCommits);
+	callback->Engine_Version_getHash = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_getHash);
+	callback->Engine_Version_getBranch = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_getBranch);
+	callback->Engine_Version_getAdditional = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_getAdditional);
+	callback->Engine_Version_getBuildTime = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_getBuildTime);
+	callback->Engine_Version_isRelease = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_isRelease);
+	callback->Engine_Version_getNormal = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_getNormal);
+	callback->Engine_Version_getSync = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_getSync);
+	callback->Engine_Version_getFull = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_Version_getFull);
+	callback->getNumTeams = AI_CALLBACK_FUNC(skirmishAiCallback_getNumTeams);
+	callback->getNumSkirmishAIs = AI_CALLBACK_FUNC(skirmishAiCallback_getNumSkirmishAIs);
+	callback->getMaxSkirmishAIs = AI_CALLBACK_FUNC(skirmishAiCallback_getMaxSkirmishAIs);
+	callback->SkirmishAI_getTeamId = AI_CALLBACK_FUNC(skirmishAiCallback_SkirmishAI_getTeamId);
+	callback->SkirmishAI_Info_getSize = AI_CALLBACK_FUNC(skirmishAiCallback_SkirmishAI_Info_getSize);
+	callback->SkirmishAI_Info_getKey = AI_CALLBACK_FUNC(skirmishAiCallback_SkirmishAI_Info_getKey);
+	callback->SkirmishAI_Info_getValue = AI_CALLBACK_FUNC(skirmishAiCallback_SkirmishAI_Info_getValue);
+	callback->SkirmishAI_Info_getDescription = AI_CALLBACK_FUNC(skirmishAiCallback_SkirmishAI_Info_getDescription);
+	callback->SkirmishAI_Info_getValueByKey = AI_CALLBACK_FUNC(skirmishAiCallback_SkirmishAI_Info_getValueByKey);
+	callback->SkirmishAI_OptionValues_getSize = AI_CALLBACK_FUNC(skirmishAiCallback_SkirmishAI_OptionValues_getSize);
+	callback->SkirmishAI_OptionValues_getKey = AI_CALLBACK_FUNC(skirmishAiCallback_SkirmishAI_OptionValues_getKey);
+	callback->SkirmishAI_OptionValues_getValue = AI_CALLBACK_FUNC(skirmishAiCallback_SkirmishAI_OptionValues_getValue);
+	callback->SkirmishAI_OptionValues_getValueByKey = AI_CALLBACK_FUNC(skirmishAiCallback_SkirmishAI_OptionValues_getValueByKey);
+	callback->Log_log = AI_CALLBACK_FUNC(skirmishAiCallback_Log_log);
+	callback->Log_exception = AI_CALLBACK_FUNC(skirmishAiCallback_Log_exception);
+	callback->DataDirs_getPathSeparator = AI_CALLBACK_FUNC(skirmishAiCallback_DataDirs_getPathSeparator);
+	callback->DataDirs_getConfigDir = AI_CALLBACK_FUNC(skirmishAiCallback_DataDirs_getConfigDir);
+	callback->DataDirs_getWriteableDir = AI_CALLBACK_FUNC(skirmishAiCallback_DataDirs_getWriteableDir);
+	callback->DataDirs_locatePath = AI_CALLBACK_FUNC(skirmishAiCallback_DataDirs_locatePath);
+	callback->DataDirs_Roots_getSize = AI_CALLBACK_FUNC(skirmishAiCallback_DataDirs_Roots_getSize);
+	callback->DataDirs_Roots_getDir = AI_CALLBACK_FUNC(skirmishAiCallback_DataDirs_Roots_getDir);
+	callback->DataDirs_Roots_locatePath = AI_CALLBACK_FUNC(skirmishAiCallback_DataDirs_Roots_locatePath);
+	callback->Game_getCurrentFrame = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getCurrentFrame);
+	callback->Game_getAiInterfaceVersion = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getAiInterfaceVersion);
+	callback->Game_getMyTeam = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getMyTeam);
+	callback->Game_getMyAllyTeam = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getMyAllyTeam);
+	callback->Game_getPlayerTeam = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getPlayerTeam);
+	callback->Game_getTeams = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeams);
+	callback->Game_getTeamSide = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamSide);
+	callback->Game_getTeamColor = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamColor);
+	callback->Game_getTeamIncomeMultiplier = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamIncomeMultiplier);
+	callback->Game_getTeamAllyTeam = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamAllyTeam);
+	callback->Game_getTeamResourceCurrent = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamResourceCurrent);
+	callback->Game_getTeamResourceIncome = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamResourceIncome);
+	callback->Game_getTeamResourceUsage = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamResourceUsage);
+	callback->Game_getTeamResourceStorage = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamResourceStorage);
+	callback->Game_getTeamResourcePull = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamResourcePull);
+	callback->Game_getTeamResourceShare = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamResourceShare);
+	callback->Game_getTeamResourceSent = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamResourceSent);
+	callback->Game_getTeamResourceReceived = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamResourceReceived);
+	callback->Game_getTeamResourceExcess = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getTeamResourceExcess);
+	callback->Game_isAllied = AI_CALLBACK_FUNC(skirmishAiCallback_Game_isAllied);
+	callback->Game_isDebugModeEnabled = AI_CALLBACK_FUNC(skirmishAiCallback_Game_isDebugModeEnabled);
+	callback->Game_isPaused = AI_CALLBACK_FUNC(skirmishAiCallback_Game_isPaused);
+	callback->Game_getSpeedFactor = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getSpeedFactor);
+	callback->Game_getSetupScript = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getSetupScript);
+	callback->Game_getCategoryFlag = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getCategoryFlag);
+	callback->Game_getCategoriesFlag = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getCategoriesFlag);
+	callback->Game_getCategoryName = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getCategoryName);
+	callback->Game_getRulesParamFloat = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getRulesParamFloat);
+	callback->Game_getRulesParamString = AI_CALLBACK_FUNC(skirmishAiCallback_Game_getRulesParamString);
+	callback->Cheats_isEnabled = AI_CALLBACK_FUNC(skirmishAiCallback_Cheats_isEnabled);
+	callback->Cheats_setEnabled = AI_CALLBACK_FUNC(skirmishAiCallback_Cheats_setEnabled);
+	callback->Cheats_setEventsEnabled = AI_CALLBACK_FUNC(skirmishAiCallback_Cheats_setEventsEnabled);
+	callback->Cheats_isOnlyPassive = AI_CALLBACK_FUNC(skirmishAiCallback_Cheats_isOnlyPassive);
+	callback->getResources = AI_CALLBACK_FUNC(skirmishAiCallback_getResources);
+	callback->getResourceByName = AI_CALLBACK_FUNC(skirmishAiCallback_getResourceByName);
+	callback->Resource_getName = AI_CALLBACK_FUNC(skirmishAiCallback_Resource_getName);
+	callback->Resource_getOptimum = AI_CALLBACK_FUNC(skirmishAiCallback_Resource_getOptimum);
+	callback->Economy_getCurrent = AI_CALLBACK_FUNC(skirmishAiCallback_Economy_getCurrent);
+	callback->Economy_getIncome = AI_CALLBACK_FUNC(skirmishAiCallback_Economy_getIncome);
+	callback->Economy_getUsage = AI_CALLBACK_FUNC(skirmishAiCallback_Economy_getUsage);
+	callback->Economy_getStorage = AI_CALLBACK_FUNC(skirmishAiCallback_Economy_getStorage);
+	callback->Economy_getPull = AI_CALLBACK_FUNC(skirmishAiCallback_Economy_getPull);
+	callback->Economy_getShare = AI_CALLBACK_FUNC(skirmishAiCallback_Economy_getShare);
+	callback->Economy_getSent = AI_CALLBACK_FUNC(skirmishAiCallback_Economy_getSent);
+	callback->Economy_getReceived = AI_CALLBACK_FUNC(skirmishAiCallback_Economy_getReceived);
+	callback->Economy_getExcess = AI_CALLBACK_FUNC(skirmishAiCallback_Economy_getExcess);
+	callback->File_getSize = AI_CALLBACK_FUNC(skirmishAiCallback_File_getSize);
+	callback->File_getContent = AI_CALLBACK_FUNC(skirmishAiCallback_File_getContent);
+	callback->getUnitDefs = AI_CALLBACK_FUNC(skirmishAiCallback_getUnitDefs);
+	callback->getUnitDefByName = AI_CALLBACK_FUNC(skirmishAiCallback_getUnitDefByName);
+	callback->UnitDef_getHeight = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getHeight);
+	callback->UnitDef_getRadius = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getRadius);
+	callback->UnitDef_getName = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getName);
+	callback->UnitDef_getHumanName = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getHumanName);
+	callback->UnitDef_getUpkeep = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getUpkeep);
+	callback->UnitDef_getResourceMake = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getResourceMake);
+	callback->UnitDef_getMakesResource = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMakesResource);
+	callback->UnitDef_getCost = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getCost);
+	callback->UnitDef_getExtractsResource = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getExtractsResource);
+	callback->UnitDef_getResourceExtractorRange = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getResourceExtractorRange);
+	callback->UnitDef_getWindResourceGenerator = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getWindResourceGenerator);
+	callback->UnitDef_getTidalResourceGenerator = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getTidalResourceGenerator);
+	callback->UnitDef_getStorage = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getStorage);
+	callback->UnitDef_getBuildTime = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getBuildTime);
+	callback->UnitDef_getAutoHeal = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getAutoHeal);
+	callback->UnitDef_getIdleAutoHeal = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getIdleAutoHeal);
+	callback->UnitDef_getIdleTime = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getIdleTime);
+	callback->UnitDef_getPower = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getPower);
+	callback->UnitDef_getHealth = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getHealth);
+	callback->UnitDef_getCategory = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getCategory);
+	callback->UnitDef_getSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getSpeed);
+	callback->UnitDef_getTurnRate = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getTurnRate);
+	callback->UnitDef_isTurnInPlace = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isTurnInPlace);
+	callback->UnitDef_getTurnInPlaceDistance = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getTurnInPlaceDistance);
+	callback->UnitDef_getTurnInPlaceSpeedLimit = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getTurnInPlaceSpeedLimit);
+	callback->UnitDef_isUpright = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isUpright);
+	callback->UnitDef_isCollide = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isCollide);
+	callback->UnitDef_getLosRadius = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getLosRadius);
+	callback->UnitDef_getAirLosRadius = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getAirLosRadius);
+	callback->UnitDef_getLosHeight = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getLosHeight);
+	callback->UnitDef_getRadarRadius = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getRadarRadius);
+	callback->UnitDef_getSonarRadius = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getSonarRadius);
+	callback->UnitDef_getJammerRadius = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getJammerRadius);
+	callback->UnitDef_getSonarJamRadius = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getSonarJamRadius);
+	callback->UnitDef_getSeismicRadius = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getSeismicRadius);
+	callback->UnitDef_getSeismicSignature = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getSeismicSignature);
+	callback->UnitDef_isStealth = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isStealth);
+	callback->UnitDef_isSonarStealth = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isSonarStealth);
+	callback->UnitDef_isBuildRange3D = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isBuildRange3D);
+	callback->UnitDef_getBuildDistance = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getBuildDistance);
+	callback->UnitDef_getBuildSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getBuildSpeed);
+	callback->UnitDef_getReclaimSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getReclaimSpeed);
+	callback->UnitDef_getRepairSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getRepairSpeed);
+	callback->UnitDef_getMaxRepairSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxRepairSpeed);
+	callback->UnitDef_getResurrectSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getResurrectSpeed);
+	callback->UnitDef_getCaptureSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getCaptureSpeed);
+	callback->UnitDef_getTerraformSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getTerraformSpeed);
+	callback->UnitDef_getUpDirSmoothing = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getUpDirSmoothing);
+	callback->UnitDef_getMass = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMass);
+	callback->UnitDef_isPushResistant = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isPushResistant);
+	callback->UnitDef_isStrafeToAttack = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isStrafeToAttack);
+	callback->UnitDef_getMinCollisionSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMinCollisionSpeed);
+	callback->UnitDef_getSlideTolerance = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getSlideTolerance);
+	callback->UnitDef_getMaxHeightDif = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxHeightDif);
+	callback->UnitDef_getMinWaterDepth = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMinWaterDepth);
+	callback->UnitDef_getWaterline = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getWaterline);
+	callback->UnitDef_getMaxWaterDepth = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxWaterDepth);
+	callback->UnitDef_getArmoredMultiple = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getArmoredMultiple);
+	callback->UnitDef_getArmorType = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getArmorType);
+	callback->UnitDef_FlankingBonus_getMode = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_FlankingBonus_getMode);
+	callback->UnitDef_FlankingBonus_getDir = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_FlankingBonus_getDir);
+	callback->UnitDef_FlankingBonus_getMax = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_FlankingBonus_getMax);
+	callback->UnitDef_FlankingBonus_getMin = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_FlankingBonus_getMin);
+	callback->UnitDef_FlankingBonus_getMobilityAdd = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_FlankingBonus_getMobilityAdd);
+	callback->UnitDef_getMaxWeaponRange = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxWeaponRange);
+	callback->UnitDef_getTooltip = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getTooltip);
+	callback->UnitDef_getWreckName = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getWreckName);
+	callback->UnitDef_getDeathExplosion = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getDeathExplosion);
+	callback->UnitDef_getSelfDExplosion = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getSelfDExplosion);
+	callback->UnitDef_getCategoryString = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getCategoryString);
+	callback->UnitDef_isAbleToSelfD = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToSelfD);
+	callback->UnitDef_getSelfDCountdown = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getSelfDCountdown);
+	callback->UnitDef_isAbleToSubmerge = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToSubmerge);
+	callback->UnitDef_isAbleToFly = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToFly);
+	callback->UnitDef_isAbleToMove = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToMove);
+	callback->UnitDef_isAbleToHover = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToHover);
+	callback->UnitDef_isFloater = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isFloater);
+	callback->UnitDef_isBuilder = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isBuilder);
+	callback->UnitDef_isActivateWhenBuilt = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isActivateWhenBuilt);
+	callback->UnitDef_isOnOffable = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isOnOffable);
+	callback->UnitDef_isFullHealthFactory = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isFullHealthFactory);
+	callback->UnitDef_isFactoryHeadingTakeoff = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isFactoryHeadingTakeoff);
+	callback->UnitDef_isReclaimable = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isReclaimable);
+	callback->UnitDef_isCapturable = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isCapturable);
+	callback->UnitDef_isAbleToRestore = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToRestore);
+	callback->UnitDef_isAbleToRepair = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToRepair);
+	callback->UnitDef_isAbleToSelfRepair = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToSelfRepair);
+	callback->UnitDef_isAbleToReclaim = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToReclaim);
+	callback->UnitDef_isAbleToAttack = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToAttack);
+	callback->UnitDef_isAbleToPatrol = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToPatrol);
+	callback->UnitDef_isAbleToFight = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToFight);
+	callback->UnitDef_isAbleToGuard = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToGuard);
+	callback->UnitDef_isAbleToAssist = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToAssist);
+	callback->UnitDef_isAssistable = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAssistable);
+	callback->UnitDef_isAbleToRepeat = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToRepeat);
+	callback->UnitDef_isAbleToFireControl = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToFireControl);
+	callback->UnitDef_getFireState = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getFireState);
+	callback->UnitDef_getMoveState = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMoveState);
+	callback->UnitDef_getWingDrag = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getWingDrag);
+	callback->UnitDef_getWingAngle = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getWingAngle);
+	callback->UnitDef_getFrontToSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getFrontToSpeed);
+	callback->UnitDef_getSpeedToFront = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getSpeedToFront);
+	callback->UnitDef_getMyGravity = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMyGravity);
+	callback->UnitDef_getMaxBank = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxBank);
+	callback->UnitDef_getMaxPitch = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxPitch);
+	callback->UnitDef_getTurnRadius = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getTurnRadius);
+	callback->UnitDef_getWantedHeight = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getWantedHeight);
+	callback->UnitDef_getVerticalSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getVerticalSpeed);
+
+	callback->UnitDef_isHoverAttack = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isHoverAttack);
+	callback->UnitDef_isAirStrafe = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAirStrafe);
+
+	callback->UnitDef_getDlHoverFactor = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getDlHoverFactor);
+	callback->UnitDef_getMaxAcceleration = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxAcceleration);
+	callback->UnitDef_getMaxDeceleration = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxDeceleration);
+	callback->UnitDef_getMaxAileron = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxAileron);
+	callback->UnitDef_getMaxElevator = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxElevator);
+	callback->UnitDef_getMaxRudder = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxRudder);
+	callback->UnitDef_getYardMap = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getYardMap);
+	callback->UnitDef_getXSize = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getXSize);
+	callback->UnitDef_getZSize = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getZSize);
+	callback->UnitDef_getLoadingRadius = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getLoadingRadius);
+	callback->UnitDef_getUnloadSpread = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getUnloadSpread);
+	callback->UnitDef_getTransportCapacity = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getTransportCapacity);
+	callback->UnitDef_getTransportSize = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getTransportSize);
+	callback->UnitDef_getMinTransportSize = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMinTransportSize);
+	callback->UnitDef_isAirBase = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAirBase);
+	callback->UnitDef_isFirePlatform = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isFirePlatform);
+	callback->UnitDef_getTransportMass = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getTransportMass);
+	callback->UnitDef_getMinTransportMass = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMinTransportMass);
+	callback->UnitDef_isHoldSteady = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isHoldSteady);
+	callback->UnitDef_isReleaseHeld = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isReleaseHeld);
+	callback->UnitDef_isNotTransportable = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isNotTransportable);
+	callback->UnitDef_isTransportByEnemy = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isTransportByEnemy);
+	callback->UnitDef_getTransportUnloadMethod = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getTransportUnloadMethod);
+	callback->UnitDef_getFallSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getFallSpeed);
+	callback->UnitDef_getUnitFallSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getUnitFallSpeed);
+	callback->UnitDef_isAbleToCloak = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToCloak);
+	callback->UnitDef_isStartCloaked = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isStartCloaked);
+	callback->UnitDef_getCloakCost = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getCloakCost);
+	callback->UnitDef_getCloakCostMoving = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getCloakCostMoving);
+	callback->UnitDef_getDecloakDistance = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getDecloakDistance);
+	callback->UnitDef_isDecloakSpherical = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isDecloakSpherical);
+	callback->UnitDef_isDecloakOnFire = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isDecloakOnFire);
+	callback->UnitDef_isAbleToKamikaze = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToKamikaze);
+	callback->UnitDef_getKamikazeDist = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getKamikazeDist);
+	callback->UnitDef_isTargetingFacility = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isTargetingFacility);
+	callback->UnitDef_canManualFire = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_canManualFire);
+	callback->UnitDef_isNeedGeo = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isNeedGeo);
+	callback->UnitDef_isFeature = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isFeature);
+	callback->UnitDef_isHideDamage = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isHideDamage);
+	callback->UnitDef_isShowPlayerName = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isShowPlayerName);
+	callback->UnitDef_isAbleToResurrect = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToResurrect);
+	callback->UnitDef_isAbleToCapture = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToCapture);
+	callback->UnitDef_getHighTrajectoryType = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getHighTrajectoryType);
+	callback->UnitDef_getNoChaseCategory = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getNoChaseCategory);
+	callback->UnitDef_isAbleToDropFlare = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToDropFlare);
+	callback->UnitDef_getFlareReloadTime = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getFlareReloadTime);
+	callback->UnitDef_getFlareEfficiency = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getFlareEfficiency);
+	callback->UnitDef_getFlareDelay = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getFlareDelay);
+	callback->UnitDef_getFlareDropVector = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getFlareDropVector);
+	callback->UnitDef_getFlareTime = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getFlareTime);
+	callback->UnitDef_getFlareSalvoSize = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getFlareSalvoSize);
+	callback->UnitDef_getFlareSalvoDelay = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getFlareSalvoDelay);
+	callback->UnitDef_isAbleToLoopbackAttack = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isAbleToLoopbackAttack);
+	callback->UnitDef_isLevelGround = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isLevelGround);
+	callback->UnitDef_getMaxThisUnit = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getMaxThisUnit);
+	callback->UnitDef_getDecoyDef = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getDecoyDef);
+	callback->UnitDef_isDontLand = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isDontLand);
+	callback->UnitDef_getShieldDef = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getShieldDef);
+	callback->UnitDef_getStockpileDef = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getStockpileDef);
+	callback->UnitDef_getBuildOptions = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getBuildOptions);
+	callback->UnitDef_getCustomParams = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getCustomParams);
+	callback->UnitDef_isMoveDataAvailable = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_isMoveDataAvailable);
+	callback->UnitDef_MoveData_getXSize = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getXSize);
+	callback->UnitDef_MoveData_getZSize = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getZSize);
+	callback->UnitDef_MoveData_getDepth = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getDepth);
+	callback->UnitDef_MoveData_getMaxSlope = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getMaxSlope);
+	callback->UnitDef_MoveData_getSlopeMod = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getSlopeMod);
+	callback->UnitDef_MoveData_getDepthMod = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getDepthMod);
+	callback->UnitDef_MoveData_getPathType = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getPathType);
+	callback->UnitDef_MoveData_getCrushStrength = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getCrushStrength);
+	callback->UnitDef_MoveData_getSpeedModClass = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getSpeedModClass);
+	callback->UnitDef_MoveData_getTerrainClass = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getTerrainClass);
+	callback->UnitDef_MoveData_getFollowGround = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getFollowGround);
+	callback->UnitDef_MoveData_isSubMarine = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_isSubMarine);
+	callback->UnitDef_MoveData_getName = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_MoveData_getName);
+	callback->UnitDef_getWeaponMounts = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_getWeaponMounts);
+	callback->UnitDef_WeaponMount_getName = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_WeaponMount_getName);
+	callback->UnitDef_WeaponMount_getWeaponDef = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_WeaponMount_getWeaponDef);
+	callback->UnitDef_WeaponMount_getSlavedTo = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_WeaponMount_getSlavedTo);
+	callback->UnitDef_WeaponMount_getMainDir = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_WeaponMount_getMainDir);
+	callback->UnitDef_WeaponMount_getMaxAngleDif = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_WeaponMount_getMaxAngleDif);
+	callback->UnitDef_WeaponMount_getBadTargetCategory = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_WeaponMount_getBadTargetCategory);
+	callback->UnitDef_WeaponMount_getOnlyTargetCategory = AI_CALLBACK_FUNC(skirmishAiCallback_UnitDef_WeaponMount_getOnlyTargetCategory);
+	callback->Unit_getLimit = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getLimit);
+	callback->Unit_getMax = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getMax);
+	callback->getEnemyUnits = AI_CALLBACK_FUNC(skirmishAiCallback_getEnemyUnits);
+	callback->getEnemyUnitsIn = AI_CALLBACK_FUNC(skirmishAiCallback_getEnemyUnitsIn);
+	callback->getEnemyUnitsInRadarAndLos = AI_CALLBACK_FUNC(skirmishAiCallback_getEnemyUnitsInRadarAndLos);
+	callback->getFriendlyUnits = AI_CALLBACK_FUNC(skirmishAiCallback_getFriendlyUnits);
+	callback->getFriendlyUnitsIn = AI_CALLBACK_FUNC(skirmishAiCallback_getFriendlyUnitsIn);
+	callback->getNeutralUnits = AI_CALLBACK_FUNC(skirmishAiCallback_getNeutralUnits);
+	callback->getNeutralUnitsIn = AI_CALLBACK_FUNC(skirmishAiCallback_getNeutralUnitsIn);
+	callback->getTeamUnits = AI_CALLBACK_FUNC(skirmishAiCallback_getTeamUnits);
+	callback->getSelectedUnits = AI_CALLBACK_FUNC(skirmishAiCallback_getSelectedUnits);
+	callback->Unit_getDef = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getDef);
+	callback->Unit_getRulesParamFloat = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getRulesParamFloat);
+	callback->Unit_getRulesParamString = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getRulesParamString);
+	callback->Unit_getTeam = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getTeam);
+	callback->Unit_getAllyTeam = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getAllyTeam);
+	callback->Unit_getStockpile = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getStockpile);
+	callback->Unit_getStockpileQueued = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getStockpileQueued);
+	callback->Unit_getMaxSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getMaxSpeed);
+	callback->Unit_getMaxRange = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getMaxRange);
+	callback->Unit_getMaxHealth = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getMaxHealth);
+	callback->Unit_getExperience = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getExperience);
+	callback->Unit_getGroup = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getGroup);
+	callback->Unit_getCurrentCommands = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getCurrentCommands);
+	callback->Unit_CurrentCommand_getType = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_CurrentCommand_getType);
+	callback->Unit_CurrentCommand_getId = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_CurrentCommand_getId);
+	callback->Unit_CurrentCommand_getOptions = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_CurrentCommand_getOptions);
+	callback->Unit_CurrentCommand_getTag = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_CurrentCommand_getTag);
+	callback->Unit_CurrentCommand_getTimeOut = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_CurrentCommand_getTimeOut);
+	callback->Unit_CurrentCommand_getParams = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_CurrentCommand_getParams);
+	callback->Unit_getSupportedCommands = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getSupportedCommands);
+	callback->Unit_SupportedCommand_getId = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_SupportedCommand_getId);
+	callback->Unit_SupportedCommand_getName = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_SupportedCommand_getName);
+	callback->Unit_SupportedCommand_getToolTip = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_SupportedCommand_getToolTip);
+	callback->Unit_SupportedCommand_isShowUnique = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_SupportedCommand_isShowUnique);
+	callback->Unit_SupportedCommand_isDisabled = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_SupportedCommand_isDisabled);
+	callback->Unit_SupportedCommand_getParams = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_SupportedCommand_getParams);
+	callback->Unit_getHealth = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getHealth);
+	callback->Unit_getParalyzeDamage = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getParalyzeDamage);
+	callback->Unit_getCaptureProgress = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getCaptureProgress);
+	callback->Unit_getBuildProgress = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getBuildProgress);
+	callback->Unit_getSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getSpeed);
+	callback->Unit_getPower = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getPower);
+	callback->Unit_getResourceUse = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getResourceUse);
+	callback->Unit_getResourceMake = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getResourceMake);
+	callback->Unit_getPos = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getPos);
+	callback->Unit_getVel = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getVel);
+	callback->Unit_isActivated = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_isActivated);
+	callback->Unit_isBeingBuilt = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_isBeingBuilt);
+	callback->Unit_isCloaked = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_isCloaked);
+	callback->Unit_isParalyzed = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_isParalyzed);
+	callback->Unit_isNeutral = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_isNeutral);
+	callback->Unit_getBuildingFacing = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getBuildingFacing);
+	callback->Unit_getLastUserOrderFrame = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getLastUserOrderFrame);
+	callback->Unit_getWeapons = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getWeapons);
+	callback->Unit_getWeapon = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_getWeapon);
+	callback->Team_hasAIController = AI_CALLBACK_FUNC(skirmishAiCallback_Team_hasAIController);
+	callback->getEnemyTeams = AI_CALLBACK_FUNC(skirmishAiCallback_getEnemyTeams);
+	callback->getAlliedTeams = AI_CALLBACK_FUNC(skirmishAiCallback_getAlliedTeams);
+	callback->Team_getRulesParamFloat = AI_CALLBACK_FUNC(skirmishAiCallback_Team_getRulesParamFloat);
+	callback->Team_getRulesParamString = AI_CALLBACK_FUNC(skirmishAiCallback_Team_getRulesParamString);
+	callback->getGroups = AI_CALLBACK_FUNC(skirmishAiCallback_getGroups);
+	callback->Group_getSupportedCommands = AI_CALLBACK_FUNC(skirmishAiCallback_Group_getSupportedCommands);
+	callback->Group_SupportedCommand_getId = AI_CALLBACK_FUNC(skirmishAiCallback_Group_SupportedCommand_getId);
+	callback->Group_SupportedCommand_getName = AI_CALLBACK_FUNC(skirmishAiCallback_Group_SupportedCommand_getName);
+	callback->Group_SupportedCommand_getToolTip = AI_CALLBACK_FUNC(skirmishAiCallback_Group_SupportedCommand_getToolTip);
+	callback->Group_SupportedCommand_isShowUnique = AI_CALLBACK_FUNC(skirmishAiCallback_Group_SupportedCommand_isShowUnique);
+	callback->Group_SupportedCommand_isDisabled = AI_CALLBACK_FUNC(skirmishAiCallback_Group_SupportedCommand_isDisabled);
+	callback->Group_SupportedCommand_getParams = AI_CALLBACK_FUNC(skirmishAiCallback_Group_SupportedCommand_getParams);
+	callback->Group_OrderPreview_getId = AI_CALLBACK_FUNC(skirmishAiCallback_Group_OrderPreview_getId);
+	callback->Group_OrderPreview_getOptions = AI_CALLBACK_FUNC(skirmishAiCallback_Group_OrderPreview_getOptions);
+	callback->Group_OrderPreview_getTag = AI_CALLBACK_FUNC(skirmishAiCallback_Group_OrderPreview_getTag);
+	callback->Group_OrderPreview_getTimeOut = AI_CALLBACK_FUNC(skirmishAiCallback_Group_OrderPreview_getTimeOut);
+	callback->Group_OrderPreview_getParams = AI_CALLBACK_FUNC(skirmishAiCallback_Group_OrderPreview_getParams);
+	callback->Group_isSelected = AI_CALLBACK_FUNC(skirmishAiCallback_Group_isSelected);
+	callback->Mod_getFileName = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getFileName);
+	callback->Mod_getHash = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getHash);
+	callback->Mod_getHumanName = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getHumanName);
+	callback->Mod_getShortName = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getShortName);
+	callback->Mod_getVersion = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getVersion);
+	callback->Mod_getMutator = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getMutator);
+	callback->Mod_getDescription = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getDescription);
+	callback->Mod_getConstructionDecay = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getConstructionDecay);
+	callback->Mod_getConstructionDecayTime = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getConstructionDecayTime);
+	callback->Mod_getConstructionDecaySpeed = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getConstructionDecaySpeed);
+	callback->Mod_getMultiReclaim = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getMultiReclaim);
+	callback->Mod_getReclaimMethod = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getReclaimMethod);
+	callback->Mod_getReclaimUnitMethod = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getReclaimUnitMethod);
+	callback->Mod_getReclaimUnitEnergyCostFactor = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getReclaimUnitEnergyCostFactor);
+	callback->Mod_getReclaimUnitEfficiency = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getReclaimUnitEfficiency);
+	callback->Mod_getReclaimFeatureEnergyCostFactor = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getReclaimFeatureEnergyCostFactor);
+	callback->Mod_getReclaimAllowEnemies = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getReclaimAllowEnemies);
+	callback->Mod_getReclaimAllowAllies = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getReclaimAllowAllies);
+	callback->Mod_getRepairEnergyCostFactor = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getRepairEnergyCostFactor);
+	callback->Mod_getResurrectEnergyCostFactor = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getResurrectEnergyCostFactor);
+	callback->Mod_getCaptureEnergyCostFactor = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getCaptureEnergyCostFactor);
+	callback->Mod_getTransportGround = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getTransportGround);
+	callback->Mod_getTransportHover = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getTransportHover);
+	callback->Mod_getTransportShip = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getTransportShip);
+	callback->Mod_getTransportAir = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getTransportAir);
+	callback->Mod_getFireAtKilled = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getFireAtKilled);
+	callback->Mod_getFireAtCrashing = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getFireAtCrashing);
+	callback->Mod_getFlankingBonusModeDefault = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getFlankingBonusModeDefault);
+	callback->Mod_getLosMipLevel = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getLosMipLevel);
+	callback->Mod_getAirMipLevel = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getAirMipLevel);
+	callback->Mod_getRadarMipLevel = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getRadarMipLevel);
+	callback->Mod_getRequireSonarUnderWater = AI_CALLBACK_FUNC(skirmishAiCallback_Mod_getRequireSonarUnderWater);
+	callback->Map_getChecksum = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getChecksum);
+	callback->Map_getStartPos = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getStartPos);
+	callback->Map_getMousePos = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getMousePos);
+	callback->Map_isPosInCamera = AI_CALLBACK_FUNC(skirmishAiCallback_Map_isPosInCamera);
+	callback->Map_getWidth = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getWidth);
+	callback->Map_getHeight = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getHeight);
+	callback->Map_getHeightMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getHeightMap);
+	callback->Map_getCornersHeightMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getCornersHeightMap);
+	callback->Map_getMinHeight = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getMinHeight);
+	callback->Map_getMaxHeight = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getMaxHeight);
+	callback->Map_getSlopeMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getSlopeMap);
+	callback->Map_getLosMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getLosMap);
+	callback->Map_getAirLosMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getAirLosMap);
+	callback->Map_getRadarMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getRadarMap);
+	callback->Map_getSonarMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getSonarMap);
+	callback->Map_getSeismicMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getSeismicMap);
+	callback->Map_getJammerMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getJammerMap);
+	callback->Map_getSonarJammerMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getSonarJammerMap);
+	callback->Map_getResourceMapRaw = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getResourceMapRaw);
+	callback->Map_getResourceMapSpotsPositions = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getResourceMapSpotsPositions);
+	callback->Map_getResourceMapSpotsAverageIncome = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getResourceMapSpotsAverageIncome);
+	callback->Map_getResourceMapSpotsNearest = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getResourceMapSpotsNearest);
+	callback->Map_getHash = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getHash);
+	callback->Map_getName = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getName);
+	callback->Map_getHumanName = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getHumanName);
+	callback->Map_getElevationAt = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getElevationAt);
+	callback->Map_getMaxResource = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getMaxResource);
+	callback->Map_getExtractorRadius = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getExtractorRadius);
+	callback->Map_getMinWind = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getMinWind);
+	callback->Map_getMaxWind = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getMaxWind);
+	callback->Map_getCurWind = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getCurWind);
+	callback->Map_getTidalStrength = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getTidalStrength);
+	callback->Map_getGravity = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getGravity);
+	callback->Map_getWaterDamage = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getWaterDamage);
+	callback->Map_isDeformable = AI_CALLBACK_FUNC(skirmishAiCallback_Map_isDeformable);
+	callback->Map_getHardness = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getHardness);
+	callback->Map_getHardnessModMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getHardnessModMap);
+	callback->Map_getSpeedModMap = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getSpeedModMap);
+	callback->Map_getPoints = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getPoints);
+	callback->Map_Point_getPosition = AI_CALLBACK_FUNC(skirmishAiCallback_Map_Point_getPosition);
+	callback->Map_Point_getColor = AI_CALLBACK_FUNC(skirmishAiCallback_Map_Point_getColor);
+	callback->Map_Point_getLabel = AI_CALLBACK_FUNC(skirmishAiCallback_Map_Point_getLabel);
+	callback->Map_getLines = AI_CALLBACK_FUNC(skirmishAiCallback_Map_getLines);
+	callback->Map_Line_getFirstPosition = AI_CALLBACK_FUNC(skirmishAiCallback_Map_Line_getFirstPosition);
+	callback->Map_Line_getSecondPosition = AI_CALLBACK_FUNC(skirmishAiCallback_Map_Line_getSecondPosition);
+	callback->Map_Line_getColor = AI_CALLBACK_FUNC(skirmishAiCallback_Map_Line_getColor);
+	callback->Map_isPossibleToBuildAt = AI_CALLBACK_FUNC(skirmishAiCallback_Map_isPossibleToBuildAt);
+	callback->Map_findClosestBuildSite = AI_CALLBACK_FUNC(skirmishAiCallback_Map_findClosestBuildSite);
+	callback->getFeatureDefs = AI_CALLBACK_FUNC(skirmishAiCallback_getFeatureDefs);
+	callback->FeatureDef_getName = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getName);
+	callback->FeatureDef_getDescription = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getDescription);
+	callback->FeatureDef_getContainedResource = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getContainedResource);
+	callback->FeatureDef_getMaxHealth = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getMaxHealth);
+	callback->FeatureDef_getReclaimTime = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getReclaimTime);
+	callback->FeatureDef_getMass = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getMass);
+	callback->FeatureDef_isUpright = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_isUpright);
+	callback->FeatureDef_getDrawType = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getDrawType);
+	callback->FeatureDef_getModelName = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getModelName);
+	callback->FeatureDef_getResurrectable = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getResurrectable);
+	callback->FeatureDef_getSmokeTime = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getSmokeTime);
+	callback->FeatureDef_isDestructable = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_isDestructable);
+	callback->FeatureDef_isReclaimable = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_isReclaimable);
+	callback->FeatureDef_isAutoreclaimable = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_isAutoreclaimable);
+	callback->FeatureDef_isBlocking = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_isBlocking);
+	callback->FeatureDef_isBurnable = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_isBurnable);
+	callback->FeatureDef_isFloating = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_isFloating);
+	callback->FeatureDef_isNoSelect = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_isNoSelect);
+	callback->FeatureDef_isGeoThermal = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_isGeoThermal);
+	callback->FeatureDef_getXSize = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getXSize);
+	callback->FeatureDef_getZSize = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getZSize);
+	callback->FeatureDef_getCustomParams = AI_CALLBACK_FUNC(skirmishAiCallback_FeatureDef_getCustomParams);
+	callback->getFeatures = AI_CALLBACK_FUNC(skirmishAiCallback_getFeatures);
+	callback->getFeaturesIn = AI_CALLBACK_FUNC(skirmishAiCallback_getFeaturesIn);
+	callback->Feature_getDef = AI_CALLBACK_FUNC(skirmishAiCallback_Feature_getDef);
+	callback->Feature_getHealth = AI_CALLBACK_FUNC(skirmishAiCallback_Feature_getHealth);
+	callback->Feature_getReclaimLeft = AI_CALLBACK_FUNC(skirmishAiCallback_Feature_getReclaimLeft);
+	callback->Feature_getPosition = AI_CALLBACK_FUNC(skirmishAiCallback_Feature_getPosition);
+	callback->Feature_getRulesParamFloat = AI_CALLBACK_FUNC(skirmishAiCallback_Feature_getRulesParamFloat);
+	callback->Feature_getRulesParamString = AI_CALLBACK_FUNC(skirmishAiCallback_Feature_getRulesParamString);
+	callback->Feature_getResurrectDef = AI_CALLBACK_FUNC(skirmishAiCallback_Feature_getResurrectDef);
+	callback->Feature_getBuildingFacing = AI_CALLBACK_FUNC(skirmishAiCallback_Feature_getBuildingFacing);
+	callback->getWeaponDefs = AI_CALLBACK_FUNC(skirmishAiCallback_getWeaponDefs);
+	callback->getWeaponDefByName = AI_CALLBACK_FUNC(skirmishAiCallback_getWeaponDefByName);
+	callback->WeaponDef_getName = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getName);
+	callback->WeaponDef_getType = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getType);
+	callback->WeaponDef_getDescription = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getDescription);
+	callback->WeaponDef_getRange = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getRange);
+	callback->WeaponDef_getHeightMod = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getHeightMod);
+	callback->WeaponDef_getAccuracy = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getAccuracy);
+	callback->WeaponDef_getSprayAngle = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getSprayAngle);
+	callback->WeaponDef_getMovingAccuracy = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getMovingAccuracy);
+	callback->WeaponDef_getTargetMoveError = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getTargetMoveError);
+	callback->WeaponDef_getLeadLimit = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getLeadLimit);
+	callback->WeaponDef_getLeadBonus = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getLeadBonus);
+	callback->WeaponDef_getPredictBoost = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getPredictBoost);
+	callback->WeaponDef_getNumDamageTypes = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getNumDamageTypes);
+	callback->WeaponDef_Damage_getParalyzeDamageTime = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Damage_getParalyzeDamageTime);
+	callback->WeaponDef_Damage_getImpulseFactor = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Damage_getImpulseFactor);
+	callback->WeaponDef_Damage_getImpulseBoost = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Damage_getImpulseBoost);
+	callback->WeaponDef_Damage_getCraterMult = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Damage_getCraterMult);
+	callback->WeaponDef_Damage_getCraterBoost = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Damage_getCraterBoost);
+	callback->WeaponDef_Damage_getTypes = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Damage_getTypes);
+	callback->WeaponDef_getAreaOfEffect = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getAreaOfEffect);
+	callback->WeaponDef_isNoSelfDamage = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isNoSelfDamage);
+	callback->WeaponDef_getFireStarter = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getFireStarter);
+	callback->WeaponDef_getEdgeEffectiveness = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getEdgeEffectiveness);
+	callback->WeaponDef_getSize = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getSize);
+	callback->WeaponDef_getSizeGrowth = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getSizeGrowth);
+	callback->WeaponDef_getCollisionSize = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getCollisionSize);
+	callback->WeaponDef_getSalvoSize = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getSalvoSize);
+	callback->WeaponDef_getSalvoDelay = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getSalvoDelay);
+	callback->WeaponDef_getReload = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getReload);
+	callback->WeaponDef_getBeamTime = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getBeamTime);
+	callback->WeaponDef_isBeamBurst = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isBeamBurst);
+	callback->WeaponDef_isWaterBounce = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isWaterBounce);
+	callback->WeaponDef_isGroundBounce = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isGroundBounce);
+	callback->WeaponDef_getBounceRebound = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getBounceRebound);
+	callback->WeaponDef_getBounceSlip = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getBounceSlip);
+	callback->WeaponDef_getNumBounce = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getNumBounce);
+	callback->WeaponDef_getMaxAngle = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getMaxAngle);
+	callback->WeaponDef_getUpTime = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getUpTime);
+	callback->WeaponDef_getFlightTime = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getFlightTime);
+	callback->WeaponDef_getCost = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getCost);
+	callback->WeaponDef_getProjectilesPerShot = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getProjectilesPerShot);
+	callback->WeaponDef_isTurret = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isTurret);
+	callback->WeaponDef_isOnlyForward = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isOnlyForward);
+	callback->WeaponDef_isFixedLauncher = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isFixedLauncher);
+	callback->WeaponDef_isWaterWeapon = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isWaterWeapon);
+	callback->WeaponDef_isFireSubmersed = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isFireSubmersed);
+	callback->WeaponDef_isSubMissile = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isSubMissile);
+	callback->WeaponDef_isTracks = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isTracks);
+	callback->WeaponDef_isDropped = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isDropped);
+	callback->WeaponDef_isParalyzer = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isParalyzer);
+	callback->WeaponDef_isImpactOnly = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isImpactOnly);
+	callback->WeaponDef_isNoAutoTarget = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isNoAutoTarget);
+	callback->WeaponDef_isManualFire = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isManualFire);
+	callback->WeaponDef_getInterceptor = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getInterceptor);
+	callback->WeaponDef_getTargetable = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getTargetable);
+	callback->WeaponDef_isStockpileable = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isStockpileable);
+	callback->WeaponDef_getCoverageRange = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getCoverageRange);
+	callback->WeaponDef_getStockpileTime = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getStockpileTime);
+	callback->WeaponDef_getIntensity = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getIntensity);
+	callback->WeaponDef_getDuration = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getDuration);
+	callback->WeaponDef_getFalloffRate = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getFalloffRate);
+	callback->WeaponDef_isSelfExplode = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isSelfExplode);
+	callback->WeaponDef_isGravityAffected = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isGravityAffected);
+	callback->WeaponDef_getHighTrajectory = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getHighTrajectory);
+	callback->WeaponDef_getMyGravity = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getMyGravity);
+	callback->WeaponDef_isNoExplode = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isNoExplode);
+	callback->WeaponDef_getStartVelocity = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getStartVelocity);
+	callback->WeaponDef_getWeaponAcceleration = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getWeaponAcceleration);
+	callback->WeaponDef_getTurnRate = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getTurnRate);
+	callback->WeaponDef_getMaxVelocity = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getMaxVelocity);
+	callback->WeaponDef_getProjectileSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getProjectileSpeed);
+	callback->WeaponDef_getExplosionSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getExplosionSpeed);
+	callback->WeaponDef_getOnlyTargetCategory = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getOnlyTargetCategory);
+	callback->WeaponDef_getWobble = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getWobble);
+	callback->WeaponDef_getDance = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getDance);
+	callback->WeaponDef_getTrajectoryHeight = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getTrajectoryHeight);
+	callback->WeaponDef_isLargeBeamLaser = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isLargeBeamLaser);
+	callback->WeaponDef_isShield = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isShield);
+	callback->WeaponDef_isShieldRepulser = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isShieldRepulser);
+	callback->WeaponDef_isSmartShield = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isSmartShield);
+	callback->WeaponDef_isExteriorShield = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isExteriorShield);
+	callback->WeaponDef_isVisibleShield = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isVisibleShield);
+	callback->WeaponDef_isVisibleShieldRepulse = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isVisibleShieldRepulse);
+	callback->WeaponDef_getVisibleShieldHitFrames = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getVisibleShieldHitFrames);
+	callback->WeaponDef_Shield_getResourceUse = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Shield_getResourceUse);
+	callback->WeaponDef_Shield_getRadius = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Shield_getRadius);
+	callback->WeaponDef_Shield_getForce = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Shield_getForce);
+	callback->WeaponDef_Shield_getMaxSpeed = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Shield_getMaxSpeed);
+	callback->WeaponDef_Shield_getPower = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Shield_getPower);
+	callback->WeaponDef_Shield_getPowerRegen = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Shield_getPowerRegen);
+	callback->WeaponDef_Shield_getPowerRegenResource = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Shield_getPowerRegenResource);
+	callback->WeaponDef_Shield_getStartingPower = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Shield_getStartingPower);
+	callback->WeaponDef_Shield_getRechargeDelay = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Shield_getRechargeDelay);
+	callback->WeaponDef_Shield_getInterceptType = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_Shield_getInterceptType);
+	callback->WeaponDef_getInterceptedByShieldType = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getInterceptedByShieldType);
+	callback->WeaponDef_isAvoidFriendly = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isAvoidFriendly);
+	callback->WeaponDef_isAvoidFeature = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isAvoidFeature);
+	callback->WeaponDef_isAvoidNeutral = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isAvoidNeutral);
+	callback->WeaponDef_getTargetBorder = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getTargetBorder);
+	callback->WeaponDef_getCylinderTargetting = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getCylinderTargetting);
+	callback->WeaponDef_getMinIntensity = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getMinIntensity);
+	callback->WeaponDef_getHeightBoostFactor = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getHeightBoostFactor);
+	callback->WeaponDef_getProximityPriority = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getProximityPriority);
+	callback->WeaponDef_getCollisionFlags = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getCollisionFlags);
+	callback->WeaponDef_isSweepFire = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isSweepFire);
+	callback->WeaponDef_isAbleToAttackGround = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isAbleToAttackGround);
+	callback->WeaponDef_getCameraShake = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getCameraShake);
+	callback->WeaponDef_getDynDamageExp = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getDynDamageExp);
+	callback->WeaponDef_getDynDamageMin = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getDynDamageMin);
+	callback->WeaponDef_getDynDamageRange = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getDynDamageRange);
+	callback->WeaponDef_isDynDamageInverted = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_isDynDamageInverted);
+	callback->WeaponDef_getCustomParams = AI_CALLBACK_FUNC(skirmishAiCallback_WeaponDef_getCustomParams);
+	callback->Unit_Weapon_getDef = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_Weapon_getDef);
+	callback->Unit_Weapon_getReloadFrame = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_Weapon_getReloadFrame);
+	callback->Unit_Weapon_getReloadTime = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_Weapon_getReloadTime);
+	callback->Unit_Weapon_getRange = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_Weapon_getRange);
+	callback->Unit_Weapon_isShieldEnabled = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_Weapon_isShieldEnabled);
+	callback->Unit_Weapon_getShieldPower = AI_CALLBACK_FUNC(skirmishAiCallback_Unit_Weapon_getShieldPower);
+	callback->Debug_GraphDrawer_isEnabled = AI_CALLBACK_FUNC(skirmishAiCallback_Debug_GraphDrawer_isEnabled);
+	callback->getUnitStates = AI_CALLBACK_FUNC(skirmishAiCallback_getUnitStates);
+	callback->Engine_handleCommands = AI_CALLBACK_FUNC(skirmishAiCallback_Engine_handleCommands);
+
+	#undef AI_CALLBACK_FUNC
 }
 
 SSkirmishAICallback* skirmishAiCallback_GetInstance(CSkirmishAIWrapper* ai)
@@ -5644,7 +5746,7 @@ SSkirmishAICallback* skirmishAiCallback_GetInstance(CSkirmishAIWrapper* ai)
 	AI_CHEAT_FLAGS[ai->GetSkirmishAIID()] = {false, false};
 	AI_TEAM_IDS[ai->GetSkirmishAIID()] = ai->GetTeamId();
 
-	skirmishAiCallback_init(&AI_CALLBACK_WRAPPERS[ai->GetSkirmishAIID()]);
+	skirmishAiCallback_init(&AI_CALLBACK_WRAPPERS[ai->GetSkirmishAIID()], eoh->ThreadedSkirmishAIs());
 
 	return &AI_CALLBACK_WRAPPERS[ai->GetSkirmishAIID()];
 }
@@ -1263,6 +1263,10 @@ EXPORT(float            ) skirmishAiCallback_Unit_Weapon_getShieldPower(int skir
 
 EXPORT(bool             ) skirmishAiCallback_Debug_GraphDrawer_isEnabled(int skirmishAIId);
 
+EXPORT(int              ) skirmishAiCallback_getUnitStates(int skirmishAIId, int* unitIds, int unitIds_size, int* unitDefIds, float* positions, float* velocities, float* healths, float* maxHealths);
+
+EXPORT(int              ) skirmishAiCallback_Engine_handleCommands(int skirmishAIId, int toId, int* commandTopics, void** commandData, int* results, int commands_size);
+
 #if	defined(__cplusplus)
 } // extern "C"
 #endif
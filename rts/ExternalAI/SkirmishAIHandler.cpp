@@ -31,7 +31,6 @@ CR_REG_METADATA(CSkirmishAIHandler, (
 		CR_IGNORED(skirmishAIDataMap),
 		CR_IGNORED(luaAIShortNames),
 
-		CR_IGNORED(currentAIId),
 		CR_IGNORED(numSkirmishAIs),
 
 		CR_IGNORED(gameInitialized),
@@ -40,6 +39,8 @@ CR_REG_METADATA(CSkirmishAIHandler, (
 	CR_POSTLOAD(PostLoad)
 ))
 
+thread_local uint8_t CSkirmishAIHandler::currentAIId = MAX_AIS;
+
 
 CSkirmishAIHandler skirmishAIHandler;
 
@@ -200,8 +200,9 @@ private:
 	spring::unordered_map<uint8_t, const SkirmishAIData*> skirmishAIDataMap;
 	spring::unordered_set<std::string> luaAIShortNames;
 
-	// the current local AI ID that is executing, MAX_AIS if none (e.g. LuaUI)
-	uint8_t currentAIId = MAX_AIS;
+	// the current local AI ID that is executing on this thread, MAX_AIS if none (e.g. LuaUI)
+	// per-thread since AIs can run concurrently, see ThreadedSkirmishAI
+	static thread_local uint8_t currentAIId;
 	uint8_t numSkirmishAIs = 0;
 
 	bool gameInitialized = false;
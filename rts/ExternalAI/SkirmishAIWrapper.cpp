@@ -22,6 +22,7 @@
 #include "System/FileSystem/FileSystem.h"
 #include "System/Log/ILog.h"
 #include "System/Platform/SharedLib.h"
+#include "System/Platform/Threading.h"
 #include "System/TimeProfiler.h"
 #include "System/StringUtil.h"
 
@@ -51,6 +52,12 @@ CR_REG_METADATA(CSkirmishAIWrapper, (
 
 	CR_MEMBER(cheatEvents),
 	CR_MEMBER(blockEvents),
+	CR_IGNORED(queueEvents),
+	CR_IGNORED(handlingQueuedEvents),
+
+	CR_IGNORED(queuedEvents),
+	CR_IGNORED(queuedUnitIDs),
+	CR_IGNORED(queuedMessages),
 
 	CR_SERIALIZER(Serialize),
 	CR_POSTLOAD(PostLoad)
@@ -74,7 +81,11 @@ void CSkirmishAIWrapper::PreInit(int aiID)
 
 		cheatEvents = false;
 		blockEvents = false;
+		queueEvents = false;
 	}
+
+	ClearQueuedEvents();
+
 	{
 		const std::string& kn = key.GetShortName();
 		const std::string& kv = key.GetVersion();
@@ -147,6 +158,10 @@ void CSkirmishAIWrapper::Init(bool savedGame) {
 void CSkirmishAIWrapper::Kill()
 {
 	assert(Active());
+
+	// events still pending at this point are of no use to the AI
+	ClearQueuedEvents();
+
 	// send release event
 	Release(skirmishAIHandler.GetLocalKillFlag(skirmishAIId));
 
@@ -275,6 +290,7 @@ void CSkirmishAIWrapper::Load(std::istream* loadStream)
 	}
 
 	assert(Active());
+	HandleQueuedEvents();
 	HandleEvent(EVENT_LOAD, &evtData);
 
 	FileSystem::DeleteFile(tmpFile);
@@ -286,6 +302,7 @@ void CSkirmishAIWrapper::Save(std::ostream* saveStream)
 	const SSaveEvent evtData = {tmpFile.c_str()};
 
 	assert(Active());
+	HandleQueuedEvents();
 	HandleEvent(EVENT_SAVE, &evtData);
 
 	if (!FileSystem::FileExists(tmpFile))
@@ -305,21 +322,41 @@ void CSkirmishAIWrapper::Save(std::ostream* saveStream)
 
 
 void CSkirmishAIWrapper::UnitIdle(int unitId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_UNIT_IDLE, unitId);
+		return;
+	}
+
 	const SUnitIdleEvent evtData = {unitId};
 	HandleEvent(EVENT_UNIT_IDLE, &evtData);
 }
 
 void CSkirmishAIWrapper::UnitCreated(int unitId, int builderId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_UNIT_CREATED, unitId, builderId);
+		return;
+	}
+
 	const SUnitCreatedEvent evtData = {unitId, builderId};
 	HandleEvent(EVENT_UNIT_CREATED, &evtData);
 }
 
 void CSkirmishAIWrapper::UnitFinished(int unitId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_UNIT_FINISHED, unitId);
+		return;
+	}
+
 	const SUnitFinishedEvent evtData = {unitId};
 	HandleEvent(EVENT_UNIT_FINISHED, &evtData);
 }
 
 void CSkirmishAIWrapper::UnitDestroyed(int unitId, int attackerUnitId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_UNIT_DESTROYED, unitId, attackerUnitId);
+		return;
+	}
+
 	const SUnitDestroyedEvent evtData = {unitId, attackerUnitId};
 	HandleEvent(EVENT_UNIT_DESTROYED, &evtData);
 }
@@ -332,6 +369,11 @@ void CSkirmishAIWrapper::UnitDamaged(
 	int weaponDefId,
 	bool paralyzer
 ) {
+	if (queueEvents) {
+		QueueEvent(EVENT_UNIT_DAMAGED, unitId, attackerUnitId, weaponDefId, paralyzer, damage, dir);
+		return;
+	}
+
 	float3 cpyDir = dir;
 	const SUnitDamagedEvent evtData = {unitId, attackerUnitId, damage, &cpyDir[0], weaponDefId, paralyzer};
 
@@ -339,52 +381,102 @@ void CSkirmishAIWrapper::UnitDamaged(
 }
 
 void CSkirmishAIWrapper::UnitMoveFailed(int unitId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_UNIT_MOVE_FAILED, unitId);
+		return;
+	}
+
 	const SUnitMoveFailedEvent evtData = {unitId};
 	HandleEvent(EVENT_UNIT_MOVE_FAILED, &evtData);
 }
 
 void CSkirmishAIWrapper::UnitGiven(int unitId, int oldTeam, int newTeam) {
+	if (queueEvents) {
+		QueueEvent(EVENT_UNIT_GIVEN, unitId, oldTeam, newTeam);
+		return;
+	}
+
 	const SUnitGivenEvent evtData = {unitId, oldTeam, newTeam};
 	HandleEvent(EVENT_UNIT_GIVEN, &evtData);
 }
 
 void CSkirmishAIWrapper::UnitCaptured(int unitId, int oldTeam, int newTeam) {
+	if (queueEvents) {
+		QueueEvent(EVENT_UNIT_CAPTURED, unitId, oldTeam, newTeam);
+		return;
+	}
+
 	const SUnitCapturedEvent evtData = {unitId, oldTeam, newTeam};
 	HandleEvent(EVENT_UNIT_CAPTURED, &evtData);
 }
 
 
 void CSkirmishAIWrapper::EnemyCreated(int unitId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_ENEMY_CREATED, unitId);
+		return;
+	}
+
 	const SEnemyCreatedEvent evtData = {unitId};
 	HandleEvent(EVENT_ENEMY_CREATED, &evtData);
 }
 
 void CSkirmishAIWrapper::EnemyFinished(int unitId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_ENEMY_FINISHED, unitId);
+		return;
+	}
+
 	const SEnemyFinishedEvent evtData = {unitId};
 	HandleEvent(EVENT_ENEMY_FINISHED, &evtData);
 }
 
 void CSkirmishAIWrapper::EnemyEnterLOS(int unitId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_ENEMY_ENTER_LOS, unitId);
+		return;
+	}
+
 	const SEnemyEnterLOSEvent evtData = {unitId};
 	HandleEvent(EVENT_ENEMY_ENTER_LOS, &evtData);
 }
 
 void CSkirmishAIWrapper::EnemyLeaveLOS(int unitId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_ENEMY_LEAVE_LOS, unitId);
+		return;
+	}
+
 	const SEnemyLeaveLOSEvent evtData = {unitId};
 	HandleEvent(EVENT_ENEMY_LEAVE_LOS, &evtData);
 }
 
 void CSkirmishAIWrapper::EnemyEnterRadar(int unitId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_ENEMY_ENTER_RADAR, unitId);
+		return;
+	}
+
 	const SEnemyEnterRadarEvent evtData = {unitId};
 	HandleEvent(EVENT_ENEMY_ENTER_RADAR, &evtData);
 }
 
 void CSkirmishAIWrapper::EnemyLeaveRadar(int unitId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_ENEMY_LEAVE_RADAR, unitId);
+		return;
+	}
+
 	const SEnemyLeaveRadarEvent evtData = {unitId};
 	HandleEvent(EVENT_ENEMY_LEAVE_RADAR, &evtData);
 }
 
 void CSkirmishAIWrapper::EnemyDestroyed(int enemyUnitId, int attackerUnitId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_ENEMY_DESTROYED, enemyUnitId, attackerUnitId);
+		return;
+	}
+
 	const SEnemyDestroyedEvent evtData = {enemyUnitId, attackerUnitId};
 	HandleEvent(EVENT_ENEMY_DESTROYED, &evtData);
 }
@@ -397,6 +489,11 @@ void CSkirmishAIWrapper::EnemyDamaged(
 	int weaponDefId,
 	bool paralyzer
 ) {
+	if (queueEvents) {
+		QueueEvent(EVENT_ENEMY_DAMAGED, enemyUnitId, attackerUnitId, weaponDefId, paralyzer, damage, dir);
+		return;
+	}
+
 	float3 cpyDir = dir;
 	const SEnemyDamagedEvent evtData = {enemyUnitId, attackerUnitId, damage, &cpyDir[0], weaponDefId, paralyzer};
 
@@ -409,16 +506,35 @@ void CSkirmishAIWrapper::Update(int frame) {
 }
 
 void CSkirmishAIWrapper::SendChatMessage(const char* msg, int fromPlayerId) {
+	if (queueEvents) {
+		std::lock_guard<spring::mutex> lock(queueMutex);
+
+		queuedEvents.push_back({EVENT_MESSAGE, {fromPlayerId, static_cast<int>(queuedMessages.size()), -1, -1}, 0.0f, ZeroVector});
+		queuedMessages.append(msg);
+		queuedMessages.push_back('\0');
+		return;
+	}
+
 	const SMessageEvent evtData = {fromPlayerId, msg};
 	HandleEvent(EVENT_MESSAGE, &evtData);
 }
 
 void CSkirmishAIWrapper::SendLuaMessage(const char* inData, const char** outData) {
+	// has to be answered right away, deliver everything that happened before it first;
+	// never called while the AIs are updated in parallel (see EngineOutHandler) so it
+	// does not run this AI's handlers from another AI's thread
+	HandleQueuedEvents();
+
 	const SLuaMessageEvent evtData = {inData /*outData*/};
 	HandleEvent(EVENT_LUA_MESSAGE, &evtData);
 }
 
 void CSkirmishAIWrapper::WeaponFired(int unitId, int weaponDefId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_WEAPON_FIRED, unitId, weaponDefId);
+		return;
+	}
+
 	const SWeaponFiredEvent evtData = {unitId, weaponDefId};
 	HandleEvent(EVENT_WEAPON_FIRED, &evtData);
 }
@@ -428,15 +544,29 @@ void CSkirmishAIWrapper::PlayerCommandGiven(
 	const Command& c,
 	int playerId
 ) {
+	const int cCommandId = extractAICommandTopic(&c, unitHandler.MaxUnits());
+
+	if (queueEvents) {
+		std::lock_guard<spring::mutex> lock(queueMutex);
+
+		queuedEvents.push_back({EVENT_PLAYER_COMMAND, {static_cast<int>(queuedUnitIDs.size()), static_cast<int>(playerSelectedUnits.size()), cCommandId, playerId}, 0.0f, ZeroVector});
+		queuedUnitIDs.insert(queuedUnitIDs.end(), playerSelectedUnits.begin(), playerSelectedUnits.end());
+		return;
+	}
+
 	std::vector<int> unitIds = playerSelectedUnits;
 
-	const int cCommandId = extractAICommandTopic(&c, unitHandler.MaxUnits());
 	const SPlayerCommandEvent evtData = {&unitIds[0], static_cast<int>(playerSelectedUnits.size()), cCommandId, playerId};
 
 	HandleEvent(EVENT_PLAYER_COMMAND, &evtData);
 }
 
 void CSkirmishAIWrapper::CommandFinished(int unitId, int commandId, int commandTopicId) {
+	if (queueEvents) {
+		QueueEvent(EVENT_COMMAND_FINISHED, unitId, commandId, commandTopicId);
+		return;
+	}
+
 	const SCommandFinishedEvent evtData = {unitId, commandId, commandTopicId};
 	HandleEvent(EVENT_COMMAND_FINISHED, &evtData);
 }
@@ -447,6 +577,11 @@ void CSkirmishAIWrapper::SeismicPing(
 	const float3& pos,
 	float strength
 ) {
+	if (queueEvents) {
+		QueueEvent(EVENT_SEISMIC_PING, allyTeam, unitId, -1, -1, strength, pos);
+		return;
+	}
+
 	/*const*/ float3 cpyPos = pos;
 	const SSeismicPingEvent evtData = {&cpyPos[0], strength};
 
@@ -454,13 +589,118 @@ void CSkirmishAIWrapper::SeismicPing(
 }
 
 
+void CSkirmishAIWrapper::ClearQueuedEvents() {
+	std::lock_guard<spring::mutex> lock(queueMutex);
+
+	queuedEvents.clear();
+	queuedUnitIDs.clear();
+	queuedMessages.clear();
+}
+
+void CSkirmishAIWrapper::HandleQueuedEvents() {
+	// SendLuaMessage can be reached from within an event handler; only
+	// ever touched by the thread running this AI so needs no locking
+	if (handlingQueuedEvents)
+		return;
+
+	handlingQueuedEvents = true;
+
+	std::vector<QueuedEvent> events;
+	std::vector<int> unitIDs;
+	std::string messages;
+
+	// take the buffers out under the lock and deliver without holding it;
+	// handlers may queue further events, which are picked up by the next pass
+	while (true) {
+		{
+			std::lock_guard<spring::mutex> lock(queueMutex);
+
+			events.swap(queuedEvents);
+			unitIDs.swap(queuedUnitIDs);
+			messages.swap(queuedMessages);
+		}
+
+		if (events.empty())
+			break;
+
+		for (const QueuedEvent& e: events) {
+			const int* args = &e.args[0];
+
+			switch (e.topic) {
+				case EVENT_UNIT_IDLE        : { const SUnitIdleEvent        evtData = {args[0]                  }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_UNIT_CREATED     : { const SUnitCreatedEvent     evtData = {args[0], args[1]         }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_UNIT_FINISHED    : { const SUnitFinishedEvent    evtData = {args[0]                  }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_UNIT_DESTROYED   : { const SUnitDestroyedEvent   evtData = {args[0], args[1]         }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_UNIT_MOVE_FAILED : { const SUnitMoveFailedEvent  evtData = {args[0]                  }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_UNIT_GIVEN       : { const SUnitGivenEvent       evtData = {args[0], args[1], args[2]}; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_UNIT_CAPTURED    : { const SUnitCapturedEvent    evtData = {args[0], args[1], args[2]}; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_ENEMY_CREATED    : { const SEnemyCreatedEvent    evtData = {args[0]                  }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_ENEMY_FINISHED   : { const SEnemyFinishedEvent   evtData = {args[0]                  }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_ENEMY_ENTER_LOS  : { const SEnemyEnterLOSEvent   evtData = {args[0]                  }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_ENEMY_LEAVE_LOS  : { const SEnemyLeaveLOSEvent   evtData = {args[0]                  }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_ENEMY_ENTER_RADAR: { const SEnemyEnterRadarEvent evtData = {args[0]                  }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_ENEMY_LEAVE_RADAR: { const SEnemyLeaveRadarEvent evtData = {args[0]                  }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_ENEMY_DESTROYED  : { const SEnemyDestroyedEvent  evtData = {args[0], args[1]         }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_WEAPON_FIRED     : { const SWeaponFiredEvent     evtData = {args[0], args[1]         }; HandleEvent(e.topic, &evtData); } break;
+				case EVENT_COMMAND_FINISHED : { const SCommandFinishedEvent evtData = {args[0], args[1], args[2]}; HandleEvent(e.topic, &evtData); } break;
+
+				case EVENT_UNIT_DAMAGED: {
+					float3 cpyDir = e.vec;
+					const SUnitDamagedEvent evtData = {args[0], args[1], e.value, &cpyDir[0], args[2], (args[3] != 0)};
+
+					HandleEvent(e.topic, &evtData);
+				} break;
+				case EVENT_ENEMY_DAMAGED: {
+					float3 cpyDir = e.vec;
+					const SEnemyDamagedEvent evtData = {args[0], args[1], e.value, &cpyDir[0], args[2], (args[3] != 0)};
+
+					HandleEvent(e.topic, &evtData);
+				} break;
+				case EVENT_SEISMIC_PING: {
+					float3 cpyPos = e.vec;
+					const SSeismicPingEvent evtData = {&cpyPos[0], e.value};
+
+					HandleEvent(e.topic, &evtData);
+				} break;
+
+				case EVENT_MESSAGE: {
+					const SMessageEvent evtData = {args[0], &messages[args[1]]};
+
+					HandleEvent(e.topic, &evtData);
+				} break;
+				case EVENT_PLAYER_COMMAND: {
+					const SPlayerCommandEvent evtData = {unitIDs.data() + args[0], args[1], args[2], args[3]};
+
+					HandleEvent(e.topic, &evtData);
+				} break;
+
+				default: {
+					assert(false);
+				} break;
+			}
+		}
+
+		events.clear();
+		unitIDs.clear();
+		messages.clear();
+	}
+
+	handlingQueuedEvents = false;
+}
+
+
 int CSkirmishAIWrapper::HandleEvent(int topic, const void* data) const {
-	ScopedTimer timer(GetTimerNameHash());
+	// to prevent log error spam, signal: OK
+	if (blockEvents && (topic != EVENT_RELEASE))
+		return 0;
 
-	if (!blockEvents || (topic == EVENT_RELEASE))
+	// the non-MT timer keeps unsynchronized state, only use it on the main thread
+	if (!Threading::IsMainThread()) {
+		ScopedMtTimer timer(GetTimerNameHash());
 		return library->HandleEvent(skirmishAIId, topic, data);
+	}
 
-	// to prevent log error spam, signal: OK
-	return 0;
+	ScopedTimer timer(GetTimerNameHash());
+	return library->HandleEvent(skirmishAIId, topic, data);
 }
 
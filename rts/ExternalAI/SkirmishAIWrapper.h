@@ -4,12 +4,16 @@
 #define SKIRMISH_AI_WRAPPER_H
 
 #include "SkirmishAIKey.h"
+#include "System/float3.h"
+#include "System/Threading/SpringThreading.h"
+
+#include <string>
+#include <vector>
 
 class CSkirmishAILibrary;
 struct SSkirmishAICallback;
 
 struct Command;
-class float3;
 
 
 /**
@@ -92,6 +96,16 @@ public:
 	 */
 	void SetBlockEvents(bool enable) { blockEvents = enable; }
 	void SetCheatEvents(bool enable) { cheatEvents = enable; }
+	/**
+	 * While enabled, events are stored rather than sent to the plugin
+	 * right away and delivered in order by HandleQueuedEvents.
+	 * Events may be queued from any thread, but only the thread running
+	 * this AI may deliver them.
+	 * @see CEngineOutHandler::Update()
+	 */
+	void SetQueueEvents(bool enable) { queueEvents = enable; }
+
+	void HandleQueuedEvents();
 
 	bool CheatEventsEnabled() const { return cheatEvents; }
 
@@ -111,11 +125,26 @@ private:
 	 */
 	int HandleEvent(int topic, const void* data) const;
 
+	void QueueEvent(int topic, int arg0, int arg1 = -1, int arg2 = -1, int arg3 = -1, float value = 0.0f, const float3& vec = ZeroVector) {
+		std::lock_guard<spring::mutex> lock(queueMutex);
+		queuedEvents.push_back({topic, {arg0, arg1, arg2, arg3}, value, vec});
+	}
+	void ClearQueuedEvents();
+
 	uint32_t GetTimerNameHash() const { return *reinterpret_cast<const uint32_t*>(&timerName[0]); }
 
 	const char* GetTimerName() const { return (timerName + sizeof(uint32_t)); }
 	      char* GetTimerName()       { return (timerName + sizeof(uint32_t)); }
 
+private:
+	struct QueuedEvent {
+		int topic;
+		int args[4];
+
+		float value; // damage or strength
+		float3 vec;  // direction or position
+	};
+
 private:
 	SkirmishAIKey key;
 
@@ -134,6 +163,17 @@ private:
 	bool libraryInit = false; // CSkirmishAILibrary::Init retval
 	bool cheatEvents = false;
 	bool blockEvents = false;
+	bool queueEvents = false;
+	bool handlingQueuedEvents = false;
+
+	// guards the queued* buffers, callbacks of other AIs running on
+	// worker threads can raise events for this one (e.g. UnitCreated)
+	spring::mutex queueMutex;
+
+	std::vector<QueuedEvent> queuedEvents;
+	// PlayerCommandGiven unit-ids and chat messages of queued events
+	std::vector<int> queuedUnitIDs;
+	std::string queuedMessages;
 };
 
 #endif // SKIRMISH_AI_WRAPPER_H
@@ -13,6 +13,7 @@
 #include "GlobalUnsynced.h"
 #include "LoadScreen.h"
 #include "SelectedUnitsHandler.h"
+#include "SimBenchmark.h"
 #include "WaitCommandsAI.h"
 #include "WordCompletion.h"
 #include "IVideoCapturing.h"
@@ -141,6 +142,10 @@ CONFIG(int, ShowPlayerInfo).defaultValue(1).headlessValue(0);
 CONFIG(float, GuiOpacity).defaultValue(0.8f).minimumValue(0.0f).maximumValue(1.0f).description("Sets the opacity of the built-in Spring UI. Generally has no effect on LuaUI widgets. Can be set in-game using shift+, to decrease and shift+. to increase.");
 CONFIG(std::string, InputTextGeo).defaultValue("");
 
+CONFIG(std::string, ProfileRecordFile).defaultValue("").description("If set, every profiler timer sample is recorded to this ring-buffer file (see /ProfileRecord and tools/scripts/profile-summary.py).");
+CONFIG(int, ProfileRecordSamples).defaultValue(1 << 20).minimumValue(1024).description("Number of most recent samples kept in the ProfileRecordFile, 16 bytes each.");
+CONFIG(int, SnapshotInterval).defaultValue(0).minimumValue(0).description("Seconds of game time between crash-recovery savegames (Saves/snapshot-N.ssf), written in the background by a forked process where supported; those are skipped while synced Lua gadgets or Skirmish AIs are present, whose state they can not capture. Resume from the newest with --resume-snapshot. 0 disables.");
+CONFIG(int, SnapshotCount).defaultValue(2).minimumValue(1).description("Number of snapshot files (see SnapshotInterval) that are rotated through.");
 CONFIG(int, SmoothTimeOffset).defaultValue(0).headlessValue(0).description("Enables frametimeoffset smoothing, 0 = off (old version), -1 = forced 0.5,  1-20 smooth, recommended = 2-3");
 
 CGame* game = nullptr;
@@ -893,6 +898,9 @@ void CGame::PostLoad()
 	if (gameServer != nullptr) {
 		gameServer->PostLoad(gs->frameNum);
 	}
+
+	if (const std::string recordFile = configHandler->GetString("ProfileRecordFile"); !recordFile.empty())
+		CTimeProfiler::GetInstance().StartRecording(recordFile, configHandler->GetInt("ProfileRecordSamples"));
 }
 
 
@@ -932,6 +940,8 @@ void CGame::KillMisc()
 {
 	LOG("[Game::%s][1]", __func__);
 	CEndGameBox::Destroy();
+	simBenchmark.Kill();
+	CTimeProfiler::GetInstance().StopRecording();
 	IVideoCapturing::FreeInstance();
 
 	LOG("[Game::%s][2]", __func__);
@@ -1168,6 +1178,7 @@ bool CGame::Update()
 	ENTER_SYNCED_CODE();
 	SendClientProcUsage();
 	ClientReadNet(); // issues new SimFrame()s
+	simBenchmark.Update();
 
 	if (!gameOver) {
 		if (clientNet->NeedsReconnect())
@@ -1450,8 +1461,10 @@ bool CGame::Draw() {
 		// return early if and only if less than 30K milliseconds have passed since last draw-frame
 		// so we force render two frames per minute when minimized to clear batches and free memory
 		// don't need to mess with globalRendering->active since only mouse-input code depends on it
-		if ((currentTimePreDraw - lastDrawFrameTime).toSecsi() < 30)
+		if ((currentTimePreDraw - lastDrawFrameTime).toSecsi() < 30) {
+			worldDrawer.FinishUpdate();
 			return false;
+		}
 	}
 
 	if (globalRendering->drawDebug) {
@@ -1493,6 +1506,7 @@ bool CGame::Draw() {
 		worldDrawer.GenerateIBLTextures();
 
 		worldDrawer.Draw();
+		worldDrawer.FinishUpdate();
 		worldDrawer.ResetMVPMatrices();
 	}
 
@@ -1647,6 +1661,9 @@ void CGame::StartPlaying()
 
 	if (saveFileHandler == nullptr)
 		eventHandler.GameStart();
+
+	simBenchmark.Init(gameSetup->hostDemo);
+	simBenchmark.StartPlaying();
 }
 
 static const char* const tracingSimFrameName = "SimFrame";
@@ -1664,6 +1681,7 @@ void CGame::SimFrame() {
 	// note: starts at -1, first actual frame is 0
 	gs->frameNum += 1;
 	lastFrameTime = spring_gettime(); 
+	CTimeProfiler::GetInstance().SetFrameNum(gs->frameNum);
 	// This is not very ideal, as the timeoffset of each new draw frame is also calculated from this
 	// with a strange side effect: if the timeOffset was a high number, like 0.9, then this will force the next draw frame to have an offset of 0.0x
 	// What this means, is that in the case where we have frames to spare, and and over rendering, then the following can happen at 60hz:
@@ -1747,6 +1765,8 @@ void CGame::SimFrame() {
 
 		teamHandler.GameFrame(gs->frameNum);
 		playerHandler.GameFrame(gs->frameNum);
+
+		eventHandler.FlushBatchedEvents();
 	}
 
 	lastSimFrameTime = spring_gettime();
@@ -1754,6 +1774,10 @@ void CGame::SimFrame() {
 	gu->avgSimFrameTime = std::max(gu->avgSimFrameTime, 0.01f);
 
 	eventHandler.DbgTimingInfo(TIMING_SIM, lastFrameTime, lastSimFrameTime);
+	simBenchmark.SimFrame(gs->frameNum, lastSimFrameTime - lastFrameTime);
+
+	if ((gs->frameNum % GAME_SPEED) == 0)
+		QueueSnapshot();
 
 	FrameMarkEnd(tracingSimFrameName);
 
@@ -1764,7 +1788,8 @@ void CGame::SimFrame() {
 		// multiply by 0.5 to give unsynced code some execution time (50% of our sleep-budget)
 		const float msecSleepTime = (msecMaxSimFrameTime - msecDifSimFrameTime) * 0.5f;
 
-		if (msecSleepTime > 0.0f) {
+		// benchmarks want every frame as soon as it is available
+		if (msecSleepTime > 0.0f && !simBenchmark.IsEnabled()) {
 			spring_sleep(spring_msecs(msecSleepTime));
 		}
 	}
@@ -1808,6 +1833,7 @@ void CGame::GameEnd(const std::vector<unsigned char>& winningAllyTeams, bool tim
 #ifdef    HEADLESS
 	CTimeProfiler::GetInstance().PrintProfilingInfo();
 #endif // HEADLESS
+	simBenchmark.Finish("game over");
 
 	CDemoRecorder* record = clientNet->GetDemoRecorder();
 
@@ -2067,6 +2093,27 @@ void CGame::Save(std::string&& fileName, std::string&& saveArgs)
 {
 	globalSaveFileData.name = std::move(fileName);
 	globalSaveFileData.args = std::move(saveArgs);
+	globalSaveFileData.snapshot = false;
+}
+
+void CGame::QueueSnapshot()
+{
+	const int interval = configHandler->GetInt("SnapshotInterval");
+
+	if (interval <= 0 || gs->frameNum <= 0 || gameSetup->hostDemo)
+		return;
+	if (((gs->frameNum / GAME_SPEED) % interval) != 0)
+		return;
+	// an explicit /save is pending, takes precedence
+	if (!globalSaveFileData.name.empty())
+		return;
+
+	// like a regular save this is written by SpringApp between two frames
+	const int slot = (gs->frameNum / (interval * GAME_SPEED)) % configHandler->GetInt("SnapshotCount");
+
+	globalSaveFileData.name = "Saves/snapshot-" + IntToString(slot) + ".ssf";
+	globalSaveFileData.args.clear();
+	globalSaveFileData.snapshot = true;
 }
 
 
@@ -100,6 +100,7 @@ public:
 	void ParseInputTextGeometry(const std::string& geo);
 
 	void Save(std::string&& fileName, std::string&& saveArgs);
+	void QueueSnapshot();
 
 	void ResizeEvent() override;
 
@@ -441,29 +441,13 @@ void CSelectedUnitsHandlerAI::MakeFormationFrontOrder(Command* c, int playerNum)
 		sortedUnitGroups.clear();
 	}
 
+	BuildFormationGrids();
+
 	// find closest unassigned unit to move for each move command
 	for (size_t i = 0; i < allFrontMoveCommands.size(); i++) {
-		size_t closestUnit = 0;
-		float closestDistSq = std::numeric_limits<float>::infinity();
-		const auto cmdPos = allFrontMoveCommands[i].second.GetPos(0);
-
-		// find closest unit of the unit type selected for this move comamnd
-		for (size_t j = 0; j < unassignedUnits.size(); j++) {
-			const auto& unit = unassignedUnits[j];
-			if (unit.unitDefId == mixedUnitTypes[i]){
-				float curDistSq = unit.pos.SqDistance(cmdPos);
-				if (curDistSq < closestDistSq) {
-					closestUnit = j;
-					closestDistSq = curDistSq;
-				}
-			}
-		}
+		const size_t closestUnit = FindClosestUnassignedUnit(static_cast<int>(mixedUnitTypes[i]), allFrontMoveCommands[i].second.GetPos(0));
 
 		mixedUnitIDs.emplace_back(unassignedUnits[closestUnit].unitId);
-
-		auto& selUnit = unassignedUnits[closestUnit];
-		selUnit = unassignedUnits.back();
-		unassignedUnits.pop_back();
 	}
 
 	for (size_t i = 0; i < allFrontMoveCommands.size(); i++) {
@@ -475,6 +459,197 @@ void CSelectedUnitsHandlerAI::MakeFormationFrontOrder(Command* c, int playerNum)
 }
 
 
+void CSelectedUnitsHandlerAI::BuildFormationGrids()
+{
+	constexpr float MIN_CELL_SIZE = SQUARE_SIZE * 4.0f;
+	constexpr int MAX_GRID_SIZE = 64;
+
+	const size_t numUnits = unassignedUnits.size();
+
+	formationTypeGrids.clear();
+	formationGridUnits.clear();
+	formationGridUnits.resize(numUnits);
+	formationGridCells.clear();
+	formationUnitTaken.clear();
+	formationUnitTaken.resize(numUnits, 0);
+
+	// group by type, keeping the original order among units of the same type
+	for (size_t i = 0; i < numUnits; i++) {
+		formationGridUnits[i] = i;
+	}
+
+	std::stable_sort(formationGridUnits.begin(), formationGridUnits.end(), [&](int a, int b) {
+		return (unassignedUnits[a].unitDefId < unassignedUnits[b].unitDefId);
+	});
+
+	for (size_t i = 0, j = 0; i < numUnits; i = j) {
+		const int unitDefId = unassignedUnits[formationGridUnits[i]].unitDefId;
+
+		float3 mins = { std::numeric_limits<float>::max(), 0.0f, std::numeric_limits<float>::max()};
+		float3 maxs = {std::numeric_limits<float>::lowest(), 0.0f, std::numeric_limits<float>::lowest()};
+
+		for (j = i; j < numUnits && unassignedUnits[formationGridUnits[j]].unitDefId == unitDefId; j++) {
+			const float3& pos = unassignedUnits[formationGridUnits[j]].pos;
+
+			mins.x = std::min(mins.x, pos.x);
+			mins.z = std::min(mins.z, pos.z);
+			maxs.x = std::max(maxs.x, pos.x);
+			maxs.z = std::max(maxs.z, pos.z);
+		}
+
+		FormationTypeGrid& grid = formationTypeGrids.emplace_back();
+
+		const float sizeX = maxs.x - mins.x;
+		const float sizeZ = maxs.z - mins.z;
+
+		// aim for about one unit per cell
+		grid.cellSize = math::sqrt(std::max(sizeX, 1.0f) * std::max(sizeZ, 1.0f) / (j - i));
+		grid.cellSize = std::max(grid.cellSize, MIN_CELL_SIZE);
+		grid.cellSize = std::max(grid.cellSize, std::max(sizeX, sizeZ) / (MAX_GRID_SIZE - 1));
+
+		grid.unitDefId = unitDefId;
+		grid.numRemaining = j - i;
+		grid.numCellsX = std::min(static_cast<int>(sizeX / grid.cellSize) + 1, MAX_GRID_SIZE);
+		grid.numCellsZ = std::min(static_cast<int>(sizeZ / grid.cellSize) + 1, MAX_GRID_SIZE);
+		grid.mins = mins;
+		grid.unitsBeg = i;
+		grid.unitsEnd = j;
+		grid.cellsBeg = formationGridCells.size();
+
+		const auto GetCellIndex = [&](const float3& pos) {
+			const int x = std::clamp(static_cast<int>((pos.x - mins.x) / grid.cellSize), 0, grid.numCellsX - 1);
+			const int z = std::clamp(static_cast<int>((pos.z - mins.z) / grid.cellSize), 0, grid.numCellsZ - 1);
+			return (z * grid.numCellsX + x);
+		};
+
+		// counting sort of this type's units into their cells; walking the units
+		// backwards and decrementing the cell ends leaves the per-cell start offsets
+		// (relative to unitsBeg) and keeps units in ascending index order per cell
+		formationGridCells.resize(grid.cellsBeg + grid.numCellsX * grid.numCellsZ + 1, 0);
+		formationTypeUnits.assign(formationGridUnits.begin() + i, formationGridUnits.begin() + j);
+
+		int* cellOffsets = &formationGridCells[grid.cellsBeg];
+
+		for (const int unitIdx: formationTypeUnits) {
+			cellOffsets[GetCellIndex(unassignedUnits[unitIdx].pos)] += 1;
+		}
+		for (int c = 1, n = grid.numCellsX * grid.numCellsZ; c <= n; c++) {
+			cellOffsets[c] += cellOffsets[c - 1];
+		}
+		for (auto it = formationTypeUnits.rbegin(); it != formationTypeUnits.rend(); ++it) {
+			formationGridUnits[i + (--cellOffsets[GetCellIndex(unassignedUnits[*it].pos)])] = *it;
+		}
+	}
+}
+
+size_t CSelectedUnitsHandlerAI::FindClosestUnassignedUnit(int unitDefId, const float3& pos)
+{
+	// below this many remaining units a plain scan is cheaper than walking mostly emptied cells
+	constexpr int MIN_GRID_SEARCH_UNITS = 16;
+
+	const auto GetTypeGrid = [&](int defId) {
+		return std::lower_bound(formationTypeGrids.begin(), formationTypeGrids.end(), defId, [](const FormationTypeGrid& g, int id) { return (g.unitDefId < id); });
+	};
+
+	auto gridIt = GetTypeGrid(unitDefId);
+
+	if (gridIt == formationTypeGrids.end() || gridIt->unitDefId != unitDefId || gridIt->numRemaining == 0) {
+		// no unit of the wanted type left; take the first remaining one
+		const auto takenIt = std::find(formationUnitTaken.begin(), formationUnitTaken.end(), 0);
+		const size_t unitIdx = std::distance(formationUnitTaken.begin(), takenIt);
+
+		assert(unitIdx < formationUnitTaken.size());
+
+		formationUnitTaken[unitIdx] = 1;
+		GetTypeGrid(unassignedUnits[unitIdx].unitDefId)->numRemaining -= 1;
+		return unitIdx;
+	}
+
+	FormationTypeGrid& grid = *gridIt;
+
+	size_t closestUnit = std::numeric_limits<size_t>::max();
+	float closestDistSq = std::numeric_limits<float>::infinity();
+
+	// ties go to the lowest index so the outcome does not depend on visiting order
+	const auto TestUnits = [&](size_t beg, size_t end) {
+		for (size_t k = beg; k < end; k++) {
+			const size_t unitIdx = formationGridUnits[k];
+
+			if (formationUnitTaken[unitIdx])
+				continue;
+
+			const float curDistSq = unassignedUnits[unitIdx].pos.SqDistance(pos);
+
+			if (curDistSq > closestDistSq)
+				continue;
+			if (curDistSq == closestDistSq && unitIdx > closestUnit)
+				continue;
+
+			closestUnit = unitIdx;
+			closestDistSq = curDistSq;
+		}
+	};
+
+	if (grid.numRemaining <= MIN_GRID_SEARCH_UNITS) {
+		TestUnits(grid.unitsBeg, grid.unitsEnd);
+	} else {
+		const int* cellOffsets = &formationGridCells[grid.cellsBeg];
+
+		const int numCellsX = grid.numCellsX;
+		const int numCellsZ = grid.numCellsZ;
+		const int cx = std::clamp(static_cast<int>((pos.x - grid.mins.x) / grid.cellSize), 0, numCellsX - 1);
+		const int cz = std::clamp(static_cast<int>((pos.z - grid.mins.z) / grid.cellSize), 0, numCellsZ - 1);
+
+		const auto TestCell = [&](int x, int z) {
+			if (x < 0 || z < 0 || x >= numCellsX || z >= numCellsZ)
+				return;
+
+			const int c = z * numCellsX + x;
+			TestUnits(grid.unitsBeg + cellOffsets[c], grid.unitsBeg + cellOffsets[c + 1]);
+		};
+		// squared distance from pos to the cell-rectangle [x0, x1) x [z0, z1)
+		const auto GetRectDistSq = [&](int x0, int z0, int x1, int z1) {
+			const float dx = std::max(0.0f, std::max((grid.mins.x + x0 * grid.cellSize) - pos.x, pos.x - (grid.mins.x + x1 * grid.cellSize)));
+			const float dz = std::max(0.0f, std::max((grid.mins.z + z0 * grid.cellSize) - pos.z, pos.z - (grid.mins.z + z1 * grid.cellSize)));
+			return (dx * dx + dz * dz);
+		};
+
+		// visit rings of cells around pos until nothing outside the searched
+		// block can be closer than the best candidate found so far
+		for (int r = 0; ; r++) {
+			if (r == 0) {
+				TestCell(cx, cz);
+			} else {
+				for (int x = cx - r; x <= cx + r; x++) {
+					TestCell(x, cz - r);
+					TestCell(x, cz + r);
+				}
+				for (int z = cz - r + 1; z <= cz + r - 1; z++) {
+					TestCell(cx - r, z);
+					TestCell(cx + r, z);
+				}
+			}
+
+			float minOuterDistSq = std::numeric_limits<float>::infinity();
+
+			if ((cx - r) > 0            ) minOuterDistSq = std::min(minOuterDistSq, GetRectDistSq(         0,          0,    cx - r, numCellsZ));
+			if ((cx + r) < numCellsX - 1) minOuterDistSq = std::min(minOuterDistSq, GetRectDistSq(cx + r + 1,          0, numCellsX, numCellsZ));
+			if ((cz - r) > 0            ) minOuterDistSq = std::min(minOuterDistSq, GetRectDistSq(         0,          0, numCellsX,    cz - r));
+			if ((cz + r) < numCellsZ - 1) minOuterDistSq = std::min(minOuterDistSq, GetRectDistSq(         0, cz + r + 1, numCellsX, numCellsZ));
+
+			if (closestDistSq <= minOuterDistSq)
+				break;
+		}
+	}
+
+	assert(closestUnit < formationUnitTaken.size());
+
+	formationUnitTaken[closestUnit] = 1;
+	grid.numRemaining -= 1;
+	return closestUnit;
+}
+
+
 void CSelectedUnitsHandlerAI::CreateUnitOrder(std::vector< std::pair<float, int> >& out, int playerNum)
 {
 	const std::vector<int>& playerUnitIDs = selectedUnitsHandler.netSelected[playerNum];
@@ -6,6 +6,7 @@
 #include "Sim/Units/CommandAI/Command.h"
 #include "System/float3.h"
 
+#include <cstdint>
 #include <vector>
 
 class CUnit;
@@ -32,6 +33,9 @@ private:
 
 	float3 LastQueuePosition(const CUnit* unit);
 
+	void BuildFormationGrids();
+	size_t FindClosestUnassignedUnit(int unitDefId, const float3& pos);
+
 private:
 	float3 groupCenterCoor;
 	float3 formationCenterPos;
@@ -72,6 +76,28 @@ private:
 
 	std::vector<UnitReference> unassignedUnits;
 
+	// per-unitdef grid over unassignedUnits, used to find the closest
+	// unit for each formation slot without scanning the whole selection
+	struct FormationTypeGrid {
+		int unitDefId = -1;
+		int numRemaining = 0;
+		int numCellsX = 0;
+		int numCellsZ = 0;
+
+		float cellSize = 0.0f;
+		float3 mins;
+
+		size_t unitsBeg = 0; // into formationGridUnits
+		size_t unitsEnd = 0;
+		size_t cellsBeg = 0; // into formationGridCells, (numCellsX * numCellsZ + 1) offsets
+	};
+
+	std::vector<FormationTypeGrid> formationTypeGrids;
+	std::vector<int> formationGridUnits; // indices into unassignedUnits, grouped by type and cell
+	std::vector<int> formationGridCells;
+	std::vector<int> formationTypeUnits;
+	std::vector<uint8_t> formationUnitTaken;
+
 	std::vector<int> targetUnitIDs;
 };
 
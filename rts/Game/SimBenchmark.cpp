@@ -0,0 +1,303 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+
+#include "SimBenchmark.h"
+#include "CommandMessage.h"
+#include "GameSetup.h"
+#include "GameVersion.h"
+#include "GlobalUnsynced.h"
+#include "Net/GameServer.h"
+#include "Net/Protocol/NetProtocol.h"
+#include "Sim/Misc/GlobalConstants.h"
+#include "System/SpringHash.h"
+#include "System/StringUtil.h"
+#include "System/TimeProfiler.h"
+#include "System/Config/ConfigHandler.h"
+#include "System/Log/ILog.h"
+
+#include "lib/fmt/format.h"
+
+CONFIG(std::string, SimBenchmarkFile).defaultValue("").description("If set, runs the loaded demo or start-script at maximum speed and writes sim timings and sync-checksum info as JSON to this file before quitting.");
+CONFIG(int, SimBenchmarkFrames).defaultValue(0).minimumValue(0).description("Number of sim-frames after which a sim benchmark (see SimBenchmarkFile) ends, 0 runs until the demo or game ends.");
+
+
+// wall-clock milliseconds without sim progress after the server's demo reader is exhausted
+static constexpr float DEMO_END_IDLE_MSECS = 2000.0f;
+
+CSimBenchmark simBenchmark;
+
+
+static std::string EscapeJSON(const std::string& s)
+{
+	std::string r;
+	r.reserve(s.size());
+
+	for (const char c: s) {
+		switch (c) {
+			case '"' : { r += "\\\""; } break;
+			case '\\': { r += "\\\\"; } break;
+			case '\n': { r += "\\n" ; } break;
+			case '\t': { r += "\\t" ; } break;
+			default: {
+				if (static_cast<unsigned char>(c) >= 0x20)
+					r += c;
+			} break;
+		}
+	}
+
+	return r;
+}
+
+static float GetPercentile(std::vector<float>& values, float p)
+{
+	if (values.empty())
+		return 0.0f;
+
+	const auto nth = values.begin() + std::min(static_cast<size_t>(values.size() * p), values.size() - 1);
+
+	std::nth_element(values.begin(), nth, values.end());
+	return *nth;
+}
+
+
+
+void CSimBenchmark::Init(bool replayingDemo_)
+{
+	reportFile = configHandler->GetString("SimBenchmarkFile");
+	maxFrames = configHandler->GetInt("SimBenchmarkFrames");
+
+	frameTimes.clear();
+	baseTimerTotals.clear();
+	frameChecksums.clear();
+
+	startFrame = 0;
+	lastFrame = 0;
+
+	runChecksum = 0;
+	numSyncChecks = 0;
+	numDesyncs = 0;
+	firstDesyncFrame = -1;
+
+	enabled = !reportFile.empty();
+	finished = false;
+	replayingDemo = replayingDemo_;
+
+	if (!enabled)
+		return;
+
+	LOG("[SimBenchmark::%s] benchmarking %s, report will be written to \"%s\"", __func__, replayingDemo? "demo": "game", reportFile.c_str());
+
+	// regular (non-special) timers only record while the profiler is enabled
+	CTimeProfiler::GetInstance().SetEnabled(true);
+}
+
+void CSimBenchmark::Kill()
+{
+	if (enabled && !finished)
+		Finish("aborted");
+
+	enabled = false;
+}
+
+
+void CSimBenchmark::StartPlaying()
+{
+	if (!enabled)
+		return;
+
+	CTimeProfiler& profiler = CTimeProfiler::GetInstance();
+
+	// loading also runs timed code; only count what happens from here on
+	profiler.Update();
+
+	for (const auto& p: profiler.GetSortedProfiles()) {
+		baseTimerTotals[p.first] = p.second.total;
+	}
+
+	startTime = spring_gettime();
+	lastFrameTime = startTime;
+
+	if (replayingDemo) {
+		// let the server push out the entire demo at once, the client
+		// then runs the queued frames as fast as it can consume them
+		clientNet->Send(CommandMessage(fmt::format("skip f{}", INT_MAX), gu->myPlayerNum).Pack());
+	} else {
+		// live game; speed is still bounded by the server's CPU-usage control
+		clientNet->Send(CommandMessage("setmaxspeed 1000", gu->myPlayerNum).Pack());
+		clientNet->Send(CBaseNetProtocol::Get().SendUserSpeed(gu->myPlayerNum, 1000.0f));
+	}
+}
+
+void CSimBenchmark::Update()
+{
+	if (!enabled || finished || !replayingDemo)
+		return;
+	if (gameServer == nullptr || gameServer->GetDemoReader() != nullptr)
+		return;
+
+	// all demo data has been sent, wait for the queued frames to drain
+	if ((spring_gettime() - lastFrameTime).toMilliSecsf() < DEMO_END_IDLE_MSECS)
+		return;
+
+	Finish("demo end");
+}
+
+
+void CSimBenchmark::SimFrame(int frameNum, spring_time simFrameTime)
+{
+	if (!enabled || finished)
+		return;
+
+	if (frameTimes.empty())
+		startFrame = frameNum;
+
+	frameTimes.push_back(simFrameTime.toMilliSecsf());
+
+	lastFrame = frameNum;
+	lastFrameTime = spring_gettime();
+
+	if (maxFrames > 0 && frameTimes.size() >= static_cast<size_t>(maxFrames))
+		Finish("frame limit");
+}
+
+void CSimBenchmark::SyncChecksum(int frameNum, uint32_t checksum)
+{
+	if (!enabled || finished)
+		return;
+
+	runChecksum = spring::LiteHash(checksum, runChecksum);
+
+	if ((frameNum % GAME_SPEED) == 0)
+		frameChecksums.emplace_back(frameNum, checksum);
+}
+
+void CSimBenchmark::SyncResponse(int frameNum, bool match)
+{
+	if (!enabled || finished)
+		return;
+
+	numSyncChecks += 1;
+
+	if (match)
+		return;
+
+	numDesyncs += 1;
+
+	if (firstDesyncFrame == -1)
+		firstDesyncFrame = frameNum;
+}
+
+
+void CSimBenchmark::Finish(const char* reason)
+{
+	if (!enabled || finished)
+		return;
+
+	finished = true;
+
+	if (WriteReport(reason)) {
+		LOG("[SimBenchmark::%s] %s after %u frames, report written to \"%s\"", __func__, reason, static_cast<uint32_t>(frameTimes.size()), reportFile.c_str());
+	} else {
+		LOG_L(L_ERROR, "[SimBenchmark::%s] failed to write report to \"%s\"", __func__, reportFile.c_str());
+	}
+
+	gu->globalQuit = true;
+}
+
+bool CSimBenchmark::WriteReport(const char* reason) const
+{
+	CTimeProfiler& profiler = CTimeProfiler::GetInstance();
+	profiler.Update();
+
+	std::vector<float> sortedTimes = frameTimes;
+
+	const size_t numFrames = frameTimes.size();
+	const float wallSecs = (spring_gettime() - startTime).toSecsf();
+
+	float sumTime = 0.0f;
+	float maxTime = 0.0f;
+
+	for (const float t: frameTimes) {
+		sumTime += t;
+		maxTime = std::max(maxTime, t);
+	}
+
+	std::string json;
+	json.reserve(4096);
+
+	json += "{\n";
+	json += fmt::format("\t\"engine\": \"{}\",\n", EscapeJSON(SpringVersion::GetFull()));
+	json += fmt::format("\t\"game\": \"{}\",\n", EscapeJSON(gameSetup->modName));
+	json += fmt::format("\t\"map\": \"{}\",\n", EscapeJSON(gameSetup->mapName));
+	json += fmt::format("\t\"demo\": \"{}\",\n", EscapeJSON(replayingDemo? gameSetup->demoName: ""));
+	json += fmt::format("\t\"reason\": \"{}\",\n", reason);
+
+	json += "\t\"frames\": {\n";
+	json += fmt::format("\t\t\"first\": {},\n", startFrame);
+	json += fmt::format("\t\t\"last\": {},\n", lastFrame);
+	json += fmt::format("\t\t\"count\": {},\n", numFrames);
+	json += fmt::format("\t\t\"wallTimeSecs\": {:.3f},\n", wallSecs);
+	json += fmt::format("\t\t\"framesPerSec\": {:.2f},\n", (wallSecs > 0.0f)? (numFrames / wallSecs): 0.0f);
+	json += fmt::format("\t\t\"totalMs\": {:.3f},\n", sumTime);
+	json += fmt::format("\t\t\"meanMs\": {:.4f},\n", (numFrames > 0)? (sumTime / numFrames): 0.0f);
+	json += fmt::format("\t\t\"p50Ms\": {:.4f},\n", GetPercentile(sortedTimes, 0.50f));
+	json += fmt::format("\t\t\"p95Ms\": {:.4f},\n", GetPercentile(sortedTimes, 0.95f));
+	json += fmt::format("\t\t\"p99Ms\": {:.4f},\n", GetPercentile(sortedTimes, 0.99f));
+	json += fmt::format("\t\t\"maxMs\": {:.4f}\n", maxTime);
+	json += "\t},\n";
+
+	json += "\t\"sync\": {\n";
+	#ifdef SYNCCHECK
+	json += "\t\t\"enabled\": true,\n";
+	#else
+	json += "\t\t\"enabled\": false,\n";
+	#endif
+	json += fmt::format("\t\t\"checksum\": \"{:08x}\",\n", runChecksum);
+	json += fmt::format("\t\t\"demoChecks\": {},\n", numSyncChecks);
+	json += fmt::format("\t\t\"demoDesyncs\": {},\n", numDesyncs);
+	json += fmt::format("\t\t\"firstDesyncFrame\": {},\n", firstDesyncFrame);
+	json += "\t\t\"frameChecksums\": {";
+
+	{
+		const char* sep = "\n";
+
+		for (const auto& p: frameChecksums) {
+			json += fmt::format("{}\t\t\t\"{}\": \"{:08x}\"", sep, p.first, p.second);
+			sep = ",\n";
+		}
+	}
+
+	json += "\n\t\t}\n";
+	json += "\t},\n";
+
+	json += "\t\"timers\": {";
+
+	{
+		const char* sep = "\n";
+
+		for (const auto& p: profiler.GetSortedProfiles()) {
+			const auto it = baseTimerTotals.find(p.first);
+			const spring_time baseTotal = (it != baseTimerTotals.end())? it->second: spring_notime;
+			const float totalMs = (p.second.total - baseTotal).toMilliSecsf();
+
+			json += fmt::format("{}\t\t\"{}\": {{\"totalMs\": {:.3f}, \"perFrameMs\": {:.4f}}}", sep, EscapeJSON(p.first), totalMs, (numFrames > 0)? (totalMs / numFrames): 0.0f);
+			sep = ",\n";
+		}
+	}
+
+	json += "\n\t}\n";
+	json += "}\n";
+
+	FILE* file = fopen(reportFile.c_str(), "w");
+
+	if (file == nullptr)
+		return false;
+
+	const bool ret = (fwrite(json.data(), json.size(), 1, file) == 1);
+
+	fclose(file);
+	return ret;
+}
@@ -0,0 +1,76 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef SIM_BENCHMARK_H
+#define SIM_BENCHMARK_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "System/Misc/SpringTime.h"
+#include "System/UnorderedMap.hpp"
+
+/**
+ * Unattended sim-throughput benchmark, enabled by SimBenchmarkFile (or the
+ * --sim-benchmark command-line switch). Runs the loaded demo or start-script
+ * as fast as the local sim allows, and once the demo is exhausted, the game
+ * ends or SimBenchmarkFrames frames have passed writes a JSON report with the
+ * frame-time distribution, CTimeProfiler totals and the sync-checksum state
+ * (including the checksum of every GAME_SPEED'th frame, so runs starting at
+ * different frames such as resumed snapshots can be compared) to
+ * SimBenchmarkFile before quitting.
+ *
+ * Meant to be used with engine-headless, see tools/benchmark/sim_benchmark.sh.
+ */
+class CSimBenchmark {
+public:
+	void Init(bool replayingDemo);
+	void Kill();
+
+	bool IsEnabled() const { return enabled; }
+	bool IsReplayingDemo() const { return (enabled && replayingDemo); }
+
+	/// requests maximum game speed from the (local) server; called by CGame::StartPlaying
+	void StartPlaying();
+	/// polls for the end of the demo; called by CGame::Update
+	void Update();
+
+	void SimFrame(int frameNum, spring_time simFrameTime);
+	void SyncChecksum(int frameNum, uint32_t checksum);
+	void SyncResponse(int frameNum, bool match);
+
+	void Finish(const char* reason);
+
+private:
+	bool WriteReport(const char* reason) const;
+
+private:
+	std::string reportFile;
+
+	std::vector<float> frameTimes;
+	spring::unordered_map<std::string, spring_time> baseTimerTotals;
+
+	spring_time startTime;
+	spring_time lastFrameTime;
+
+	int startFrame = 0;
+	int lastFrame = 0;
+	int maxFrames = 0;
+
+	/// <frameNum, checksum> of every GAME_SPEED'th frame
+	std::vector<std::pair<int, uint32_t>> frameChecksums;
+
+	uint32_t runChecksum = 0;
+	uint32_t numSyncChecks = 0;
+	uint32_t numDesyncs = 0;
+	int firstDesyncFrame = -1;
+
+	bool enabled = false;
+	bool finished = false;
+	bool replayingDemo = false;
+};
+
+extern CSimBenchmark simBenchmark;
+
+#endif // SIM_BENCHMARK_H
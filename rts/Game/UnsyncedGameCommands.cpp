@@ -1420,6 +1420,34 @@ public:
 	}
 };
 
+class ProfileRecordActionExecutor : public IUnsyncedActionExecutor {
+public:
+	ProfileRecordActionExecutor() : IUnsyncedActionExecutor(
+		"ProfileRecord",
+		"Start recording profiler samples to the given (or configured) ring-buffer file, or stop with argument 0"
+	) {}
+
+	bool Execute(const UnsyncedAction& action) const final {
+		auto& profiler = CTimeProfiler::GetInstance();
+
+		const std::string& args = action.GetArgs();
+		const std::string file = args.empty()? configHandler->GetString("ProfileRecordFile"): args;
+
+		if (args == "0" || (args.empty() && profiler.IsRecording())) {
+			profiler.StopRecording();
+			LOG("[%s] profile recording stopped", __func__);
+			return true;
+		}
+
+		if (file.empty()) {
+			LOG_L(L_WARNING, "[%s] no file given and ProfileRecordFile is not set", __func__);
+			return false;
+		}
+
+		return (profiler.StartRecording(file, configHandler->GetInt("ProfileRecordSamples")));
+	}
+};
+
 class DebugCubeMapActionExecutor : public IUnsyncedActionExecutor {
 public:
 	DebugCubeMapActionExecutor() : IUnsyncedActionExecutor("DebugCubeMap", "Use debug cubemap texture instead of the sky") {
@@ -3704,6 +3732,7 @@ void UnsyncedGameCommands::AddDefaultActionExecutors()
 	AddActionExecutor(AllocActionExecutor<TrackModeActionExecutor>());
 	AddActionExecutor(AllocActionExecutor<PauseActionExecutor>());
 	AddActionExecutor(AllocActionExecutor<DebugActionExecutor>());
+	AddActionExecutor(AllocActionExecutor<ProfileRecordActionExecutor>());
 	AddActionExecutor(AllocActionExecutor<DebugCubeMapActionExecutor>());
 	AddActionExecutor(AllocActionExecutor<DrawSkyActionExecutor>());
 	AddActionExecutor(AllocActionExecutor<DebugGLActionExecutor>());
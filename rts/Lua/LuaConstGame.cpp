@@ -210,6 +210,7 @@ bool LuaConstGame::PushEntries(lua_State* L)
 		LuaPushNamedNumber(L, "paralyzeDeclineRate", modInfo.paralyzeDeclineRate);
 
 		LuaPushNamedBool  (L, "allowEnginePlayerlist", modInfo.allowEnginePlayerlist);
+		LuaPushNamedNumber(L, "unitEconomySystem", modInfo.unitEconomySystem);
 	}
 
 	if (archiveScanner != nullptr && mapInfo != nullptr) {
@@ -31,6 +31,8 @@
 #include "Sim/Features/FeatureDef.h"
 #include "Sim/Units/Unit.h"
 #include "Sim/Units/UnitDef.h"
+#include "Sim/Units/UnitDefHandler.h"
+#include "Sim/Units/UnitHandler.h"
 #include "Sim/Weapons/Weapon.h"
 #include "Sim/Weapons/WeaponDef.h"
 #include "System/creg/SerializeLuaState.h"
@@ -1246,6 +1248,76 @@ void CLuaHandle::UnitDamaged(
 	RunCallInTraceback(L, cmdStr, argCount, 0, traceBack.GetErrFuncIdx(), false);
 }
 
+/*** Called at the end of each game frame with all UnitDamaged events of that frame.
+ *
+ * @function UnitDamagedBatch
+ *
+ * Every argument after count is an array holding one field per event, in the
+ * same order as the arguments of UnitDamaged. Attacker entries are nil if the
+ * attacker is not visible or no longer exists. Only events passing the filter
+ * set through `Script.SetBatchFilter` are included.
+ *
+ * @number count
+ * @tparam {number,...} unitIDs
+ * @tparam {number,...} unitDefIDs
+ * @tparam {number,...} unitTeams
+ * @tparam {number,...} damages
+ * @tparam {bool,...} paralyzers
+ * @tparam {number,...} weaponDefIDs
+ * @tparam {number,...} projectileIDs
+ * @tparam {number,...} attackerIDs
+ * @tparam {number,...} attackerDefIDs
+ * @tparam {number,...} attackerTeams
+ */
+void CLuaHandle::UnitDamagedBatch(const std::vector<SUnitDamagedEvent>& events)
+{
+	LUA_CALL_IN_CHECK(L);
+	luaL_checkstack(L, 13, __func__);
+
+	static const LuaHashString cmdStr(__func__);
+	const LuaUtils::ScopedDebugTraceBack traceBack(L);
+
+	if (!cmdStr.GetGlobalFunc(L))
+		return;
+
+	static constexpr int argCount = 1 + 7 + 3;
+
+	const int count = static_cast<int>(events.size());
+
+	lua_pushnumber(L, count);
+
+	// one array per field rather than one table per event
+	const int tblIdx = lua_gettop(L) + 1;
+
+	for (int i = 1; i < argCount; i++) {
+		lua_createtable(L, count, 0);
+	}
+
+	for (int i = 0; i < count; i++) {
+		const SUnitDamagedEvent& e = events[i];
+
+		lua_pushnumber(L, e.unitID);       lua_rawseti(L, tblIdx + 0, i + 1);
+		lua_pushnumber(L, e.unitDefID);    lua_rawseti(L, tblIdx + 1, i + 1);
+		lua_pushnumber(L, e.unitTeam);     lua_rawseti(L, tblIdx + 2, i + 1);
+		lua_pushnumber(L, e.damage);       lua_rawseti(L, tblIdx + 3, i + 1);
+		lua_pushboolean(L, e.paralyzer);   lua_rawseti(L, tblIdx + 4, i + 1);
+		lua_pushnumber(L, e.weaponDefID);  lua_rawseti(L, tblIdx + 5, i + 1);
+		lua_pushnumber(L, e.projectileID); lua_rawseti(L, tblIdx + 6, i + 1);
+
+		const CUnit* attacker = (e.attackerID >= 0)? unitHandler.GetUnit(e.attackerID): nullptr;
+
+		if (attacker == nullptr || !LuaUtils::IsUnitVisible(L, attacker))
+			continue;
+
+		lua_pushnumber(L, attacker->id);             lua_rawseti(L, tblIdx + 7, i + 1);
+		LuaUtils::PushAttackerDef(L, *attacker);     lua_rawseti(L, tblIdx + 8, i + 1);
+		lua_pushnumber(L, attacker->team);           lua_rawseti(L, tblIdx + 9, i + 1);
+	}
+
+	// call the routine
+	RunCallInTraceback(L, cmdStr, argCount, 0, traceBack.GetErrFuncIdx(), false);
+}
+
 /*** Called when a unit changes its stun status.
  *
  * @function UnitStunned
@@ -2022,6 +2094,100 @@ void CLuaHandle::ProjectileDestroyed(const CProjectile* p)
 	RunCallIn(L, cmdStr, 3, 0);
 }
 
+// pushes count plus the proIDs, ownerIDs and weaponDefIDs arrays of all watched events
+static void PushProjectileBatch(lua_State* L, const std::vector<SProjectileEvent>& events, const std::vector<bool>& watchProjectileDefs)
+{
+	lua_pushnumber(L, 0);
+
+	const int cntIdx = lua_gettop(L);
+	const int tblIdx = cntIdx + 1;
+
+	lua_createtable(L, events.size(), 0);
+	lua_createtable(L, events.size(), 0);
+	lua_createtable(L, events.size(), 0);
+
+	int count = 0;
+
+	for (const SProjectileEvent& e: events) {
+		// same watch rules as Projectile{Created,Destroyed}
+		if (e.piece && !watchProjectileDefs[watchProjectileDefs.size() - 1])
+			continue;
+		if (!e.piece && (e.weaponDefID < 0 || !watchProjectileDefs[e.weaponDefID]))
+			continue;
+
+		count += 1;
+
+		lua_pushnumber(L, e.projectileID); lua_rawseti(L, tblIdx + 0, count);
+		lua_pushnumber(L, e.ownerID);      lua_rawseti(L, tblIdx + 1, count);
+		lua_pushnumber(L, e.weaponDefID);  lua_rawseti(L, tblIdx + 2, count);
+	}
+
+	lua_pushnumber(L, count);
+	lua_replace(L, cntIdx);
+}
+
+
+/*** Called at the end of each game frame with all ProjectileCreated events of that frame.
+ *
+ * @function ProjectileCreatedBatch
+ *
+ * Subject to the same Script.SetWatchWeapon rules as ProjectileCreated, and to
+ * the owner filter set through `Script.SetBatchFilter`.
+ *
+ * @number count
+ * @tparam {number,...} proIDs
+ * @tparam {number,...} proOwnerIDs
+ * @tparam {number,...} weaponDefIDs
+ */
+void CLuaHandle::ProjectileCreatedBatch(const std::vector<SProjectileEvent>& events)
+{
+	// if empty, we are not a LuaHandleSynced
+	if (watchProjectileDefs.empty())
+		return;
+
+	LUA_CALL_IN_CHECK(L);
+	luaL_checkstack(L, 6, __func__);
+
+	static const LuaHashString cmdStr(__func__);
+
+	if (!cmdStr.GetGlobalFunc(L))
+		return;
+
+	PushProjectileBatch(L, events, watchProjectileDefs);
+
+	// call the routine
+	RunCallIn(L, cmdStr, 4, 0);
+}
+
+
+/*** Called at the end of each game frame with all ProjectileDestroyed events of that frame.
+ *
+ * @function ProjectileDestroyedBatch
+ * @number count
+ * @tparam {number,...} proIDs
+ * @tparam {number,...} ownerIDs
+ * @tparam {number,...} proWeaponDefIDs
+ */
+void CLuaHandle::ProjectileDestroyedBatch(const std::vector<SProjectileEvent>& events)
+{
+	// if empty, we are not a LuaHandleSynced
+	if (watchProjectileDefs.empty())
+		return;
+
+	LUA_CALL_IN_CHECK(L);
+	luaL_checkstack(L, 6, __func__);
+
+	static const LuaHashString cmdStr(__func__);
+
+	if (!cmdStr.GetGlobalFunc(L))
+		return;
+
+	PushProjectileBatch(L, events, watchProjectileDefs);
+
+	// call the routine
+	RunCallIn(L, cmdStr, 4, 0);
+}
+
 /******************************************************************************/
 
 /*** Called when an explosion occurs.
@@ -3641,6 +3807,7 @@ bool CLuaHandle::AddBasicCalls(lua_State* L)
 		HSTR_PUSH_CFUNC(L, "GetCallInList",   CallOutGetCallInList);
 		HSTR_PUSH_CFUNC(L, "DelayByFrames",   CallOutDelayByFrames);
 		HSTR_PUSH_CFUNC(L, "IsEngineMinVersion", CallOutIsEngineMinVersion);
+		HSTR_PUSH_CFUNC(L, "SetBatchFilter",  CallOutSetBatchFilter);
 		// special team constants
 		HSTR_PUSH_NUMBER(L, "NO_ACCESS_TEAM",  CEventClient::NoAccessTeam);
 		HSTR_PUSH_NUMBER(L, "ALL_ACCESS_TEAM", CEventClient::AllAccessTeam);
@@ -3686,6 +3853,47 @@ int CLuaHandle::CallOutGetFullRead(lua_State* L)
 }
 
 
+/***
+ * @function Script.SetBatchFilter
+ *
+ * Restricts the *Batch call-ins of this handle to events concerning units
+ * (for projectiles: owners) of the listed unitDefs and teams. Passing nil
+ * for either argument removes that filter.
+ *
+ * @tparam[opt] {number,...} unitDefIDs
+ * @tparam[opt] {number,...} teamIDs
+ * @treturn nil
+ */
+int CLuaHandle::CallOutSetBatchFilter(lua_State* L)
+{
+	const auto ParseIDs = [L](int argIdx, size_t numIDs) {
+		std::vector<bool> ids;
+
+		if (!lua_istable(L, argIdx))
+			return ids;
+
+		ids.resize(numIDs, false);
+
+		for (lua_pushnil(L); lua_next(L, argIdx) != 0; lua_pop(L, 1)) {
+			const int id = luaL_checkint(L, -1);
+
+			if (id < 0 || id >= static_cast<int>(numIDs))
+				continue;
+
+			ids[id] = true;
+		}
+
+		return ids;
+	};
+
+	std::vector<bool> unitDefs = ParseIDs(1, unitDefHandler->NumUnitDefs() + 1);
+	std::vector<bool> teams = ParseIDs(2, teamHandler.ActiveTeams());
+
+	GetHandle(L)->SetBatchFilter(std::move(unitDefs), std::move(teams));
+	return 0;
+}
+
+
 int CLuaHandle::CallOutGetCtrlTeam(lua_State* L)
 {
 	lua_pushnumber(L, GetHandleCtrlTeam(L));
@@ -140,6 +140,7 @@ class CLuaHandle : public CEventClient
 			int projectileID,
 			bool paralyzer
 		) override;
+		void UnitDamagedBatch(const std::vector<SUnitDamagedEvent>& events) override;
 		void UnitStunned(const CUnit* unit, bool stunned) override;
 		void UnitExperience(const CUnit* unit, float oldExperience) override;
 		void UnitHarvestStorageFull(const CUnit* unit) override;
@@ -182,6 +183,8 @@ class CLuaHandle : public CEventClient
 
 		void ProjectileCreated(const CProjectile* p) override;
 		void ProjectileDestroyed(const CProjectile* p) override;
+		void ProjectileCreatedBatch(const std::vector<SProjectileEvent>& events) override;
+		void ProjectileDestroyedBatch(const std::vector<SProjectileEvent>& events) override;
 
 		bool Explosion(int weaponID, int projectileID, const float3& pos, const CUnit* owner) override;
 
@@ -353,6 +356,7 @@ class CLuaHandle : public CEventClient
 		static int CallOutUpdateCallIn(lua_State* L);
 		static int CallOutIsEngineMinVersion(lua_State* L);
 		static int CallOutDelayByFrames(lua_State* L);
+		static int CallOutSetBatchFilter(lua_State* L);
 
 	public: // static
 #if (!defined(UNITSYNC) && !defined(DEDICATED))
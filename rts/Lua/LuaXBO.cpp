@@ -49,15 +49,18 @@ bool LuaXBOs::PushEntries(lua_State* L)
 		),
 		"InstanceDataFromUnitIDs", sol::overload(
 			sol::resolve<size_t(int, int, sol::optional<int>)>(&LuaXBOImpl::InstanceDataFromUnitIDs),
-			sol::resolve<size_t(const sol::stack_table&, int, sol::optional<int>)>(&LuaXBOImpl::InstanceDataFromUnitIDs)
+			sol::resolve<size_t(const sol::stack_table&, int, sol::optional<int>)>(&LuaXBOImpl::InstanceDataFromUnitIDs),
+			sol::resolve<size_t(std::string_view, int, sol::optional<int>)>(&LuaXBOImpl::InstanceDataFromUnitIDs)
 		),
 		"InstanceDataFromFeatureIDs", sol::overload(
 			sol::resolve<size_t(int, int, sol::optional<int>)>(&LuaXBOImpl::InstanceDataFromFeatureIDs),
-			sol::resolve<size_t(const sol::stack_table&, int, sol::optional<int>)>(&LuaXBOImpl::InstanceDataFromFeatureIDs)
+			sol::resolve<size_t(const sol::stack_table&, int, sol::optional<int>)>(&LuaXBOImpl::InstanceDataFromFeatureIDs),
+			sol::resolve<size_t(std::string_view, int, sol::optional<int>)>(&LuaXBOImpl::InstanceDataFromFeatureIDs)
 		),
 		"MatrixDataFromProjectileIDs", sol::overload(
 			sol::resolve<size_t(int, int, sol::optional<int>)>(&LuaXBOImpl::MatrixDataFromProjectileIDs),
-			sol::resolve<size_t(const sol::stack_table&, int, sol::optional<int>)>(&LuaXBOImpl::MatrixDataFromProjectileIDs)
+			sol::resolve<size_t(const sol::stack_table&, int, sol::optional<int>)>(&LuaXBOImpl::MatrixDataFromProjectileIDs),
+			sol::resolve<size_t(std::string_view, int, sol::optional<int>)>(&LuaXBOImpl::MatrixDataFromProjectileIDs)
 		),
 
 		"BindBufferRange", &LuaXBOImpl::BindBufferRange,
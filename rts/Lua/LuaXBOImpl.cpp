@@ -78,6 +78,36 @@ namespace {
 			LuaUtils::SolLuaError("[LuaXBOImpl::%s] Buffer definition is invalid. Did you succesfully call :Define()?", func);
 		}
 	}
+
+	// view over a string of packed native-endian int32 IDs, e.g. as produced by VFS.PackS32
+	class PackedIDs {
+	public:
+		class Iterator {
+		public:
+			Iterator(const char* ptr_): ptr{ ptr_ } {}
+
+			int operator*() const { int32_t id; memcpy(&id, ptr, sizeof(id)); return id; }
+			Iterator& operator++() { ptr += sizeof(int32_t); return *this; }
+			bool operator!=(const Iterator& other) const { return ptr != other.ptr; }
+		private:
+			const char* ptr;
+		};
+	public:
+		PackedIDs(std::string_view data_, const char* func)
+			: data{ data_ }
+		{
+			if (data.size() % sizeof(int32_t) != 0)
+				LuaUtils::SolLuaError("[LuaXBOImpl::%s] Packed IDs string size (%u) is not a multiple of %u", func, static_cast<uint32_t>(data.size()), static_cast<uint32_t>(sizeof(int32_t)));
+		}
+
+		size_t size() const { return data.size() / sizeof(int32_t); }
+		int operator[](size_t i) const { return *Iterator(data.data() + i * sizeof(int32_t)); }
+
+		Iterator begin() const { return Iterator(data.data()); }
+		Iterator end() const { return Iterator(data.data() + size() * sizeof(int32_t)); }
+	private:
+		std::string_view data;
+	};
 }
 
 inline void LuaXBOImpl::InstanceBufferCheck(int attrID, const char* func)
@@ -958,18 +988,40 @@ size_t LuaXBOImpl::MatrixDataFromProjectileIDsImpl(const Iterable& ids, int attr
 	if (idsSize > elementsCount - elemOffset)
 		LuaUtils::SolLuaError("[LuaXBOImpl::%s] Too many elements in Lua table", func);
 
-	static std::vector<float> matDataVec;
-	matDataVec.resize(16 * idsSize); //16 floats (matrix) per projectile id
-
-	size_t idx = 0;
-	for (const auto id : ids) {
-		const CProjectile* p = LuaUtils::SolIdToObject<CProjectile>(id, __func__);
+	const auto getTransformMatrix = [func](int id) {
+		const CProjectile* p = LuaUtils::SolIdToObject<CProjectile>(id, func);
 		const CWeaponProjectile* wp = p->weapon ? static_cast<const CWeaponProjectile*>(p) : nullptr;
 		const bool doOffset = wp && wp->GetProjectileType() == WEAPON_MISSILE_PROJECTILE;
 
-		const CMatrix44f trMat = projectileDrawer->CanDrawProjectile(p, -1) ?
+		return projectileDrawer->CanDrawProjectile(p, -1) ?
 			p->GetTransformMatrix(doOffset) :
 			CMatrix44f::Zero();
+	};
+
+	// the common layouts keep all 16 floats adjacent within an element, no per-attribute conversion needed
+	bool contiguous = true;
+	if (attr0.type == GL_FLOAT) {
+		for (int i = 1; i <= 3; ++i) {
+			contiguous &= (bufferAttribDefs[attrID + i].pointer == attr0.pointer + i * static_cast<GLsizei>(4 * sizeof(float)));
+		}
+	}
+
+	if (contiguous) {
+		auto idIter = ids.begin();
+
+		return WriteAttribDirect(elemOffset, idsSize, attr0.pointer, [&](size_t, uint8_t* attrData) {
+			const CMatrix44f trMat = getTransformMatrix(*idIter);
+			memcpy(attrData, &trMat, sizeof(CMatrix44f));
+			++idIter;
+		});
+	}
+
+	static std::vector<float> matDataVec;
+	matDataVec.resize(16 * idsSize); //16 floats (matrix) per projectile id
+
+	size_t idx = 0;
+	for (const auto id : ids) {
+		const CMatrix44f trMat = getTransformMatrix(id);
 
 		memcpy(&matDataVec[16 * idx], &trMat, sizeof(CMatrix44f));
 
@@ -1061,6 +1113,50 @@ size_t LuaXBOImpl::InstanceDataFromImpl(const sol::stack_table& ids, int attrID,
 	return UploadImpl<uint32_t>(instanceDataVec, elemOffset, attrID);
 }
 
+template<typename TObj>
+size_t LuaXBOImpl::InstanceDataFromImpl(std::string_view packedIDs, int attrID, uint8_t defTeamID, const sol::optional<int>& elemOffsetOpt)
+{
+	InstanceBufferCheckAndFormatCheck(attrID, __func__);
+
+	const PackedIDs ids(packedIDs, __func__);
+	const std::size_t idsSize = ids.size();
+
+	if (idsSize == 0u) //empty string
+		return 0u;
+
+	const uint32_t elemOffset = elemOffsetOpt.value_or(0u);
+
+	if (idsSize > elementsCount - elemOffset)
+		LuaUtils::SolLuaError("[LuaXBOImpl::%s] Too many elements in packed IDs string", __func__);
+
+	// attribute is validated as 4 x GL_UNSIGNED_INT, same layout as SInstanceData
+	return WriteAttribDirect(elemOffset, idsSize, bufferAttribDefs[attrID].pointer, [&](size_t i, uint8_t* attrData) {
+		const SInstanceData instanceData = InstanceDataFromGetData<TObj>(ids[i], attrID, defTeamID);
+		memcpy(attrData, &instanceData, sizeof(SInstanceData));
+	});
+}
+
+template<typename WriteFunc>
+size_t LuaXBOImpl::WriteAttribDirect(uint32_t elemOffset, size_t elemCount, GLsizei attrPointer, WriteFunc&& writeFunc)
+{
+	const uint32_t bufferOffsetInBytes = elemOffset * elemSizeInBytes;
+	const uint32_t bytesWritten = static_cast<uint32_t>(elemCount * elemSizeInBytes);
+
+	uint8_t* elemData = static_cast<uint8_t*>(bufferData) + bufferOffsetInBytes;
+
+	for (size_t i = 0; i < elemCount; ++i) {
+		writeFunc(i, elemData + attrPointer);
+		elemData += elemSizeInBytes;
+	}
+
+	// the shadow buffer also holds the other attributes, so the whole range can be sent at once
+	xbo->Bind();
+	xbo->SetBufferSubData(bufferOffsetInBytes, bytesWritten, static_cast<uint8_t*>(bufferData) + bufferOffsetInBytes);
+	xbo->Unbind();
+
+	return bytesWritten;
+}
+
 template<typename TIn, typename AttribTestFunc>
 size_t LuaXBOImpl::UploadImpl(const std::vector<TIn>& dataVec, uint32_t elemOffset, AttribTestFunc attribTestFunc)
 {
@@ -1252,7 +1348,7 @@ size_t LuaXBOImpl::InstanceDataFromFeatureDefIDs(const sol::stack_table& ids, in
  * global per unit/feature uniform SSBO (unused for Unit/FeatureDefs), as
  * well as some auxiliary data ushc as draw flags and team index.
  *
- * @tparam number|{number,...} unitIDs
+ * @tparam number|{number,...}|string unitIDs either a table of IDs or a string of packed int32 IDs (see VFS.PackS32), the latter is written straight into the buffer and can be reused across frames
  * @number attrID
  * @number[opt] teamIdOpt
  * @number[opt] elementOffset
@@ -1278,6 +1374,11 @@ size_t LuaXBOImpl::InstanceDataFromUnitIDs(const sol::stack_table& ids, int attr
 	return InstanceDataFromImpl<CUnit>(ids, attrID, /*noop*/ 0u, elemOffsetOpt);
 }
 
+size_t LuaXBOImpl::InstanceDataFromUnitIDs(std::string_view packedIDs, int attrID, sol::optional<int> elemOffsetOpt)
+{
+	return InstanceDataFromImpl<CUnit>(packedIDs, attrID, /*noop*/ 0u, elemOffsetOpt);
+}
+
 
 /*** Fills in attribute data for each specified featureID
  *
@@ -1288,7 +1389,7 @@ size_t LuaXBOImpl::InstanceDataFromUnitIDs(const sol::stack_table& ids, int attr
  * global per unit/feature uniform SSBO (unused for Unit/FeatureDefs), as
  * well as some auxiliary data ushc as draw flags and team index.
  *
- * @tparam number|{number,...} featureIDs
+ * @tparam number|{number,...}|string featureIDs either a table of IDs or a string of packed int32 IDs (see VFS.PackS32)
  * @number attrID
  * @number[opt] teamIdOpt
  * @number[opt] elementOffset
@@ -1306,11 +1407,16 @@ size_t LuaXBOImpl::InstanceDataFromFeatureIDs(const sol::stack_table& ids, int a
 	return InstanceDataFromImpl<CFeature>(ids, attrID, /*noop*/ 0u, elemOffsetOpt);
 }
 
+size_t LuaXBOImpl::InstanceDataFromFeatureIDs(std::string_view packedIDs, int attrID, sol::optional<int> elemOffsetOpt)
+{
+	return InstanceDataFromImpl<CFeature>(packedIDs, attrID, /*noop*/ 0u, elemOffsetOpt);
+}
+
 
 /***
  *
  * @function XBO:MatrixDataFromProjectileIDs
- * @tparam number|{number,...} projectileIDs
+ * @tparam number|{number,...}|string projectileIDs either a table of IDs or a string of packed int32 IDs (see VFS.PackS32)
  * @number attrID
  * @number[opt] teamIdOpt
  * @number[opt] elementOffset
@@ -1339,6 +1445,11 @@ size_t LuaXBOImpl::MatrixDataFromProjectileIDs(const sol::stack_table& ids, int
 	return MatrixDataFromProjectileIDsImpl(idsVec, attrID, elemOffsetOpt, __func__);
 }
 
+size_t LuaXBOImpl::MatrixDataFromProjectileIDs(std::string_view packedIDs, int attrID, sol::optional<int> elemOffsetOpt)
+{
+	return MatrixDataFromProjectileIDsImpl(PackedIDs(packedIDs, __func__), attrID, elemOffsetOpt, __func__);
+}
+
 int LuaXBOImpl::BindBufferRangeImpl(GLuint bindingIndex,  const sol::optional<int> elemOffsetOpt, const sol::optional<int> elemCountOpt, const sol::optional<GLenum> targetOpt, bool bind)
 {
 	XBOExistenceCheck(xbo, __func__);
@@ -5,6 +5,7 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <algorithm>
 
 #include "lib/lua/include/lua.h" //for lua_Number
@@ -41,11 +42,14 @@ public:
 	size_t InstanceDataFromFeatureDefIDs(const sol::stack_table& ids, int attrID, sol::optional<int> teamIdOpt, sol::optional<int> elemOffsetOpt);
 	size_t InstanceDataFromUnitIDs(int id, int attrID, sol::optional<int> elemOffsetOpt);
 	size_t InstanceDataFromUnitIDs(const sol::stack_table& ids, int attrID, sol::optional<int> elemOffsetOpt);
+	size_t InstanceDataFromUnitIDs(std::string_view packedIDs, int attrID, sol::optional<int> elemOffsetOpt);
 	size_t InstanceDataFromFeatureIDs(int id, int attrID, sol::optional<int> elemOffsetOpt);
 	size_t InstanceDataFromFeatureIDs(const sol::stack_table& ids, int attrID, sol::optional<int> elemOffsetOpt);
+	size_t InstanceDataFromFeatureIDs(std::string_view packedIDs, int attrID, sol::optional<int> elemOffsetOpt);
 
 	size_t MatrixDataFromProjectileIDs(int id, int attrID, sol::optional<int> elemOffsetOpt);
 	size_t MatrixDataFromProjectileIDs(const sol::stack_table& ids, int attrID, sol::optional<int> elemOffsetOpt);
+	size_t MatrixDataFromProjectileIDs(std::string_view packedIDs, int attrID, sol::optional<int> elemOffsetOpt);
 
 	int BindBufferRange  (const GLuint index, const sol::optional<int> elemOffsetOpt, const sol::optional<int> elemCountOpt, const sol::optional<GLenum> targetOpt);
 	int UnbindBufferRange(const GLuint index, const sol::optional<int> elemOffsetOpt, const sol::optional<int> elemCountOpt, const sol::optional<GLenum> targetOpt);
@@ -103,9 +107,16 @@ private:
 	template<typename TObj>
 	size_t InstanceDataFromImpl(const sol::stack_table& ids, int attrID, uint8_t defTeamID, const sol::optional<int>& elemOffsetOpt);
 
+	template<typename TObj>
+	size_t InstanceDataFromImpl(std::string_view packedIDs, int attrID, uint8_t defTeamID, const sol::optional<int>& elemOffsetOpt);
+
 	template<typename Iterable>
 	size_t MatrixDataFromProjectileIDsImpl(const Iterable& ids, int attrID, sol::optional<int> elemOffsetOpt, const char* func);
 
+	// writes each element's attribute bytes straight into the shadow buffer, then uploads the touched range at once
+	template<typename WriteFunc>
+	size_t WriteAttribDirect(uint32_t elemOffset, size_t elemCount, GLsizei attrPointer, WriteFunc&& writeFunc);
+
 	template<typename TIn, typename AttribTestFunc>
 	size_t UploadImpl(const std::vector<TIn>& dataVec, uint32_t elemOffset, AttribTestFunc attribTestFunc);
 
@@ -10,6 +10,7 @@
 #include "System/Net/LoopbackConnection.h"
 #include "System/UnorderedMap.hpp"
 #include "System/Misc/SpringTime.h"
+#include "System/Sync/SyncChannels.h"
 
 namespace netcode
 {
@@ -69,6 +70,9 @@ public:
 
 	#ifdef SYNCCHECK
 	spring::unordered_map<int, unsigned int> syncResponse; // syncResponse[frameNum] = checksum
+	spring::unordered_map<int, CSyncChannels::Checksums> syncChannels; // syncChannels[frameNum] = per-subsystem checksums
+
+	bool syncChannelsDiverged = false;
 	#endif
 
 private:
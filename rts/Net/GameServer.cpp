@@ -3,6 +3,7 @@
 #include "System/Net/UDPListener.h"
 #include "System/Net/UDPConnection.h"
 
+#include <algorithm>
 #include <functional>
 
 #if defined DEDICATED || defined DEBUG
@@ -774,6 +775,8 @@ void CGameServer::CheckSync()
 		++outstandingSyncFrameIt;
 	}
 
+	CheckSyncChannels();
+
 #else
 
 	// Make it clear this build isn't suitable for release.
@@ -785,6 +788,85 @@ void CGameServer::CheckSync()
 }
 
 
+void CGameServer::CheckSyncChannels()
+{
+#ifdef SYNCCHECK
+	std::vector<int> frameNums;
+	std::vector< std::pair<const CSyncChannels::Checksums*, unsigned> > candidates; // <checksums, #clients matching>
+
+	for (const GameParticipant& p: players) {
+		for (const auto& pair: p.syncChannels) {
+			if (pair.first < (serverFrameNum - static_cast<int>(SYNCCHECK_TIMEOUT)))
+				frameNums.push_back(pair.first);
+		}
+	}
+
+	std::sort(frameNums.begin(), frameNums.end());
+	frameNums.erase(std::unique(frameNums.begin(), frameNums.end()), frameNums.end());
+
+	// all responses for these frames should have arrived by now; compare
+	// in frame order so the earliest divergence is the one that is shown
+	for (const int frameNum: frameNums) {
+		const CSyncChannels::Checksums* reference = nullptr;
+
+		if (HasLocalClient()) {
+			const auto it = players[localClientNumber].syncChannels.find(frameNum);
+
+			if (it != players[localClientNumber].syncChannels.end())
+				reference = &it->second;
+		} else {
+			unsigned maxCount = 0;
+
+			candidates.clear();
+
+			for (const GameParticipant& p: players) {
+				const auto it = p.syncChannels.find(frameNum);
+
+				if (it == p.syncChannels.end())
+					continue;
+
+				const auto pred = [&](const auto& c) { return (*c.first == it->second); };
+				const auto cit = std::find_if(candidates.begin(), candidates.end(), pred);
+
+				if (cit == candidates.end()) {
+					candidates.emplace_back(&it->second, 1);
+				} else {
+					cit->second += 1;
+				}
+			}
+
+			for (const auto& c: candidates) {
+				if (c.second <= maxCount)
+					continue;
+
+				maxCount = c.second;
+				reference = c.first;
+			}
+		}
+
+		for (GameParticipant& p: players) {
+			const auto it = p.syncChannels.find(frameNum);
+
+			if (it == p.syncChannels.end())
+				continue;
+
+			if (reference != nullptr && !p.syncChannelsDiverged) {
+				const int index = CSyncChannels::FindFirstMismatch(*reference, it->second);
+
+				// only report the first divergence per client, everything after it is noise
+				if ((p.syncChannelsDiverged = (index >= 0))) {
+					const std::string& description = CSyncChannels::GetDescription(index);
+					Message(spring::format("Sync channels of %s diverged at frame %d, first in %s", p.name.c_str(), frameNum, description.c_str()));
+				}
+			}
+
+			p.syncChannels.erase(it);
+		}
+	}
+#endif
+}
+
+
 float CGameServer::GetDemoTime() const {
 	if (!gameHasStarted) return gameTime;
 	return (startTime + serverFrameNum / float(GAME_SPEED));
@@ -1375,6 +1457,26 @@ void CGameServer::ProcessPacket(const unsigned playerNum, std::shared_ptr<const
 #endif
 		} break;
 
+		case NETMSG_SYNC_CHANNELS: {
+#ifdef SYNCCHECK
+			netcode::UnpackPacket pckt(packet, 2);
+
+			unsigned char playerNum; pckt >> playerNum;
+			          int  frameNum; pckt >> frameNum;
+
+			if (playerNum != a) {
+				Message(spring::format(WrongPlayer, msgCode, a, (unsigned)playerNum));
+				break;
+			}
+			if (packet->length != (2 + sizeof(playerNum) + sizeof(frameNum) + sizeof(CSyncChannels::Checksums))) {
+				Message(spring::format("Warning: Discarding invalid sync-channels packet from %s", players[a].name.c_str()));
+				break;
+			}
+
+			pckt >> players[a].syncChannels[frameNum];
+#endif
+		} break;
+
 		case NETMSG_SHARE:
 			if (inbuf[1] != a) {
 				Message(spring::format(WrongPlayer, msgCode, a, (unsigned)inbuf[1]));
@@ -161,6 +161,7 @@ private:
 	void Update();
 	void ProcessPacket(const unsigned playerNum, std::shared_ptr<const netcode::RawPacket> packet);
 	void CheckSync();
+	void CheckSyncChannels();
 	void HandleConnectionAttempts();
 	void ServerReadNet();
 
@@ -12,6 +12,7 @@
 #include "Game/GameSetup.h"
 #include "Game/GlobalUnsynced.h"
 #include "Game/SelectedUnitsHandler.h"
+#include "Game/SimBenchmark.h"
 #include "Game/ChatMessage.h"
 #include "Game/WordCompletion.h"
 #include "Game/IVideoCapturing.h"
@@ -37,10 +38,12 @@
 #include "System/Net/UnpackPacket.h"
 #include "System/Sound/ISound.h"
 #include "System/Sync/DumpState.h"
+#include "System/Sync/SyncChannels.h"
 
 #include <tracy/Tracy.hpp>
 
 CONFIG(bool, LogClientData).defaultValue(false);
+CONFIG(int, SyncChannelInterval).defaultValue(0).minimumValue(0).description("If non-zero (and sync-checking is compiled in), sends per-subsystem checksums to the server every N sim-frames so a desync can be narrowed down to a subsystem and object range.");
 
 #define LOG_SECTION_NET "Net"
 LOG_REGISTER_SECTION_GLOBAL(LOG_SECTION_NET)
@@ -265,7 +268,8 @@ void CGame::ClientReadNet()
 
 	const spring_time msgProcEndTime = spring_gettime() + spring_msecs(GetNetMessageProcessingTimeLimit());
 
-	const bool haveServerDemo = (gameServer != nullptr && gameServer->GetDemoReader() != nullptr);
+	// benchmarks have the server send out the whole demo up-front, after which its reader is gone
+	const bool haveServerDemo = (gameServer != nullptr && gameServer->GetDemoReader() != nullptr) || simBenchmark.IsReplayingDemo();
 	const bool haveClientDemo = (clientNet->GetDemoRecorder() != nullptr);
 
 	// now really process the messages
@@ -626,6 +630,15 @@ void CGame::ClientReadNet()
 				if (haveServerDemo)
 					localSyncChecksums[gs->frameNum] = CSyncChecker::GetChecksum();
 
+				simBenchmark.SyncChecksum(gs->frameNum, CSyncChecker::GetChecksum());
+
+				if (const int syncChannelInterval = configHandler->GetInt("SyncChannelInterval"); syncChannelInterval > 0 && (gs->frameNum % syncChannelInterval) == 0) {
+					CSyncChannels::Checksums syncChannels;
+					CSyncChannels::Calculate(syncChannels);
+
+					clientNet->Send(CBaseNetProtocol::Get().SendSyncChannels(gu->myPlayerNum, gs->frameNum, syncChannels.data(), syncChannels.size()));
+				}
+
 				// reset checksum every 4096 frames =~ 2.5 minutes
 				if ((gs->frameNum & 4095) == 0)
 					CSyncChecker::NewFrame();
@@ -654,6 +667,9 @@ void CGame::ClientReadNet()
 					// frame in the original game (in case of a demo)
 					if (playerNum == gu->myPlayerNum)
 						break;
+
+					simBenchmark.SyncResponse(frameNum, checkSum == ourCheckSum);
+
 					if (checkSum == ourCheckSum)
 						break;
 
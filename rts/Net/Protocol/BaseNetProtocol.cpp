@@ -543,6 +543,24 @@ PacketType CBaseNetProtocol::SendPing(uint8_t playerNum, uint8_t pingTag, float
 	return PacketType(packet);
 }
 
+PacketType CBaseNetProtocol::SendSyncChannels(uint8_t playerNum, int32_t frameNum, const uint32_t* checksums, uint32_t numChecksums)
+{
+	const uint32_t payloadSize = sizeof(playerNum) + sizeof(frameNum) + numChecksums * sizeof(uint32_t);
+	const uint32_t headerSize = sizeof(uint8_t) + sizeof(uint8_t);
+	const uint32_t packetSize = headerSize + payloadSize;
+
+	PackPacket* packet = new PackPacket(packetSize, NETMSG_SYNC_CHANNELS);
+	*packet << static_cast<uint8_t>(packetSize);
+	*packet << playerNum;
+	*packet << frameNum;
+
+	for (uint32_t i = 0; i < numChecksums; i++) {
+		*packet << checksums[i];
+	}
+
+	return PacketType(packet);
+}
+
 
 PacketType CBaseNetProtocol::SendClientData(uint8_t playerNum, const std::vector<uint8_t>& data)
 {
@@ -671,6 +689,7 @@ CBaseNetProtocol::CBaseNetProtocol()
 	proto->AddType(NETMSG_AI_STATE_CHANGED, 4);
 	proto->AddType(NETMSG_GAME_FRAME_PROGRESS, 5);
 	proto->AddType(NETMSG_PING, 1 + (1 + 1 + 4));
+	proto->AddType(NETMSG_SYNC_CHANNELS, -1);
 
 #ifdef SYNCDEBUG
 	proto->AddType(NETMSG_SD_CHKREQUEST, 5);
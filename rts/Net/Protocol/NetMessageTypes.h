@@ -95,6 +95,8 @@ enum NETMSG {
 
 	NETMSG_PING = 78, // uint8_t playerNum, uint8_t pingTag, float localTime
 
+	NETMSG_SYNC_CHANNELS = 79, // uint8_t messageSize; uint8_t playerNum; int32_t frameNum; uint32_t checksums[numChecksums]; #per-subsystem checksums, see CSyncChannels#
+
 	NETMSG_LAST //max types of netmessages, internal only
 };
 
@@ -3,6 +3,7 @@
 #include <vector>
 #include <array>
 #include <functional>
+#include <cstring>
 
 #include <unordered_map>
 
@@ -186,7 +187,8 @@ inline void CModelDrawerDataBase<T>::UpdateObjectSMMA(const T* o)
 template<typename T>
 inline void CModelDrawerDataBase<T>::UpdateObjectUniforms(const T* o)
 {
-	auto& uni = modelsUniformsStorage.GetObjUniformsArray(o);
+	const ModelUniformData& oldUni = modelsUniformsStorage.GetObjUniforms(o);
+	ModelUniformData uni = oldUni;
 	uni.drawFlag = o->drawFlag;
 
 	if (gu->spectatingFullView || o->IsInLosForAllyTeam(gu->myAllyTeam)) {
@@ -196,6 +198,12 @@ inline void CModelDrawerDataBase<T>::UpdateObjectUniforms(const T* o)
 		uni.maxHealth = o->maxHealth;
 		uni.health = o->health;
 	}
+
+	// unchanged (e.g. static buildings) elements are not marked for re-upload
+	if (memcmp(&uni, &oldUni, sizeof(uni)) == 0)
+		return;
+
+	modelsUniformsStorage.GetObjUniformsArray(o) = uni;
 }
 
 template<typename T>
@@ -55,22 +55,15 @@ static GrassRNG grng;
 
 
 
-static float GetGrassBlockCamDist(const int x, const int y, const bool square = false)
+static float GetGrassBlockCamDist(const float3& camPos, const int x, const int y, const bool square = false)
 {
 	const float qx = x * GSSSQ;
 	const float qz = y * GSSSQ;
 	const float3 mid = float3(qx, CGround::GetHeightReal(qx, qz, false), qz);
-	const float3 dif = camera->GetPos() - mid;
+	const float3 dif = camPos - mid;
 	return (square) ? dif.SqLength() : dif.Length();
 }
 
-
-static const bool GrassSort(const CGrassDrawer::GrassStruct* a, const CGrassDrawer::GrassStruct* b) {
-	const float distA = GetGrassBlockCamDist((a->posX + 0.5f) * grassBlockSize, (a->posZ + 0.5f) * grassBlockSize, true);
-	const float distB = GetGrassBlockCamDist((b->posX + 0.5f) * grassBlockSize, (b->posZ + 0.5f) * grassBlockSize, true);
-	return (distA > distB);
-}
-
 static const bool GrassSortNear(const CGrassDrawer::InviewNearGrass& a, const CGrassDrawer::InviewNearGrass& b) {
 	return (a.dist > b.dist);
 }
@@ -87,22 +80,31 @@ public:
 	std::vector<CGrassDrawer::InviewNearGrass> inviewGrass;
 	std::vector<CGrassDrawer::InviewNearGrass> inviewNearGrass;
 	std::vector<CGrassDrawer::GrassStruct*>    inviewFarGrass;
+	float3 camPos;
 	int cx, cy;
+	int drawFrame;
 	CGrassDrawer* gd;
 
+	// runs on a worker thread, needs its own RNG
+	GrassRNG rng;
+
 	void ResetState() {
 		inviewGrass.clear();
 		inviewNearGrass.clear();
 		inviewFarGrass.clear();
 
+		camPos = ZeroVector;
+
 		cx = 0;
 		cy = 0;
 
+		drawFrame = 0;
+
 		gd = nullptr;
 	}
 
 	void DrawQuad(int x, int y) {
-		const float distSq = GetGrassBlockCamDist((x + 0.5f) * grassBlockSize, (y + 0.5f) * grassBlockSize, true);
+		const float distSq = GetGrassBlockCamDist(camPos, (x + 0.5f) * grassBlockSize, (y + 0.5f) * grassBlockSize, true);
 
 		if (distSq > Square(gd->maxGrassDist))
 			return;
@@ -123,10 +125,10 @@ private:
 				if (!gd->grassMap[y2 * mapDims.mapx / grassSquareSize + x2])
 					continue;
 
-				grng.Seed(y2 * mapDims.mapx / grassSquareSize + x2);
+				rng.Seed(y2 * mapDims.mapx / grassSquareSize + x2);
 
-				const float dist  = GetGrassBlockCamDist(x2, y2, false);
-				const float rdist = 1.0f + grng.NextFloat() * 0.5f;
+				const float dist  = GetGrassBlockCamDist(camPos, x2, y2, false);
+				const float rdist = 1.0f + rng.NextFloat() * 0.5f;
 
 				//TODO instead of adding grass turfs depending on their distance to the camera,
 				//     there should be a fixed sized pool for mesh & billboard turfs
@@ -157,7 +159,7 @@ private:
 	void DrawFarQuad(const int x, const int y) {
 		const int curSquare = y * gd->blocksX + x;
 		CGrassDrawer::GrassStruct* grass = &gd->grass[curSquare];
-		grass->lastSeen = globalRendering->drawFrame;
+		grass->lastSeen = drawFrame;
 		grass->posX = x;
 		grass->posZ = y;
 		inviewFarGrass.push_back(grass);
@@ -181,6 +183,7 @@ CGrassDrawer::CGrassDrawer()
 , grassBladeTex(0)
 , farTex(0)
 , farnearVA(2048)
+, cullCam(CCamera::CAMTYPE_VISCUL)
 , grassOff(false)
 , updateBillboards(false)
 , updateVisibility(false)
@@ -258,6 +261,8 @@ CGrassDrawer::CGrassDrawer()
 
 CGrassDrawer::~CGrassDrawer()
 {
+	FinishUpdateJob();
+
 	eventHandler.RemoveClient(this);
 	configHandler->RemoveObserver(this);
 
@@ -270,6 +275,8 @@ CGrassDrawer::~CGrassDrawer()
 
 
 void CGrassDrawer::ChangeDetail(int detail) {
+	FinishUpdateJob();
+
 	// TODO: get rid of the magic constants
 	const int detail_lim = std::min(3, detail);
 	maxGrassDist = 800 + std::sqrt((float) detail) * 240;
@@ -381,28 +388,14 @@ static float3 GetTurfParams(GrassRNG& rng, const int x, const int y)
 
 
 
-void CGrassDrawer::DrawNear(const std::vector<InviewNearGrass>& inviewGrass)
+void CGrassDrawer::DrawNear(const std::vector<float4>& turfs)
 {
-	for (const InviewNearGrass& g: inviewGrass) {
-		grng.Seed(g.y * mapDims.mapx / grassSquareSize + g.x);
-
-//		const float distSq = GetGrassBlockCamDist(g.x, g.y, true);
-		const float rdist  = 1.0f + grng.NextFloat() * 0.5f;
-		const float alpha  = linearstep(maxDetailedDist, maxDetailedDist + 128.0f * rdist, g.dist);
-
-		for (int a = 0; a < numTurfs; a++) {
-			const float3& p = GetTurfParams(grng, g.x, g.y);
-			float3 pos(p.x, CGround::GetHeightReal(p.x, p.y, false), p.y);
-
-			pos.y -= CGround::GetSlope(p.x, p.y, false) * 30.0f;
-			pos.y -= 2.0f * mapInfo->grass.bladeHeight * alpha;
-
-			glPushMatrix();
-			glTranslatef3(pos);
-			glRotatef(p.z, 0.0f, 1.0f, 0.0f);
-			glCallList(grassDL);
-			glPopMatrix();
-		}
+	for (const float4& t: turfs) {
+		glPushMatrix();
+		glTranslatef3(t);
+		glRotatef(t.w, 0.0f, 1.0f, 0.0f);
+		glCallList(grassDL);
+		glPopMatrix();
 	}
 }
 
@@ -431,104 +424,191 @@ void CGrassDrawer::DrawBillboard(const int x, const int y, const float dist, VA_
 
 void CGrassDrawer::DrawFarBillboards(const std::vector<GrassStruct*>& inviewFarGrass)
 {
-	// update far grass blocks
-	if (updateBillboards) {
-		updateBillboards = false;
-
-		for_mt(0, inviewFarGrass.size(), [&](const int i) {
-			GrassStruct& g = *inviewFarGrass[i];
-
-			if (g.lastFar == 0) {
-				// TODO: VA's need to be uploaded each frame, switch to VBO's
-				// force the patch-quads to be recreated
-				g.lastFar = globalRendering->drawFrame;
-				g.lastDist = -1.0f;
-			}
+	// render far grass blocks
+	for (GrassStruct* g: inviewFarGrass) {
+		g->va.DrawArrayTN(GL_QUADS);
+	}
+}
+
+
+void CGrassDrawer::DrawNearBillboards()
+{
+	farnearVA.DrawArrayTN(GL_QUADS);
+}
 
-			const float distSq = GetGrassBlockCamDist((g.posX + 0.5f) * grassBlockSize, (g.posZ + 0.5f) * grassBlockSize, true);
 
-			if (distSq == g.lastDist)
-				return;
+void CGrassDrawer::UpdateNearTurfs(const std::vector<InviewNearGrass>& inviewGrass)
+{
+	nearTurfs.clear();
+	nearTurfs.resize(inviewGrass.size() * numTurfs);
 
-			const bool inAlphaRange1 = (    distSq < Square(maxDetailedDist + 128.0f * 1.5f)) || (    distSq > Square(maxGrassDist - 128.0f));
-			const bool inAlphaRange2 = (g.lastDist < Square(maxDetailedDist + 128.0f * 1.5f)) || (g.lastDist > Square(maxGrassDist - 128.0f));
+	for (size_t i = 0; i < inviewGrass.size(); i++) {
+		const InviewNearGrass& g = inviewGrass[i];
 
-			if (!inAlphaRange1 && (inAlphaRange1 == inAlphaRange2))
-				return;
+		GrassRNG trng;
+		trng.Seed(g.y * mapDims.mapx / grassSquareSize + g.x);
 
-			g.lastDist = distSq;
-			CVertexArray* va = &g.va;
-			va->Initialize();
+		const float rdist  = 1.0f + trng.NextFloat() * 0.5f;
+		const float alpha  = linearstep(maxDetailedDist, maxDetailedDist + 128.0f * rdist, g.dist);
 
-			// (4*4)*numTurfs quads
-			for (int y2 = g.posZ * grassBlockSize; y2 < (g.posZ + 1) * grassBlockSize; ++y2) {
-				for (int x2 = g.posX * grassBlockSize; x2 < (g.posX  + 1) * grassBlockSize; ++x2) {
-					if (!grassMap[y2 * mapDims.mapx / grassSquareSize + x2])
-						continue;
+		for (int a = 0; a < numTurfs; a++) {
+			const float3& p = GetTurfParams(trng, g.x, g.y);
+			float3 pos(p.x, CGround::GetHeightReal(p.x, p.y, false), p.y);
 
-					const float dist = GetGrassBlockCamDist(x2, y2);
-					auto* va_tn = va->GetTypedVertexArray<VA_TYPE_TN>(numTurfs * 4);
-					DrawBillboard(x2, y2, dist, va_tn);
-				}
-			}
-		});
-	}
+			pos.y -= CGround::GetSlope(p.x, p.y, false) * 30.0f;
+			pos.y -= 2.0f * mapInfo->grass.bladeHeight * alpha;
 
-	// render far grass blocks
-	for (GrassStruct* g: inviewFarGrass) {
-		g->va.DrawArrayTN(GL_QUADS);
+			nearTurfs[i * numTurfs + a] = float4(pos, p.z);
+		}
 	}
 }
 
 
-void CGrassDrawer::DrawNearBillboards(const std::vector<InviewNearGrass>& inviewNearGrass)
+void CGrassDrawer::UpdateFarBillboards(const std::vector<GrassStruct*>& inviewFarGrass, const float3 camPos, const int drawFrame)
 {
-	if (farnearVA.drawIndex() == 0) {
-		auto* va_tn = farnearVA.GetTypedVertexArray<VA_TYPE_TN>(inviewNearGrass.size() * numTurfs * 4);
+	for (GrassStruct* gp: inviewFarGrass) {
+		GrassStruct& g = *gp;
+
+		if (g.lastFar == 0) {
+			// TODO: VA's need to be uploaded each frame, switch to VBO's
+			// force the patch-quads to be recreated
+			g.lastFar = drawFrame;
+			g.lastDist = -1.0f;
+		}
 
-		for_mt(0, inviewNearGrass.size(), [&](const int i) {
-			const InviewNearGrass& gi = inviewNearGrass[i];
-			DrawBillboard(gi.x, gi.y, gi.dist, &va_tn[i * numTurfs * 4]);
-		});
-	}
+		const float distSq = GetGrassBlockCamDist(camPos, (g.posX + 0.5f) * grassBlockSize, (g.posZ + 0.5f) * grassBlockSize, true);
 
-	farnearVA.DrawArrayTN(GL_QUADS);
+		if (distSq == g.lastDist)
+			continue;
+
+		const bool inAlphaRange1 = (    distSq < Square(maxDetailedDist + 128.0f * 1.5f)) || (    distSq > Square(maxGrassDist - 128.0f));
+		const bool inAlphaRange2 = (g.lastDist < Square(maxDetailedDist + 128.0f * 1.5f)) || (g.lastDist > Square(maxGrassDist - 128.0f));
+
+		if (!inAlphaRange1 && (inAlphaRange1 == inAlphaRange2))
+			continue;
+
+		g.lastDist = distSq;
+		CVertexArray* va = &g.va;
+		va->Initialize();
+
+		// (4*4)*numTurfs quads
+		for (int y2 = g.posZ * grassBlockSize; y2 < (g.posZ + 1) * grassBlockSize; ++y2) {
+			for (int x2 = g.posX * grassBlockSize; x2 < (g.posX  + 1) * grassBlockSize; ++x2) {
+				if (!grassMap[y2 * mapDims.mapx / grassSquareSize + x2])
+					continue;
+
+				const float dist = GetGrassBlockCamDist(camPos, x2, y2);
+				auto* va_tn = va->GetTypedVertexArray<VA_TYPE_TN>(numTurfs * 4);
+				DrawBillboard(x2, y2, dist, va_tn);
+			}
+		}
+	}
 }
 
 
-void CGrassDrawer::Update()
+void CGrassDrawer::UpdateNearBillboards(const std::vector<InviewNearGrass>& inviewNearGrass)
 {
-	// grass is never drawn in any special (non-opaque) pass
-	const CCamera* cam = CCameraHandler::GetCamera(CCamera::CAMTYPE_PLAYER);
+	if (farnearVA.drawIndex() != 0)
+		return;
 
-	// update visible turfs
-	updateVisibility |= (oldCamPos != cam->GetPos());
-	updateVisibility |= (oldCamDir != cam->GetDir());
+	auto* va_tn = farnearVA.GetTypedVertexArray<VA_TYPE_TN>(inviewNearGrass.size() * numTurfs * 4);
 
-	if (updateVisibility) {
-		oldCamPos = cam->GetPos();
-		oldCamDir = cam->GetDir();
-		lastVisibilityUpdate = globalRendering->drawFrame;
+	for (size_t i = 0; i < inviewNearGrass.size(); i++) {
+		const InviewNearGrass& gi = inviewNearGrass[i];
+		DrawBillboard(gi.x, gi.y, gi.dist, &va_tn[i * numTurfs * 4]);
+	}
+}
 
+
+void CGrassDrawer::UpdateBlocks(const float3 camPos, const int drawFrame, const bool visibility, const bool farBillboards, const bool billboards)
+{
+	if (visibility) {
 		blockDrawer.ResetState();
-		blockDrawer.cx = int(cam->GetPos().x / BMSSQ);
-		blockDrawer.cy = int(cam->GetPos().z / BMSSQ);
+		blockDrawer.camPos = camPos;
+		blockDrawer.cx = int(camPos.x / BMSSQ);
+		blockDrawer.cy = int(camPos.z / BMSSQ);
+		blockDrawer.drawFrame = drawFrame;
 		blockDrawer.gd = this;
-		readMap->GridVisibility(nullptr, &blockDrawer, maxGrassDist, blockMapSize);
+		readMap->GridVisibility(&cullCam, &blockDrawer, maxGrassDist, blockMapSize);
 
-		// ATI crashes w/o an error when shadows are enabled!?
-       const bool shadows = (shadowHandler.ShadowsLoaded() && globalRendering->amdHacks);
+		UpdateNearTurfs(blockDrawer.inviewGrass);
+
+		if (billboards) {
+			const auto GrassSort = [&](const GrassStruct* a, const GrassStruct* b) {
+				const float distA = GetGrassBlockCamDist(camPos, (a->posX + 0.5f) * grassBlockSize, (a->posZ + 0.5f) * grassBlockSize, true);
+				const float distB = GetGrassBlockCamDist(camPos, (b->posX + 0.5f) * grassBlockSize, (b->posZ + 0.5f) * grassBlockSize, true);
+				return (distA > distB);
+			};
 
-		if (!shadows) {
 			std::sort(blockDrawer.inviewFarGrass.begin(), blockDrawer.inviewFarGrass.end(), GrassSort);
 			std::sort(blockDrawer.inviewNearGrass.begin(), blockDrawer.inviewNearGrass.end(), GrassSortNear);
 			farnearVA.Initialize();
-			updateBillboards = true;
 		}
+	}
+
+	if (!billboards)
+		return;
+
+	if (farBillboards)
+		UpdateFarBillboards(blockDrawer.inviewFarGrass, camPos, drawFrame);
 
-		updateVisibility = false;
+	UpdateNearBillboards(blockDrawer.inviewNearGrass);
+}
+
+
+void CGrassDrawer::StartUpdateJob(const CCamera* cam)
+{
+	// ATI crashes w/o an error when shadows are enabled!?
+	const bool billboards = !(shadowHandler.ShadowsLoaded() && globalRendering->amdHacks);
+	const bool visibility = updateVisibility;
+	const bool farBillboards = (updateBillboards || visibility) && billboards;
+
+	if (visibility) {
+		oldCamPos = cam->GetPos();
+		oldCamDir = cam->GetDir();
+		lastVisibilityUpdate = globalRendering->drawFrame;
+
+		// the job culls against a private copy, the main thread keeps using (and updating) the real one
+		cullCam.CopyState(CCameraHandler::GetCamera(CCamera::CAMTYPE_VISCUL));
+		cullCam.CalcFrustumLines(readMap->GetCurrMinHeight() - 100.0f, readMap->GetCurrMaxHeight() + 100.0f, SQUARE_SIZE);
 	}
 
+	updateVisibility = false;
+	updateBillboards &= !farBillboards;
+
+	// the job runs its loops serially, for_mt must not be nested inside a pool task
+	// (ThreadPool::inMultiThreadedSection is a plain global owned by the main thread)
+	updateJob = ThreadPool::Enqueue([this, camPos = cam->GetPos(), drawFrame = globalRendering->drawFrame, visibility, farBillboards, billboards]() {
+		UpdateBlocks(camPos, drawFrame, visibility, farBillboards, billboards);
+	});
+}
+
+
+void CGrassDrawer::FinishUpdateJob()
+{
+	if (updateJob == nullptr)
+		return;
+
+	updateJob->get();
+	updateJob = nullptr;
+
+	for (const int2& p: pendingResets) {
+		ResetPos(p.x, p.y);
+	}
+
+	pendingResets.clear();
+}
+
+
+void CGrassDrawer::StartUpdate()
+{
+	// in case the previous frame was not drawn
+	FinishUpdateJob();
+
+	// same condition as Draw, no point in preparing what will not be drawn
+	if (grassOff || !readMap->GetGrassShadingTexture())
+		return;
+
 	// collect garbage
 	//   originally, this deleted the billboard VA of any patch that was not drawn for 50 frames
 	//   now it only resets lastFar s.t. patches are forcibly recreated when they become visible
@@ -539,6 +619,19 @@ void CGrassDrawer::Update()
 			ResetPos(-gs.posX, -gs.posZ);
 		}
 	}
+
+	// grass is never drawn in any special (non-opaque) pass
+	const CCamera* cam = CCameraHandler::GetCamera(CCamera::CAMTYPE_PLAYER);
+
+	// update visible turfs
+	updateVisibility |= (oldCamPos != cam->GetPos());
+	updateVisibility |= (oldCamDir != cam->GetDir());
+
+	// static camera and no invalidated blocks, cached turfs and billboards stay valid
+	if (!updateVisibility && !updateBillboards)
+		return;
+
+	StartUpdateJob(cam);
 }
 
 
@@ -547,12 +640,14 @@ void CGrassDrawer::Draw()
 	if (grassOff || !readMap->GetGrassShadingTexture())
 		return;
 
+	FinishUpdateJob();
+
 	glPushAttrib(GL_CURRENT_BIT);
 	glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
 
-	if (!blockDrawer.inviewGrass.empty()) {
+	if (!nearTurfs.empty()) {
 		SetupGlStateNear();
-			DrawNear(blockDrawer.inviewGrass);
+			DrawNear(nearTurfs);
 		ResetGlStateNear();
 	}
 
@@ -562,7 +657,7 @@ void CGrassDrawer::Draw()
 	if (!shadows && (!blockDrawer.inviewFarGrass.empty() || !blockDrawer.inviewNearGrass.empty())) {
 		SetupGlStateFar();
 			DrawFarBillboards(blockDrawer.inviewFarGrass);
-			DrawNearBillboards(blockDrawer.inviewNearGrass);
+			DrawNearBillboards();
 		ResetGlStateFar();
 	}
 
@@ -930,6 +1025,11 @@ void CGrassDrawer::ResetPos(const int grassBlockX, const int grassBlockZ)
 	if (grassOff)
 		return;
 
+	if (updateJob != nullptr) {
+		pendingResets.emplace_back(grassBlockX, grassBlockZ);
+		return;
+	}
+
 	// negative coors are passed during "garbage-collection" resets
 	const int gbx = std::abs(grassBlockX);
 	const int gbz = std::abs(grassBlockZ);
@@ -940,7 +1040,7 @@ void CGrassDrawer::ResetPos(const int grassBlockX, const int grassBlockZ)
 	grass[gbz * blocksX + gbx].lastFar = 0;
 
 	updateBillboards = true;
-	updateVisibility = (grassBlockX >= 0 && grassBlockZ >= 0);
+	updateVisibility |= (grassBlockX >= 0 && grassBlockZ >= 0);
 }
 
 
@@ -960,6 +1060,9 @@ void CGrassDrawer::AddGrass(const float3& pos, const uint8_t grassValue)
 	assert(x >= 0 && x < (mapDims.mapx / grassSquareSize));
 	assert(z >= 0 && z < (mapDims.mapy / grassSquareSize));
 
+	// the update job reads grassMap
+	FinishUpdateJob();
+
 	grassMap[z * mapDims.mapx / grassSquareSize + x] = grassValue;
 	ResetPos(pos);
 }
@@ -974,6 +1077,9 @@ void CGrassDrawer::RemoveGrass(const float3& pos)
 	assert(x >= 0 && x < (mapDims.mapx / grassSquareSize));
 	assert(z >= 0 && z < (mapDims.mapy / grassSquareSize));
 
+	// the update job reads grassMap
+	FinishUpdateJob();
+
 	grassMap[z * mapDims.mapx / grassSquareSize + x] = 0;
 	ResetPos(pos);
 }
@@ -3,10 +3,14 @@
 #ifndef GRASSDRAWER_H
 #define GRASSDRAWER_H
 
+#include <future>
+#include <memory>
 #include <vector>
 
+#include "Game/Camera.h"
 #include "Rendering/GL/VertexArray.h"
-#include "System/float3.h"
+#include "System/float4.h"
+#include "System/type2.h"
 #include "System/EventClient.h"
 
 namespace Shader {
@@ -23,6 +27,11 @@ public:
 	CGrassDrawer();
 	~CGrassDrawer();
 
+	// started by WorldDrawer once the unsynced heightmap is current,
+	// finished by Draw or at the latest when the draw-frame ends
+	void StartUpdate();
+	void FinishUpdate() { FinishUpdateJob(); }
+
 	void Draw();
 	void DrawShadow();
 	void AddGrass(const float3& pos,  const uint8_t grassValue);
@@ -38,7 +47,6 @@ public:
 public:
 	// EventClient
 	void UnsyncedHeightMapUpdate(const SRectangle& rect);
-	void Update();
 
 public:
 	struct InviewNearGrass {
@@ -84,11 +92,18 @@ protected:
 	void ResetGlStateNear();
 	void SetupGlStateFar();
 	void ResetGlStateFar();
-	void DrawNear(const std::vector<InviewNearGrass>& inviewGrass);
+	void DrawNear(const std::vector<float4>& turfs);
 	void DrawFarBillboards(const std::vector<GrassStruct*>& inviewGrass);
-	void DrawNearBillboards(const std::vector<InviewNearGrass>& inviewNearGrass);
+	void DrawNearBillboards();
 	void DrawBillboard(const int x, const int y, const float dist, VA_TYPE_TN* va_tn);
 
+	void StartUpdateJob(const CCamera* cam);
+	void FinishUpdateJob();
+	void UpdateBlocks(const float3 camPos, const int drawFrame, const bool visibility, const bool farBillboards, const bool billboards);
+	void UpdateNearTurfs(const std::vector<InviewNearGrass>& inviewGrass);
+	void UpdateFarBillboards(const std::vector<GrassStruct*>& inviewFarGrass, const float3 camPos, const int drawFrame);
+	void UpdateNearBillboards(const std::vector<InviewNearGrass>& inviewNearGrass);
+
 	void ResetPos(const int grassBlockX, const int grassBlockZ);
 
 protected:
@@ -106,6 +121,16 @@ protected:
 	std::vector<GrassStruct> grass;
 	std::vector<unsigned char> grassMap;
 
+	// {pos, rotation} of every close turf, rebuilt only when visibility changes
+	std::vector<float4> nearTurfs;
+
+	// visibility, LOD and billboard updates run on a worker between StartUpdate and
+	// Draw; block resets arriving in the meantime are applied once it has finished
+	std::shared_ptr< std::future<void> > updateJob;
+	std::vector<int2> pendingResets;
+
+	CCamera cullCam;
+
 	std::vector<Shader::IProgramObject*> grassShaders;
 	Shader::IProgramObject* grassShader;
 
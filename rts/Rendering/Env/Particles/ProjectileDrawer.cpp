@@ -33,9 +33,13 @@
 #include "System/EventHandler.h"
 #include "System/Exceptions.h"
 #include "System/Log/ILog.h"
+#include "System/RadixSort.h"
 #include "System/SafeUtil.h"
 #include "System/StringUtil.h"
 #include "System/ScopedResource.h"
+#include "System/Threading/ThreadPool.h"
+#include <algorithm>
+#include <cstring>
 #include <tuple>
 
 CONFIG(int, SoftParticles).defaultValue(1).safemodeValue(0).description("Soften up CEG particles on clipping edges");
@@ -50,6 +54,30 @@ static bool CProjectileSortingPredicate(const CProjectile* p1, const CProjectile
 };
 
 
+// sort key layout, ascending order: [63..48] biased drawOrder (only if wanted),
+// [47..24] inverted distance quantized to 24 bits (far to near), [23..0] index
+static constexpr uint32_t SORT_KEY_INDEX_BITS = 24;
+static constexpr uint32_t SORT_KEY_DIST_BITS = 24;
+static constexpr uint64_t SORT_KEY_INDEX_MASK = (1ull << SORT_KEY_INDEX_BITS) - 1;
+
+static uint64_t GetProjectileSortKey(const CProjectile* p, uint32_t index, bool useDrawOrder)
+{
+	uint32_t distBits = 0;
+	const float sortDist = p->GetSortDist();
+
+	static_assert(sizeof(distBits) == sizeof(sortDist), "");
+	memcpy(&distBits, &sortDist, sizeof(distBits));
+
+	// map float ordering onto unsigned integer ordering, then invert for far-to-near
+	distBits ^= ((distBits >> 31) != 0)? 0xFFFFFFFFu: 0x80000000u;
+	distBits = ~distBits >> (32 - SORT_KEY_DIST_BITS);
+
+	const uint64_t drawOrder = useDrawOrder? (std::clamp(p->drawOrder, -32768, 32767) + 32768): 0;
+
+	return ((drawOrder << (SORT_KEY_DIST_BITS + SORT_KEY_INDEX_BITS)) | (uint64_t(distBits) << SORT_KEY_INDEX_BITS) | index);
+}
+
+
 CProjectileDrawer* projectileDrawer = nullptr;
 
 // can not be a CProjectileDrawer; destruction in global
@@ -633,6 +661,35 @@ void CProjectileDrawer::DrawProjectileNow(CProjectile* pro, bool drawReflection,
 
 
 
+void CProjectileDrawer::SortProjectiles()
+{
+	if (sortedProjectiles.size() > SORT_KEY_INDEX_MASK) {
+		// too many to encode their index, never expected in practice
+		if (wantDrawOrder)
+			std::sort(sortedProjectiles.begin(), sortedProjectiles.end(), CProjectileDrawOrderSortingPredicate);
+		else
+			std::sort(sortedProjectiles.begin(), sortedProjectiles.end(), CProjectileSortingPredicate);
+
+		return;
+	}
+
+	sortKeys.resize(sortedProjectiles.size());
+
+	for_mt_chunk(0, sortedProjectiles.size(), [&](const int i) {
+		sortKeys[i] = GetProjectileSortKey(sortedProjectiles[i], i, wantDrawOrder);
+	});
+
+	spring::RadixSortMT(sortKeys, sortKeysTemp);
+
+	sortedProjectilesTemp.resize(sortedProjectiles.size());
+
+	for (size_t i = 0; i < sortKeys.size(); i++) {
+		sortedProjectilesTemp[i] = sortedProjectiles[sortKeys[i] & SORT_KEY_INDEX_MASK];
+	}
+
+	sortedProjectiles.swap(sortedProjectilesTemp);
+}
+
 void CProjectileDrawer::DrawProjectilesShadow(int modelType)
 {
 	const auto& mdlRenderer = modelRenderers[modelType];
@@ -779,10 +836,7 @@ void CProjectileDrawer::Draw(bool drawReflection, bool drawRefraction) {
 		// only z-sorted (if the projectiles indicate they want to be)
 		DrawProjectilesSet(modellessProjectiles, drawReflection, drawRefraction);
 
-		if (wantDrawOrder)
-			std::sort(sortedProjectiles.begin(), sortedProjectiles.end(), CProjectileDrawOrderSortingPredicate);
-		else
-			std::sort(sortedProjectiles.begin(), sortedProjectiles.end(), CProjectileSortingPredicate);
+		SortProjectiles();
 
 		for (auto p : sortedProjectiles) {
 			p->Draw();
@@ -136,6 +136,7 @@ private:
 	static void DrawProjectilesSetShadow(const std::vector<CProjectile*>& projectiles);
 
 	void DrawProjectileNow(CProjectile* projectile, bool drawReflection, bool drawRefraction);
+	void SortProjectiles();
 
 	static void DrawProjectileShadow(CProjectile* projectile);
 	static bool DrawProjectileModel(const CProjectile* projectile);
@@ -171,6 +172,11 @@ private:
 	std::vector<CProjectile*> sortedProjectiles;
 	std::vector<CProjectile*> unsortedProjectiles;
 
+	/// packed (drawOrder, distance, index) keys and scratch buffers for SortProjectiles
+	std::vector<uint64_t> sortKeys;
+	std::vector<uint64_t> sortKeysTemp;
+	std::vector<CProjectile*> sortedProjectilesTemp;
+
 	bool drawSorted = true;
 
 	GLuint depthTexture = 0u;
@@ -24,7 +24,10 @@
 #include "System/Config/ConfigHandler.h"
 #include "System/Exceptions.h"
 #include "System/Log/ILog.h"
+#include "System/FileSystem/DataDirsAccess.h"
 #include "System/FileSystem/FileHandler.h"
+#include "System/FileSystem/FileQueryFlags.h"
+#include "System/FileSystem/FileSystem.h"
 #include "System/Threading/ThreadPool.h"
 #ifdef _DEBUG
 	#include "System/Platform/Threading.h"
@@ -42,6 +45,8 @@
 
 #define SUPPORT_AMD_HACKS_HERE
 
+CONFIG(bool, FontGlyphCache).defaultValue(true).headlessValue(false).description("Cache rasterized font glyphs in the cache directory, so glyphs seen in earlier sessions are loaded at startup without FreeType or fontconfig.");
+
 #ifndef HEADLESS
 	#undef __FTERRORS_H__
 	#define FT_ERRORDEF( e, v, s )  { e, s },
@@ -78,6 +83,9 @@ static spring::unordered_map<std::string, std::weak_ptr<FontFileBytes>> fontMemC
 static spring::unordered_set<std::pair<std::string, int>, spring::synced_hash<std::pair<std::string, int>>> invalidFonts;
 static auto cacheMutexes = spring::WrappedSyncRecursiveMutex{};
 
+// below this many new glyphs the per-thread faces are not worth waking the pool for
+static constexpr size_t MIN_PARALLEL_GLYPHS = 32;
+
 #include "NonPrintableSymbols.inl"
 
 
@@ -359,7 +367,7 @@ static std::shared_ptr<FontFace> GetFontFace(const std::string& fontfile, const
 		throw content_error(fmt::format("FT_Select_Charmap failed: {}", GetFTError(error)));
 	}
 
-	return (fontFaceCache[fontKey] = std::make_shared<FontFace>(face.Release(), fontMem)).lock();
+	return (fontFaceCache[fontKey] = std::make_shared<FontFace>(face.Release(), fontMem, fontPath, size)).lock();
 }
 #endif
 
@@ -532,6 +540,47 @@ static std::shared_ptr<FontFace> GetFontForCharacters(const std::vector<char32_t
 /*******************************************************************************/
 
 
+#ifndef HEADLESS
+// bump when the entry layout or the glyph metrics computation changes
+static constexpr uint32_t GLYPH_CACHE_MAGIC   = 0x43474C46; // "FLGC"
+static constexpr uint32_t GLYPH_CACHE_VERSION = 1;
+
+struct GlyphCacheHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t numEntries;
+	uint32_t dataSize;
+	uint32_t dataHash;
+};
+
+// followed by <pathSize> bytes of face path and, if <hasMetrics>, <width * height> bytes of bitmap;
+// entries without metrics share the bitmap of an earlier entry with the same face and index
+struct GlyphCacheEntry {
+	uint32_t letter;
+	uint32_t index;
+	uint32_t pathSize;
+	uint32_t hasMetrics;
+
+	float size[4];
+	float advance;
+	float height;
+	float descender;
+
+	int32_t bmpWidth;
+	int32_t bmpHeight;
+};
+
+static const std::string& GetGlyphCacheDir()
+{
+	static const std::string cacheDir = (configHandler != nullptr && configHandler->GetBool("FontGlyphCache"))?
+		dataDirsAccess.LocateDir(FileSystem::GetCacheDir() + "/fonts/", FileQueryFlags::WRITE | FileQueryFlags::CREATE_DIRS):
+		"";
+
+	return cacheDir;
+}
+#endif
+
+
 CFontTexture::CFontTexture(const std::string& fontfile, int size, int _outlinesize, float  _outlineweight)
 	: outlineSize(_outlinesize)
 	, outlineWeight(_outlineweight)
@@ -595,28 +644,52 @@ CFontTexture::CFontTexture(const std::string& fontfile, int size, int _outlinesi
 	// has to be done before first GetGlyph() call!
 	CreateTexture(32, 32);
 
+	// glyphs seen in earlier sessions are loaded in a single batch
+	LoadGlyphCache();
+
 	// precache ASCII glyphs & kernings (save them in kerningPrecached array for better lvl2 cpu cache hitrate)
 
 	//preload Glyphs
 	LoadWantedGlyphs(32, 127);
-	for (char32_t i = 32; i < 127; ++i) {
+
+	const auto PrecacheKerning = [&](FT_Face kernFace, char32_t i) {
 		const auto& lgl = GetGlyph(i);
 		const float advance = lgl.advance;
 		for (char32_t j = 32; j < 127; ++j) {
 			const auto& rgl = GetGlyph(j);
 			const auto hash = GetKerningHash(i, j);
 			FT_Vector kerning = {};
-			if (FT_HAS_KERNING(face))
-				FT_Get_Kerning(face, lgl.index, rgl.index, FT_KERNING_DEFAULT, &kerning);
+			if (FT_HAS_KERNING(kernFace))
+				FT_Get_Kerning(kernFace, lgl.index, rgl.index, FT_KERNING_DEFAULT, &kerning);
 
 			kerningPrecached[hash] = advance + normScale * kerning.x;
 		}
+	};
+
+	bool threadFaces = false;
+
+	{
+		auto lock = CFontTexture::sync.GetScopedLock();
+		threadFaces = shFace->InitThreadFaces(ThreadPool::GetNumThreads());
+	}
+
+	if (threadFaces) {
+		for_mt(32, 127, [&](const int i) {
+			PrecacheKerning(shFace->GetThreadFace(ThreadPool::GetThreadNum()), i);
+		});
+	} else {
+		for (char32_t i = 32; i < 127; ++i) {
+			PrecacheKerning(face, i);
+		}
 	}
 #endif
 }
 
 CFontTexture::~CFontTexture()
 {
+#ifndef HEADLESS
+	SaveGlyphCache();
+#endif
 	CglFontRenderer::DeleteInstance(fontRenderer);
 #ifndef HEADLESS
 	glDeleteTextures(1, &glyphAtlasTextureID);
@@ -725,11 +798,14 @@ void CFontTexture::LoadWantedGlyphs(const std::vector<char32_t>& wanted)
 	for (auto c : wanted) {
 		if (failedToFind.find(c) != failedToFind.end())
 			continue;
+		// e.g. restored from the glyph cache
+		if (glyphs.find(c) != glyphs.end())
+			continue;
 
 		auto it = std::lower_bound(nonPrintableRanges.begin(), nonPrintableRanges.end(), c);
 		if (std::distance(nonPrintableRanges.begin(), it) % 2 != 0) {
-			LoadGlyph(shFace, c, 0);
 			failedToFind.emplace(c);
+			QueueGlyph(shFace, c, 0);
 		}
 		else {
 			map.emplace_back(c);
@@ -737,7 +813,7 @@ void CFontTexture::LoadWantedGlyphs(const std::vector<char32_t>& wanted)
 	}
 	spring::VectorSortUnique(map);
 
-	if (map.empty())
+	if (map.empty() && pendingGlyphs.empty() && pendingAliases.empty())
 		return;
 
 	// load glyphs from different fonts (using fontconfig)
@@ -753,7 +829,7 @@ void CFontTexture::LoadWantedGlyphs(const std::vector<char32_t>& wanted)
 			FT_UInt index = FT_Get_Char_Index(*f, map[idx]);
 
 			if (index != 0) {
-				LoadGlyph(f, map[idx], index);
+				QueueGlyph(f, map[idx], index);
 
 				map[idx] = map.back();
 				map.pop_back();
@@ -768,11 +844,154 @@ void CFontTexture::LoadWantedGlyphs(const std::vector<char32_t>& wanted)
 
 	// load fail glyph for all remaining ones (they will all share the same fail glyph)
 	for (auto c: map) {
-		LoadGlyph(shFace, c, 0);
-		LOG_L(L_WARNING, "[CFontTexture::%s] Failed to load glyph %u", __func__, uint32_t(c));
 		failedToFind.insert(c);
+		QueueGlyph(shFace, c, 0);
+		LOG_L(L_WARNING, "[CFontTexture::%s] Failed to load glyph %u", __func__, uint32_t(c));
+	}
+
+	LoadPendingGlyphs();
+}
+
+
+void CFontTexture::QueueGlyph(const std::shared_ptr<FontFace>& f, char32_t ch, unsigned index)
+{
+#ifndef HEADLESS
+	if (glyphs.find(ch) != glyphs.end())
+		return;
+
+	// check for duplicated glyphs, either loaded before or queued in this batch
+	const auto key = std::make_pair(f->face, static_cast<uint32_t>(index));
+	const auto iter = glyphsByIndex.find(key);
+
+	if (iter != glyphsByIndex.end()) {
+		const auto srcIter = glyphs.find(iter->second);
+
+		if (srcIter == glyphs.end()) {
+			pendingAliases.emplace_back(ch, iter->second);
+			return;
+		}
+
+		GlyphInfo glyph = srcIter->second;
+		glyph.letter = ch;
+		glyphs[ch] = std::move(glyph);
+
+		AddGlyphCacheEntry(f, ch, index, nullptr);
+		return;
+	}
+
+	glyphsByIndex[key] = ch;
+
+	PendingGlyph& pg = pendingGlyphs.emplace_back();
+	pg.glyph.face  = f;
+	pg.glyph.index = index;
+	pg.glyph.letter = ch;
+#endif
+}
+
+void CFontTexture::RasterizeGlyph(PendingGlyph& pg, FT_Face face) const
+{
+#ifndef HEADLESS
+	GlyphInfo& glyph = pg.glyph;
+
+	// load glyph
+	if (FT_Load_Glyph(face, glyph.index, FT_LOAD_RENDER) != 0)
+		LOG_L(L_ERROR, "Couldn't load glyph %d", glyph.letter);
+
+	FT_GlyphSlot slot = face->glyph;
+
+	const float xbearing = slot->metrics.horiBearingX * normScale;
+	const float ybearing = slot->metrics.horiBearingY * normScale;
+
+	glyph.size.x = xbearing;
+	glyph.size.y = ybearing - fontDescender;
+	glyph.size.w =  slot->metrics.width * normScale;
+	glyph.size.h = -slot->metrics.height * normScale;
+
+	glyph.advance   = slot->advance.x * normScale;
+	glyph.height    = slot->metrics.height * normScale;
+	glyph.descender = ybearing - glyph.height;
+
+	// workaround bugs in FreeSansBold (in range 0x02B0 - 0x0300)
+	if (glyph.advance == 0 && glyph.size.w > 0)
+		glyph.advance = glyph.size.w;
+
+	pg.rasterized = true;
+
+	const int width  = slot->bitmap.width;
+	const int height = slot->bitmap.rows;
+
+	if (width <= 0 || height <= 0)
+		return;
+
+	if (slot->bitmap.pixel_mode != FT_PIXEL_MODE_GRAY) {
+		LOG_L(L_ERROR, "invalid pixeldata mode");
+		return;
 	}
 
+	if (slot->bitmap.pitch != width) {
+		LOG_L(L_ERROR, "invalid pitch");
+		return;
+	}
+
+	pg.width  = width;
+	pg.height = height;
+	pg.bitmap.assign(slot->bitmap.buffer, slot->bitmap.buffer + width * height);
+#endif
+}
+
+void CFontTexture::LoadPendingGlyphs()
+{
+#ifndef HEADLESS
+	if (pendingGlyphs.empty() && pendingAliases.empty())
+		return;
+
+	// rasterize everything not restored from the glyph cache, across the pool
+	// if the batch is large enough (e.g. a burst of new CJK glyphs in chat)
+	size_t numRaster = 0;
+
+	for (const PendingGlyph& pg: pendingGlyphs) {
+		numRaster += (!pg.rasterized);
+	}
+
+	bool threadFaces = (numRaster >= MIN_PARALLEL_GLYPHS && ThreadPool::GetNumThreads() > 1);
+
+	for (size_t i = 0; threadFaces && i < pendingGlyphs.size(); i++) {
+		threadFaces &= pendingGlyphs[i].glyph.face->InitThreadFaces(ThreadPool::GetNumThreads());
+	}
+
+	if (threadFaces) {
+		for_mt(0, pendingGlyphs.size(), [&](const int i) {
+			PendingGlyph& pg = pendingGlyphs[i];
+
+			if (!pg.rasterized)
+				RasterizeGlyph(pg, pg.glyph.face->GetThreadFace(ThreadPool::GetThreadNum()));
+		});
+	} else {
+		for (PendingGlyph& pg: pendingGlyphs) {
+			if (!pg.rasterized)
+				RasterizeGlyph(pg, pg.glyph.face->face);
+		}
+	}
+
+	// hand the whole batch to the atlas allocator
+	const int olSize = 2 * outlineSize;
+
+	for (const PendingGlyph& pg: pendingGlyphs) {
+		glyphs[pg.glyph.letter] = pg.glyph;
+
+		AddGlyphCacheEntry(pg.glyph.face, pg.glyph.letter, pg.glyph.index, &pg);
+
+		if (pg.width <= 0 || pg.height <= 0)
+			continue;
+
+		// store glyph bitmap (index) in allocator until the atlas readback below
+		atlasGlyphs.emplace_back(pg.bitmap.data(), pg.width, pg.height, 1);
+
+		const std::string glyphName = IntToString(pg.glyph.letter);
+
+		atlasAlloc.AddEntry(glyphName       , int2(pg.width         , pg.height         ), reinterpret_cast<void*>(atlasGlyphs.size() - 1));
+		atlasAlloc.AddEntry(glyphName + "sh", int2(pg.width + olSize, pg.height + olSize)                                                 );
+	}
 
 	// read atlasAlloc glyph data back into atlasUpdate{Shadow}
 	{
@@ -791,8 +1010,8 @@ void CFontTexture::LoadWantedGlyphs(const std::vector<char32_t>& wanted)
 		if ((atlasUpdateShadow.xsize != wantedTexWidth) || (atlasUpdateShadow.ysize != wantedTexHeight))
 			atlasUpdateShadow = atlasUpdateShadow.CanvasResize(wantedTexWidth, wantedTexHeight, false);
 
-		for (const auto i : wanted) {
-			const std::string glyphName  = IntToString(i);
+		for (const PendingGlyph& pg: pendingGlyphs) {
+			const std::string glyphName  = IntToString(pg.glyph.letter);
 			const std::string glyphName2 = glyphName + "sh";
 
 			if (!atlasAlloc.contains(glyphName))
@@ -802,7 +1021,7 @@ void CFontTexture::LoadWantedGlyphs(const std::vector<char32_t>& wanted)
 			const auto texpos2 = atlasAlloc.GetEntry(glyphName2);
 
 			//glyphs is a map
-			auto& thisGlyph = glyphs[i];
+			auto& thisGlyph = glyphs[pg.glyph.letter];
 
 			thisGlyph.texCord       = IGlyphRect(texpos [0], texpos [1], texpos [2] - texpos [0], texpos [3] - texpos [1]);
 			thisGlyph.shadowTexCord = IGlyphRect(texpos2[0], texpos2[1], texpos2[2] - texpos2[0], texpos2[3] - texpos2[1]);
@@ -821,78 +1040,207 @@ void CFontTexture::LoadWantedGlyphs(const std::vector<char32_t>& wanted)
 		atlasGlyphs.clear();
 	}
 
+	// duplicates of glyphs in this batch only get valid texcoords now
+	for (const auto& [letter, srcLetter]: pendingAliases) {
+		GlyphInfo glyph = glyphs[srcLetter];
+		glyph.letter = letter;
+
+		AddGlyphCacheEntry(glyph.face, letter, glyph.index, nullptr);
+
+		glyphs[letter] = std::move(glyph);
+	}
+
+	pendingGlyphs.clear();
+	pendingAliases.clear();
+#endif
+
 	// schedule a texture update
 	++curTextureUpdate;
 }
 
 
 
-void CFontTexture::LoadGlyph(std::shared_ptr<FontFace>& f, char32_t ch, unsigned index)
+void CFontTexture::LoadGlyphCache()
 {
 #ifndef HEADLESS
-	if (glyphs.find(ch) != glyphs.end())
+	if (GetGlyphCacheDir().empty())
 		return;
 
-	// check for duplicated glyphs
-	const auto pred = [&](const std::pair<char32_t, GlyphInfo>& p) { return (p.second.index == index && *p.second.face == f->face); };
-	const auto iter = std::find_if(glyphs.begin(), glyphs.end(), pred);
+	// rendered glyphs depend on the exact font data, the size and the rasterizer
+	uint32_t hash = spring::LiteHash(shFace->memory->data(), shFace->memory->size(), GLYPH_CACHE_VERSION);
+	hash = spring::LiteHash(fontSize, hash);
+	hash = spring::LiteHash(FREETYPE_MAJOR * 10000 + FREETYPE_MINOR * 100 + FREETYPE_PATCH, hash);
 
-	if (iter != glyphs.end()) {
-		auto& glyph = glyphs[ch];
-		glyph = iter->second;
-		glyph.letter = ch;
-		return;
+	glyphCacheName = GetGlyphCacheDir() + FileSystem::GetBasename(shFace->path) + IntToString(hash, "-%08x.glyphs");
+
+	std::vector<uint8_t> cacheBuf;
+
+	{
+		FILE* cacheFile = fopen(glyphCacheName.c_str(), "rb");
+
+		if (cacheFile == nullptr)
+			return;
+
+		fseek(cacheFile, 0, SEEK_END);
+		cacheBuf.resize(std::max(ftell(cacheFile), 0L));
+		fseek(cacheFile, 0, SEEK_SET);
+
+		const bool readOK = (fread(cacheBuf.data(), 1, cacheBuf.size(), cacheFile) == cacheBuf.size());
+
+		fclose(cacheFile);
+
+		if (!readOK || cacheBuf.size() < sizeof(GlyphCacheHeader))
+			return;
 	}
 
-	auto& glyph = glyphs[ch];
-	glyph.face  = f;
-	glyph.index = index;
-	glyph.letter = ch;
+	GlyphCacheHeader header;
+	std::memcpy(&header, cacheBuf.data(), sizeof(header));
 
-	// load glyph
-	if (FT_Load_Glyph(*f, index, FT_LOAD_RENDER) != 0)
-		LOG_L(L_ERROR, "Couldn't load glyph %d", ch);
+	const uint8_t* dataBeg = cacheBuf.data() + sizeof(header);
+	const uint8_t* dataEnd = cacheBuf.data() + cacheBuf.size();
 
-	FT_GlyphSlot slot = f->face->glyph;
+	if (header.magic != GLYPH_CACHE_MAGIC || header.version != GLYPH_CACHE_VERSION)
+		return;
+	if (header.dataSize != static_cast<size_t>(dataEnd - dataBeg) || header.dataHash != spring::LiteHash(dataBeg, header.dataSize, 0))
+		return;
 
-	const float xbearing = slot->metrics.horiBearingX * normScale;
-	const float ybearing = slot->metrics.horiBearingY * normScale;
+	// a changed entry count makes the destructor rewrite the file, e.g. after dropping stale entries
+	numGlyphCacheFileEntries = header.numEntries;
 
-	glyph.size.x = xbearing;
-	glyph.size.y = ybearing - fontDescender;
-	glyph.size.w =  slot->metrics.width * normScale;
-	glyph.size.h = -slot->metrics.height * normScale;
+	assert(CFontTexture::sync.GetThreadSafety() || Threading::IsMainThread());
+	auto lock = CFontTexture::sync.GetScopedLock();
 
-	glyph.advance   = slot->advance.x * normScale;
-	glyph.height    = slot->metrics.height * normScale;
-	glyph.descender = ybearing - glyph.height;
+	for (uint32_t n = 0; n < header.numEntries; n++) {
+		GlyphCacheEntry entry;
 
-	// workaround bugs in FreeSansBold (in range 0x02B0 - 0x0300)
-	if (glyph.advance == 0 && glyph.size.w > 0)
-		glyph.advance = glyph.size.w;
+		if (static_cast<size_t>(dataEnd - dataBeg) < sizeof(entry))
+			break;
 
-	const int width  = slot->bitmap.width;
-	const int height = slot->bitmap.rows;
-	const int olSize = 2 * outlineSize;
+		std::memcpy(&entry, dataBeg, sizeof(entry));
+		dataBeg += sizeof(entry);
 
-	if (width <= 0 || height <= 0)
+		const size_t bmpSize = entry.hasMetrics? (std::max(entry.bmpWidth, 0) * std::max(entry.bmpHeight, 0)): 0;
+
+		if ((entry.pathSize + bmpSize) > static_cast<size_t>(dataEnd - dataBeg))
+			break;
+
+		const std::string facePath(reinterpret_cast<const char*>(dataBeg), entry.pathSize);
+		const uint8_t* bmpData = dataBeg + entry.pathSize;
+
+		dataBeg += (entry.pathSize + bmpSize);
+
+		// fallback faces come from fontconfig, skip those that are no longer available
+		std::shared_ptr<FontFace> f = shFace;
+
+		if (facePath != shFace->path) {
+			try {
+				f = GetFontFace(facePath, fontSize);
+			} catch (const content_error&) {
+				continue;
+			}
+		}
+
+		if (FT_Get_Char_Index(*f, entry.letter) != entry.index)
+			continue;
+
+		const size_t numPending = pendingGlyphs.size();
+
+		QueueGlyph(f, entry.letter, entry.index);
+
+		if (!entry.hasMetrics || pendingGlyphs.size() == numPending)
+			continue;
+
+		PendingGlyph& pg = pendingGlyphs.back();
+
+		pg.glyph.size      = IGlyphRect(entry.size[0], entry.size[1], entry.size[2], entry.size[3]);
+		pg.glyph.advance   = entry.advance;
+		pg.glyph.height    = entry.height;
+		pg.glyph.descender = entry.descender;
+
+		pg.rasterized = true;
+
+		if (bmpSize == 0)
+			continue;
+
+		pg.width  = entry.bmpWidth;
+		pg.height = entry.bmpHeight;
+		pg.bitmap.assign(bmpData, bmpData + bmpSize);
+	}
+
+	if (pendingGlyphs.empty() && pendingAliases.empty())
 		return;
 
-	if (slot->bitmap.pixel_mode != FT_PIXEL_MODE_GRAY) {
-		LOG_L(L_ERROR, "invalid pixeldata mode");
+	LOG_L(L_INFO, "[CFontTexture::%s] loading %u cached glyphs for %s (s=%d)", __func__, uint32_t(pendingGlyphs.size() + pendingAliases.size()), shFace->path.c_str(), fontSize);
+	LoadPendingGlyphs();
+#endif
+}
+
+void CFontTexture::SaveGlyphCache() const
+{
+#ifndef HEADLESS
+	if (glyphCacheName.empty() || numGlyphCacheEntries == numGlyphCacheFileEntries)
+		return;
+
+	const GlyphCacheHeader header = {
+		GLYPH_CACHE_MAGIC,
+		GLYPH_CACHE_VERSION,
+		numGlyphCacheEntries,
+		uint32_t(glyphCacheData.size()),
+		spring::LiteHash(glyphCacheData.data(), glyphCacheData.size(), 0)
+	};
+
+	FILE* cacheFile = fopen(glyphCacheName.c_str(), "wb");
+
+	if (cacheFile == nullptr) {
+		LOG_L(L_WARNING, "[CFontTexture::%s] failed to open \"%s\" for writing", __func__, glyphCacheName.c_str());
 		return;
 	}
 
-	if (slot->bitmap.pitch != width) {
-		LOG_L(L_ERROR, "invalid pitch");
+	// a partially written file fails the size/hash check on load
+	if (fwrite(&header, sizeof(header), 1, cacheFile) != 1 || fwrite(glyphCacheData.data(), glyphCacheData.size(), 1, cacheFile) != 1)
+		LOG_L(L_WARNING, "[CFontTexture::%s] failed to write \"%s\"", __func__, glyphCacheName.c_str());
+
+	fclose(cacheFile);
+#endif
+}
+
+void CFontTexture::AddGlyphCacheEntry(const std::shared_ptr<FontFace>& f, char32_t ch, unsigned index, const PendingGlyph* pg)
+{
+#ifndef HEADLESS
+	if (glyphCacheName.empty())
+		return;
+
+	// fail-glyphs are not cached, the characters might be found in fonts installed later
+	if (failedToFind.find(ch) != failedToFind.end())
 		return;
+
+	GlyphCacheEntry entry = {};
+	entry.letter = ch;
+	entry.index = index;
+	entry.pathSize = f->path.size();
+	entry.hasMetrics = (pg != nullptr);
+
+	if (pg != nullptr) {
+		entry.size[0] = pg->glyph.size.x;
+		entry.size[1] = pg->glyph.size.y;
+		entry.size[2] = pg->glyph.size.w;
+		entry.size[3] = pg->glyph.size.h;
+
+		entry.advance   = pg->glyph.advance;
+		entry.height    = pg->glyph.height;
+		entry.descender = pg->glyph.descender;
+
+		entry.bmpWidth  = pg->bitmap.empty()? 0: pg->width;
+		entry.bmpHeight = pg->bitmap.empty()? 0: pg->height;
 	}
 
-	// store glyph bitmap (index) in allocator until the next LoadWantedGlyphs call
-	atlasGlyphs.emplace_back(slot->bitmap.buffer, width, height, 1);
+	glyphCacheData.insert(glyphCacheData.end(), reinterpret_cast<const uint8_t*>(&entry), reinterpret_cast<const uint8_t*>(&entry) + sizeof(entry));
+	glyphCacheData.insert(glyphCacheData.end(), f->path.begin(), f->path.end());
+
+	if (pg != nullptr)
+		glyphCacheData.insert(glyphCacheData.end(), pg->bitmap.begin(), pg->bitmap.end());
 
-	atlasAlloc.AddEntry(IntToString(ch)       , int2(width         , height         ), reinterpret_cast<void*>(atlasGlyphs.size() - 1));
-	atlasAlloc.AddEntry(IntToString(ch) + "sh", int2(width + olSize, height + olSize)                                                 );
+	numGlyphCacheEntries += 1;
 #endif
 }
 
@@ -1088,18 +1436,53 @@ FT_Byte* FontFileBytes::data()
 	return vec.data();
 }
 
-FontFace::FontFace(FT_Face f, std::shared_ptr<FontFileBytes>& mem)
+FontFace::FontFace(FT_Face f, std::shared_ptr<FontFileBytes>& mem, const std::string& path, int size)
 	: face(f)
 	, memory(mem)
+	, path(path)
+	, size(size)
 { }
 
 FontFace::~FontFace()
 {
 #ifndef HEADLESS
+	for (FT_Face threadFace: threadFaces) {
+		FT_Done_Face(threadFace);
+	}
+
 	FT_Done_Face(face);
 #endif
 }
 
+bool FontFace::InitThreadFaces(int numThreads)
+{
+#ifndef HEADLESS
+	// FT_New_Face and FT_Done_Face are not thread-safe, caller holds CFontTexture::sync
+	while (static_cast<int>(threadFaces.size()) < (numThreads - 1)) {
+		FT_Face threadFace = nullptr;
+		FT_Error error = FT_New_Memory_Face(FtLibraryHandler::GetLibrary(), memory->data(), memory->size(), 0, &threadFace);
+
+		if (error == 0 && (error = FT_Set_Pixel_Sizes(threadFace, 0, size)) == 0)
+			error = FT_Select_Charmap(threadFace, FT_ENCODING_UNICODE);
+
+		if (error != 0) {
+			LOG_L(L_WARNING, "[FontFace::%s] failed to create face copy for \"%s\": %s", __func__, path.c_str(), GetFTError(error));
+
+			if (threadFace != nullptr)
+				FT_Done_Face(threadFace);
+
+			return false;
+		}
+
+		threadFaces.push_back(threadFace);
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
 FontFace::operator FT_Face()
 {
 	return this->face;
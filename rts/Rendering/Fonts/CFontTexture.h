@@ -5,10 +5,12 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "Rendering/Textures/Bitmap.h"
 #include "Rendering/Textures/IAtlasAllocator.h"
 #include "Rendering/Textures/RowAtlasAlloc.h"
+#include "System/SpringHash.h"
 #include "System/UnorderedMap.hpp"
 #include "System/UnorderedSet.hpp"
 #include "System/Threading/WrappedSync.h"
@@ -62,18 +64,31 @@ struct FontFileBytes {
 	}
 	using FT_Byte = unsigned char;
 	FT_Byte* data();
+	size_t size() const { return vec.size(); }
 private:
 	std::vector<FT_Byte> vec;
 };
 
 //wrapper to allow usage as shared_ptr
 struct FontFace {
-	FontFace(FT_Face f, std::shared_ptr<FontFileBytes>& mem);
+	FontFace(FT_Face f, std::shared_ptr<FontFileBytes>& mem, const std::string& path, int size);
 	~FontFace();
 	operator FT_Face();
 
+	// creates the per-thread copies of face (FT_Face's are not thread-safe)
+	bool InitThreadFaces(int numThreads);
+	FT_Face GetThreadFace(int threadNum) const {
+		if (threadNum <= 0 || threadNum > static_cast<int>(threadFaces.size()))
+			return face;
+
+		return threadFaces[threadNum - 1];
+	}
+
 	FT_Face face;
 	std::shared_ptr<FontFileBytes> memory;
+	std::string path;
+	int size;
+	std::vector<FT_Face> threadFaces; // for worker threads 1..N
 };
 
 struct GlyphInfo {
@@ -142,8 +157,22 @@ protected:
 	void UploadGlyphAtlasTexture();
 	void UploadGlyphAtlasTextureImpl();
 private:
+	struct PendingGlyph {
+		GlyphInfo glyph; // face, index and letter are set when queued, the rest when rasterized
+		int width = 0;
+		int height = 0;
+		bool rasterized = false;
+		std::vector<uint8_t> bitmap;
+	};
+
 	void CreateTexture(const int width, const int height);
-	void LoadGlyph(std::shared_ptr<FontFace>& f, char32_t ch, unsigned index);
+	void QueueGlyph(const std::shared_ptr<FontFace>& f, char32_t ch, unsigned index);
+	void RasterizeGlyph(PendingGlyph& pg, FT_Face face) const;
+	void LoadPendingGlyphs();
+
+	void LoadGlyphCache();
+	void SaveGlyphCache() const;
+	void AddGlyphCacheEntry(const std::shared_ptr<FontFace>& f, char32_t ch, unsigned index, const PendingGlyph* pg);
 protected:
 	float GetKerning(const GlyphInfo& lgl, const GlyphInfo& rgl);
 protected:
@@ -183,6 +212,17 @@ private:
 	spring::unordered_set<char32_t> failedToFind;
 	spring::unordered_map<char32_t, GlyphInfo> glyphs; // UTF32 -> GlyphInfo
 	spring::unordered_map<uint64_t, float> kerningDynamic; // contains unicode kerning
+	spring::unordered_map<std::pair<FT_Face, uint32_t>, char32_t, spring::synced_hash<std::pair<FT_Face, uint32_t>>> glyphsByIndex; // (face, index) -> first letter using it
+
+	// glyphs queued for the next LoadPendingGlyphs, and letters sharing a bitmap with one of them
+	std::vector<PendingGlyph> pendingGlyphs;
+	std::vector<std::pair<char32_t, char32_t>> pendingAliases;
+
+	// on-disk glyph cache; entries are serialized in the order glyphs are loaded
+	std::string glyphCacheName;
+	std::vector<uint8_t> glyphCacheData;
+	uint32_t numGlyphCacheEntries = 0;
+	uint32_t numGlyphCacheFileEntries = 0;
 
 	std::vector<CBitmap> atlasGlyphs;
 
@@ -98,31 +98,28 @@ CAirLosTexture::~CAirLosTexture()
 
 void CAirLosTexture::UpdateCPU()
 {
-	infoTexPBO.Bind();
-	auto infoTexMem = reinterpret_cast<unsigned char*>(infoTexPBO.MapBuffer());
-
-	if (!losHandler->GetGlobalLOS(gu->myAllyTeam)) {
-		const unsigned short* myAirLos = &losHandler->airLos.losMaps[gu->myAllyTeam].front();
-		for (int y = 0; y < texSize.y; ++y) {
-			for (int x = 0; x < texSize.x; ++x) {
-				infoTexMem[y * texSize.x + x] = (myAirLos[y * texSize.x + x] != 0) ? 255 : 0;
-			}
-		}
+	if (losHandler->GetGlobalLOS(gu->myAllyTeam)) {
+		UploadChangedTiles(texture, GL_RED, 1, [](unsigned char* tileMem, const SRectangle& rect) {
+			memset(tileMem, 255, rect.GetArea());
+		});
 	} else {
-		memset(infoTexMem, 255, texSize.x * texSize.y);
+		const unsigned short* myAirLos = &losHandler->airLos.losMaps[gu->myAllyTeam].front();
+
+		UploadChangedTiles(texture, GL_RED, 1, [&](unsigned char* tileMem, const SRectangle& rect) {
+			ConvertLosTile(tileMem, myAirLos, texSize.x, rect);
+		});
 	}
 
-	infoTexPBO.UnmapBuffer();
 	glBindTexture(GL_TEXTURE_2D, texture);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texSize.x, texSize.y, GL_RED, GL_UNSIGNED_BYTE, infoTexPBO.GetPtr());
 	glGenerateMipmap(GL_TEXTURE_2D);
-	infoTexPBO.Invalidate();
-	infoTexPBO.Unbind();
 }
 
 
 void CAirLosTexture::Update()
 {
+	if (!CollectChangedTiles({{&losHandler->airLos, gu->myAllyTeam}}))
+		return;
+
 	if (!fbo.IsValid() || !shader->IsValid() || uploadTex == 0)
 		return UpdateCPU();
 
@@ -139,19 +136,14 @@ void CAirLosTexture::Update()
 		return;
 	}
 
-	infoTexPBO.Bind();
-	auto infoTexMem = reinterpret_cast<unsigned char*>(infoTexPBO.MapBuffer());
 	const unsigned short* myAirLos = &losHandler->airLos.losMaps[gu->myAllyTeam].front();
-	memcpy(infoTexMem, myAirLos, texSize.x * texSize.y * texChannels * sizeof(short));
-	infoTexPBO.UnmapBuffer();
 
 	//Trick: Upload the ushort as 2 ubytes, and then check both for `!=0` in the shader.
 	// Faster than doing it on the CPU! And uploading it as shorts would be slow, cause the GPU
 	// has no native support for them and so the transformation would happen on the CPU, too.
-	glBindTexture(GL_TEXTURE_2D, uploadTex);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texSize.x, texSize.y, GL_RG, GL_UNSIGNED_BYTE, infoTexPBO.GetPtr());
-	infoTexPBO.Invalidate();
-	infoTexPBO.Unbind();
+	UploadChangedTiles(uploadTex, GL_RG, sizeof(unsigned short), [&](unsigned char* tileMem, const SRectangle& rect) {
+		CopyLosTile(tileMem, myAirLos, texSize.x, rect);
+	});
 
 	// do post-processing on the gpu (los-checking & scaling)
 	fbo.Bind();
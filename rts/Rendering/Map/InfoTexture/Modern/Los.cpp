@@ -30,23 +30,19 @@ CLosTexture::CLosTexture()
 
 void CLosTexture::Update()
 {
-	infoTexPBO.Bind();
-	auto infoTexMem = reinterpret_cast<unsigned char*>(infoTexPBO.MapBuffer());
-
-	if (!losHandler->GetGlobalLOS(gu->myAllyTeam)) {
-		const unsigned short* myLos = &losHandler->los.losMaps[gu->myAllyTeam].front();
-		for (int y = 0; y < texSize.y; ++y) {
-			for (int x = 0; x < texSize.x; ++x) {
-				infoTexMem[y * texSize.x + x] = (myLos[y * texSize.x + x] != 0) ? 255 : 0;
-			}
-		}
-	} else {
-		memset(infoTexMem, 255, texSize.x * texSize.y);
+	if (!CollectChangedTiles({{&losHandler->los, gu->myAllyTeam}}))
+		return;
+
+	if (losHandler->GetGlobalLOS(gu->myAllyTeam)) {
+		UploadChangedTiles(texture, GL_RED, 1, [](unsigned char* tileMem, const SRectangle& rect) {
+			memset(tileMem, 255, rect.GetArea());
+		});
+		return;
 	}
 
-	infoTexPBO.UnmapBuffer();
-	glBindTexture(GL_TEXTURE_2D, texture);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texSize.x, texSize.y, GL_RED, GL_UNSIGNED_BYTE, infoTexPBO.GetPtr());
-	infoTexPBO.Invalidate();
-	infoTexPBO.Unbind();
+	const unsigned short* myLos = &losHandler->los.losMaps[gu->myAllyTeam].front();
+
+	UploadChangedTiles(texture, GL_RED, 1, [&](unsigned char* tileMem, const SRectangle& rect) {
+		ConvertLosTile(tileMem, myLos, texSize.x, rect);
+	});
 }
@@ -1,6 +1,12 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
 #include "PboInfoTexture.h"
+#include "Game/GlobalUnsynced.h"
+#include "Sim/Misc/LosHandler.h"
+#include "System/Threading/ThreadPool.h"
+
+#include <cstring>
+#include <emmintrin.h>
 
 
 CPboInfoTexture::CPboInfoTexture(const std::string& _name)
@@ -15,3 +21,129 @@ CPboInfoTexture::~CPboInfoTexture()
 {
 	glDeleteTextures(1, &texture);
 }
+
+
+bool CPboInfoTexture::CollectChangedTiles(std::initializer_list< std::pair<const ILosType*, int> > losMaps)
+{
+	const ILosType* gridLosType = losMaps.begin()->first;
+
+	const bool globalLOS = losHandler->GetGlobalLOS(gu->myAllyTeam);
+	const bool fullUpdate = (gu->myAllyTeam != lastAllyTeam || globalLOS != lastGlobalLOS);
+
+	bool changed = fullUpdate;
+
+	tileMask.clear();
+	tileMask.resize(gridLosType->numTiles.x * gridLosType->numTiles.y, fullUpdate);
+	lastUpdateNums.resize(losMaps.size(), 0);
+
+	int n = 0;
+
+	for (const auto& p: losMaps) {
+		const ILosType* losType = p.first;
+
+		// nothing but the allyteam or global-LOS state matters while the latter is enabled
+		if (!fullUpdate && !globalLOS) {
+			if (losType->size == gridLosType->size) {
+				changed |= losType->GetChangedTiles(p.second, lastUpdateNums[n], tileMask);
+			} else if (losType->updateNum > lastUpdateNums[n]) {
+				// different resolution, tiles do not line up
+				std::fill(tileMask.begin(), tileMask.end(), 1);
+				changed = true;
+			}
+		}
+
+		lastUpdateNums[n++] = losType->updateNum;
+	}
+
+	lastAllyTeam = gu->myAllyTeam;
+	lastGlobalLOS = globalLOS;
+
+	changedTiles.clear();
+
+	if (!changed)
+		return false;
+
+	for (int y = 0; y < gridLosType->numTiles.y; y++) {
+		for (int x = 0; x < gridLosType->numTiles.x; x++) {
+			if (!tileMask[y * gridLosType->numTiles.x + x])
+				continue;
+
+			const int x1 = x * ILosType::TILE_SIZE;
+			const int y1 = y * ILosType::TILE_SIZE;
+			const int x2 = std::min(x1 + ILosType::TILE_SIZE, texSize.x);
+			const int y2 = std::min(y1 + ILosType::TILE_SIZE, texSize.y);
+
+			changedTiles.emplace_back(x1, y1, x2, y2);
+		}
+	}
+
+	return true;
+}
+
+
+void CPboInfoTexture::UploadChangedTiles(GLuint tex, GLenum format, int bytesPerTexel, const FillTileFunc& fillTile)
+{
+	tileOffsets.clear();
+	tileOffsets.reserve(changedTiles.size() + 1);
+	tileOffsets.push_back(0);
+
+	for (const SRectangle& rect: changedTiles) {
+		tileOffsets.push_back(tileOffsets.back() + rect.GetArea() * bytesPerTexel);
+	}
+
+	infoTexPBO.Bind();
+	unsigned char* infoTexMem = infoTexPBO.MapBuffer(0, tileOffsets.back());
+
+	for_mt(0, changedTiles.size(), [&](const int i) {
+		fillTile(infoTexMem + tileOffsets[i], changedTiles[i]);
+	});
+
+	infoTexPBO.UnmapBuffer();
+	glBindTexture(GL_TEXTURE_2D, tex);
+
+	for (size_t i = 0; i < changedTiles.size(); i++) {
+		const SRectangle& rect = changedTiles[i];
+		glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x1, rect.y1, rect.GetWidth(), rect.GetHeight(), format, GL_UNSIGNED_BYTE, infoTexPBO.GetPtr(tileOffsets[i]));
+	}
+
+	infoTexPBO.Invalidate();
+	infoTexPBO.Unbind();
+}
+
+
+void CPboInfoTexture::ConvertLosTile(unsigned char* tileMem, const unsigned short* losMap, int losSizeX, const SRectangle& rect)
+{
+	const __m128i zeros = _mm_setzero_si128();
+	const __m128i ones = _mm_set1_epi8(-1);
+
+	const int w = rect.GetWidth();
+
+	for (int y = rect.y1; y < rect.y2; y++) {
+		const unsigned short* losRow = losMap + y * losSizeX + rect.x1;
+
+		int x = 0;
+
+		for (; (x + 16) <= w; x += 16) {
+			const __m128i a = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(losRow + x    )), zeros);
+			const __m128i b = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(losRow + x + 8)), zeros);
+
+			// unseen squares compare to 0xFFFF and saturate to 0xFF, flip both
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(tileMem + x), _mm_xor_si128(_mm_packs_epi16(a, b), ones));
+		}
+		for (; x < w; x++) {
+			tileMem[x] = (losRow[x] != 0) ? 255 : 0;
+		}
+
+		tileMem += w;
+	}
+}
+
+void CPboInfoTexture::CopyLosTile(unsigned char* tileMem, const unsigned short* losMap, int losSizeX, const SRectangle& rect)
+{
+	const int rowSize = rect.GetWidth() * sizeof(unsigned short);
+
+	for (int y = rect.y1; y < rect.y2; y++) {
+		memcpy(tileMem, losMap + y * losSizeX + rect.x1, rowSize);
+		tileMem += rowSize;
+	}
+}
@@ -3,10 +3,17 @@
 #ifndef _PBO_INFO_TEXTURE_H
 #define _PBO_INFO_TEXTURE_H
 
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
 #include "Rendering/Map/InfoTexture/InfoTexture.h"
 #include "Rendering/GL/PBO.h"
+#include "System/Rectangle.h"
 
 
+class ILosType;
 
 class CPboInfoTexture : public CInfoTexture
 {
@@ -19,8 +26,35 @@ public:
 	virtual void Update() = 0;
 	virtual bool IsUpdateNeeded() = 0;
 
+protected:
+	typedef std::function<void(unsigned char* tileMem, const SRectangle& rect)> FillTileFunc;
+
+	/**
+	 * Collects the ILosType tiles changed since the previous call, the first
+	 * {type, allyteam} pair defines the tile-grid. Everything is considered
+	 * changed when the local allyteam or its global-LOS state switched.
+	 * @return false if nothing needs to be updated
+	 */
+	bool CollectChangedTiles(std::initializer_list< std::pair<const ILosType*, int> > losMaps);
+
+	/// fills the collected tiles packed back-to-back into the PBO (on worker threads) and uploads each
+	void UploadChangedTiles(GLuint tex, GLenum format, int bytesPerTexel, const FillTileFunc& fillTile);
+
+	/// writes 255 for every non-zero square of <losMap> within rect, 0 otherwise
+	static void ConvertLosTile(unsigned char* tileMem, const unsigned short* losMap, int losSizeX, const SRectangle& rect);
+	/// copies the raw squares of <losMap> within rect
+	static void CopyLosTile(unsigned char* tileMem, const unsigned short* losMap, int losSizeX, const SRectangle& rect);
+
 protected:
 	PBO infoTexPBO;
+
+	std::vector<uint8_t> tileMask;
+	std::vector<SRectangle> changedTiles;
+	std::vector<int> tileOffsets;
+	std::vector<int> lastUpdateNums;
+
+	int lastAllyTeam = -1;
+	bool lastGlobalLOS = false;
 };
 
 #endif // _PBO_INFO_TEXTURE_H
@@ -11,6 +11,8 @@
 #include "System/Exceptions.h"
 #include "System/Log/ILog.h"
 
+#include <emmintrin.h>
+
 
 
 CRadarTexture::CRadarTexture()
@@ -120,45 +122,72 @@ CRadarTexture::~CRadarTexture()
 }
 
 
-void CRadarTexture::UpdateCPU()
+static void ConvertRadarTile(unsigned char* tileMem, const unsigned short* myRadar, const unsigned short* myJammer, const unsigned short* myLos, int losSizeX, const SRectangle& rect)
 {
-	infoTexPBO.Bind();
-	auto infoTexMem = reinterpret_cast<unsigned char*>(infoTexPBO.MapBuffer());
+	const __m128i zeros = _mm_setzero_si128();
+	const __m128i ones = _mm_set1_epi8(-1);
 
-	if (!losHandler->GetGlobalLOS(gu->myAllyTeam)) {
-		const int jammerAllyTeam = modInfo.separateJammers ? gu->myAllyTeam : 0;
+	const int w = rect.GetWidth();
 
-		const unsigned short* myLos = &losHandler->los.losMaps[gu->myAllyTeam].front();
+	for (int y = rect.y1; y < rect.y2; y++) {
+		const int idx = y * losSizeX + rect.x1;
 
-		const unsigned short* myRadar  = &losHandler->radar.losMaps[gu->myAllyTeam].front();
-		const unsigned short* myJammer = &losHandler->jammer.losMaps[jammerAllyTeam].front();
-		for (int y = 0; y < texSize.y; ++y) {
-			for (int x = 0; x < texSize.x; ++x) {
-				const int idx = y * texSize.x + x;
-				infoTexMem[idx * 2 + 0] = ( myRadar[idx] != 0) ? 255 : 0;
-				infoTexMem[idx * 2 + 1] = (myJammer[idx] != 0 && myLos[idx] != 0) ? 255 : 0;
-			}
+		int x = 0;
+
+		for (; (x + 8) <= w; x += 8) {
+			const __m128i r = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>( myRadar + idx + x)), zeros);
+			const __m128i j = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(myJammer + idx + x)), zeros);
+			const __m128i l = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(   myLos + idx + x)), zeros);
+
+			// 0xFFFF where a map is zero; R is radar, G is jammer-in-los
+			const __m128i rc = _mm_xor_si128(_mm_packs_epi16(r, r), ones);
+			const __m128i gc = _mm_xor_si128(_mm_packs_epi16(_mm_or_si128(j, l), _mm_or_si128(j, l)), ones);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(tileMem + x * 2), _mm_unpacklo_epi8(rc, gc));
 		}
-	} else {
-		for (int y = 0; y < texSize.y; ++y) {
-			for (int x = 0; x < texSize.x; ++x) {
-				const int idx = y * texSize.x + x;
-				infoTexMem[idx * 2 + 0] = 255;
-				infoTexMem[idx * 2 + 1] = 0;
-			}
+		for (; x < w; x++) {
+			tileMem[x * 2 + 0] = ( myRadar[idx + x] != 0) ? 255 : 0;
+			tileMem[x * 2 + 1] = (myJammer[idx + x] != 0 && myLos[idx + x] != 0) ? 255 : 0;
 		}
+
+		tileMem += w * 2;
 	}
+}
 
-	infoTexPBO.UnmapBuffer();
-	glBindTexture(GL_TEXTURE_2D, texture);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texSize.x, texSize.y, GL_RG, GL_UNSIGNED_BYTE, infoTexPBO.GetPtr());
-	infoTexPBO.Invalidate();
-	infoTexPBO.Unbind();
+
+void CRadarTexture::UpdateCPU()
+{
+	if (losHandler->GetGlobalLOS(gu->myAllyTeam)) {
+		UploadChangedTiles(texture, GL_RG, 2, [](unsigned char* tileMem, const SRectangle& rect) {
+			for (int i = 0; i < rect.GetArea(); i++) {
+				tileMem[i * 2 + 0] = 255;
+				tileMem[i * 2 + 1] = 0;
+			}
+		});
+		return;
+	}
+
+	const int jammerAllyTeam = modInfo.separateJammers ? gu->myAllyTeam : 0;
+
+	const unsigned short* myLos = &losHandler->los.losMaps[gu->myAllyTeam].front();
+
+	const unsigned short* myRadar  = &losHandler->radar.losMaps[gu->myAllyTeam].front();
+	const unsigned short* myJammer = &losHandler->jammer.losMaps[jammerAllyTeam].front();
+
+	UploadChangedTiles(texture, GL_RG, 2, [&](unsigned char* tileMem, const SRectangle& rect) {
+		ConvertRadarTile(tileMem, myRadar, myJammer, myLos, texSize.x, rect);
+	});
 }
 
 
 void CRadarTexture::Update()
 {
+	const int jammerAllyTeam = modInfo.separateJammers ? gu->myAllyTeam : 0;
+
+	// the jammer channel is masked by LOS, so LOS changes count as well
+	if (!CollectChangedTiles({{&losHandler->radar, gu->myAllyTeam}, {&losHandler->jammer, jammerAllyTeam}, {&losHandler->los, gu->myAllyTeam}}))
+		return;
+
 	if (!fbo.IsValid() || !shader->IsValid() || uploadTexRadar == 0 || uploadTexJammer == 0)
 		return UpdateCPU();
 
@@ -175,30 +204,29 @@ void CRadarTexture::Update()
 		return;
 	}
 
-	const int jammerAllyTeam = modInfo.separateJammers ? gu->myAllyTeam : 0;
-
-	infoTexPBO.Bind();
-	const size_t arraySize = texSize.x * texSize.y * sizeof(unsigned short);
-	auto infoTexMem = reinterpret_cast<unsigned char*>(infoTexPBO.MapBuffer());
 	const unsigned short* myRadar  = &losHandler->radar.losMaps[gu->myAllyTeam].front();
 	const unsigned short* myJammer = &losHandler->jammer.losMaps[jammerAllyTeam].front();
-	memcpy(infoTexMem,  myRadar, arraySize);
-	infoTexMem += arraySize;
-	memcpy(infoTexMem, myJammer, arraySize);
-	infoTexPBO.UnmapBuffer();
 
 	//Trick: Upload the ushort as 2 ubytes, and then check both for `!=0` in the shader.
 	// Faster than doing it on the CPU! And uploading it as shorts would be slow, cause the GPU
 	// has no native support for them and so the transformation would happen on the CPU, too.
+	UploadChangedTiles(uploadTexRadar, GL_RG, sizeof(unsigned short), [&](unsigned char* tileMem, const SRectangle& rect) {
+		CopyLosTile(tileMem, myRadar, texSize.x, rect);
+	});
+	UploadChangedTiles(uploadTexJammer, GL_RG, sizeof(unsigned short), [&](unsigned char* tileMem, const SRectangle& rect) {
+		CopyLosTile(tileMem, myJammer, texSize.x, rect);
+	});
+
+	// the shader samples the LOS texture, which might not have been updated yet
+	// this frame; a repeated call is free since it has no changed tiles left then
+	CPboInfoTexture* losTex = static_cast<CPboInfoTexture*>(infoTextureHandler->GetInfoTexture("los"));
+	losTex->Update();
+
 	glActiveTexture(GL_TEXTURE1);
 	glEnable(GL_TEXTURE_2D);
 	glBindTexture(GL_TEXTURE_2D, uploadTexRadar);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texSize.x, texSize.y, GL_RG, GL_UNSIGNED_BYTE, infoTexPBO.GetPtr());
 	glActiveTexture(GL_TEXTURE0);
 	glBindTexture(GL_TEXTURE_2D, uploadTexJammer);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texSize.x, texSize.y, GL_RG, GL_UNSIGNED_BYTE, infoTexPBO.GetPtr(arraySize));
-	infoTexPBO.Invalidate();
-	infoTexPBO.Unbind();
 
 	// do post-processing on the gpu (los-checking & scaling)
 	fbo.Bind();
@@ -207,7 +235,7 @@ void CRadarTexture::Update()
 	glDisable(GL_BLEND);
 	glActiveTexture(GL_TEXTURE2);
 	glEnable(GL_TEXTURE_2D);
-	glBindTexture(GL_TEXTURE_2D, infoTextureHandler->GetInfoTexture("los")->GetTexture());
+	glBindTexture(GL_TEXTURE_2D, losTex->GetTexture());
 	glBegin(GL_QUADS);
 		glVertex2f(-1.f, -1.f);
 		glVertex2f(-1.f, +1.f);
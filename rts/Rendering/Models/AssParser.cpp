@@ -12,9 +12,14 @@
 #include "System/StringUtil.h"
 #include "System/Log/ILog.h"
 #include "System/Exceptions.h"
+#include "System/SpringHash.h"
 #include "System/SpringMath.h"
 #include "System/ScopedFPUSettings.h"
+#include "System/Config/ConfigHandler.h"
+#include "System/FileSystem/ArchiveScanner.h"
+#include "System/FileSystem/DataDirsAccess.h"
 #include "System/FileSystem/FileHandler.h"
+#include "System/FileSystem/FileQueryFlags.h"
 #include "System/FileSystem/FileSystem.h"
 
 #include "lib/assimp/include/assimp/config.h"
@@ -25,11 +30,17 @@
 #include "lib/assimp/include/assimp/Importer.hpp"
 #include "lib/assimp/include/assimp/DefaultLogger.hpp"
 
+#include <cstdio>
+#include <cstring>
 #include <regex>
 #include <algorithm>
 #include <numeric>
+#include <stdexcept>
+#include <type_traits>
 
 
+CONFIG(bool, AssimpModelCache).defaultValue(true).description("Cache the processed geometry of Assimp models (dae, obj, fbx, ...) in the cache directory to skip re-importing them on later loads.");
+
 #define IS_QNAN(f) (f != f)
 
 // triangulate guarantees the most complex mesh is a triangle
@@ -62,6 +73,12 @@ static constexpr unsigned int ASS_LOGGING_OPTIONS =
 	| Assimp::Logger::Warn
 	;
 
+// bump ASS_CACHE_VERSION whenever the layout written by SaveCachedModel
+// or the post-processing done by CAssParser::Load changes, this renders
+// all existing cache entries stale
+static constexpr uint32_t ASS_CACHE_MAGIC   = 0x43534153; // "SASC"
+static constexpr uint32_t ASS_CACHE_VERSION = 1;
+
 
 
 static inline float3 aiVectorToFloat3(const aiVector3D v)
@@ -180,6 +197,85 @@ struct SPseudoAssPiece {
 	}
 };
 
+namespace {
+	struct AssCacheHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t dataSize;
+		uint32_t dataHash;
+	};
+
+	struct AssCacheWriter {
+	public:
+		template<typename T> void Write(const T& v) {
+			static_assert(std::is_trivially_copyable_v<T>);
+			const auto* p = reinterpret_cast<const uint8_t*>(&v);
+			data.insert(data.end(), p, p + sizeof(T));
+		}
+		template<typename T> void Write(const std::vector<T>& v) {
+			static_assert(std::is_trivially_copyable_v<T>);
+			const auto* p = reinterpret_cast<const uint8_t*>(v.data());
+			Write(static_cast<uint32_t>(v.size()));
+			data.insert(data.end(), p, p + v.size() * sizeof(T));
+		}
+		void Write(const std::string& s) {
+			Write(static_cast<uint32_t>(s.size()));
+			data.insert(data.end(), s.begin(), s.end());
+		}
+		void Write(const CMatrix44f& m) {
+			for (float f: m.m) {
+				Write(f);
+			}
+		}
+	public:
+		std::vector<uint8_t> data;
+	};
+
+	struct AssCacheReader {
+	public:
+		AssCacheReader(const uint8_t* beg, const uint8_t* end): cur(beg), end(end) {}
+
+		template<typename T> void Read(T& v) {
+			static_assert(std::is_trivially_copyable_v<T>);
+			Check(sizeof(T));
+			std::memcpy(&v, cur, sizeof(T));
+			cur += sizeof(T);
+		}
+		template<typename T> void Read(std::vector<T>& v) {
+			static_assert(std::is_trivially_copyable_v<T>);
+			uint32_t n = 0;
+			Read(n);
+			Check(size_t(n) * sizeof(T));
+			v.resize(n);
+			std::memcpy(v.data(), cur, n * sizeof(T));
+			cur += (n * sizeof(T));
+		}
+		void Read(std::string& s) {
+			uint32_t n = 0;
+			Read(n);
+			Check(n);
+			s.assign(reinterpret_cast<const char*>(cur), n);
+			cur += n;
+		}
+		void Read(CMatrix44f& m) {
+			for (float& f: m.m) {
+				Read(f);
+			}
+		}
+
+		bool AtEnd() const { return (cur == end); }
+	private:
+		void Check(size_t n) const {
+			if (n > size_t(end - cur))
+				throw std::runtime_error("truncated model cache entry");
+		}
+	private:
+		const uint8_t* cur;
+		const uint8_t* end;
+	};
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void CAssParser::Init()
@@ -189,6 +285,11 @@ void CAssParser::Init()
 	maxVertices = std::max(globalRendering->glslMaxRecommendedVertices, 1024);
 	numPoolPieces = 0;
 
+	cacheDir.clear();
+
+	if (configHandler->GetBool("AssimpModelCache"))
+		cacheDir = dataDirsAccess.LocateDir(FileSystem::GetCacheDir() + "/models/", FileQueryFlags::WRITE | FileQueryFlags::CREATE_DIRS);
+
 	Assimp::DefaultLogger::create("", Assimp::Logger::VERBOSE);
 	// create a logger for debugging model loading issues
 	Assimp::DefaultLogger::get()->attachStream(new AssLogStream(), ASS_LOGGING_OPTIONS);
@@ -215,9 +316,6 @@ void CAssParser::Load(S3DModel& model, const std::string& modelFilePath)
 	const std::string& modelPath = FileSystem::GetDirectory(modelFilePath);
 	const std::string& modelName = FileSystem::GetBasename(modelFilePath);
 
-	CFileHandler file(modelFilePath, SPRING_VFS_ZIP);
-
-	std::vector<unsigned char> fileBuf;
 	// load the lua metafile containing properties unique to Spring models (must return a table)
 	std::string metaFileName = modelFilePath + ".lua";
 
@@ -227,6 +325,18 @@ void CAssParser::Load(S3DModel& model, const std::string& modelFilePath)
 	if (!CFileHandler::FileExists(metaFileName, SPRING_VFS_ZIP))
 		LOG_SL(LOG_SECTION_MODEL, L_INFO, "No meta-file '%s'. Using defaults.", metaFileName.c_str());
 
+	// skip the metafile, assimp import and all post-processing if a pre-baked copy exists
+	const std::string& cacheFileName = GetCacheFileName(modelFilePath, metaFileName);
+
+	if (!cacheFileName.empty() && LoadCachedModel(model, cacheFileName)) {
+		LOG_SL(LOG_SECTION_MODEL, L_INFO, "Model %s loaded from cache %s.", model.name.c_str(), cacheFileName.c_str());
+		return;
+	}
+
+	CFileHandler file(modelFilePath, SPRING_VFS_ZIP);
+
+	std::vector<unsigned char> fileBuf;
+
 	LuaParser metaFileParser(metaFileName, SPRING_VFS_ZIP, SPRING_VFS_ZIP);
 
 	if (!metaFileParser.Execute())
@@ -293,7 +403,10 @@ void CAssParser::Load(S3DModel& model, const std::string& modelFilePath)
 	FindTextures(&model, scene, modelTable, modelPath, modelName);
 	LOG_SL(LOG_SECTION_MODEL, L_INFO, "Loading textures. Tex1: '%s' Tex2: '%s'", model.texs[0].c_str(), model.texs[1].c_str());
 
-	textureHandlerS3O.PreloadTexture(&model, modelTable.GetBool("fliptextures", true), modelTable.GetBool("invertteamcolor", true));
+	const bool flipTextures = modelTable.GetBool("fliptextures", true);
+	const bool invertTeamColor = modelTable.GetBool("invertteamcolor", true);
+
+	textureHandlerS3O.PreloadTexture(&model, flipTextures, invertTeamColor);
 
 	// Check if bones exist
 	const auto boneNames = GetBoneNames(scene);
@@ -358,6 +471,201 @@ void CAssParser::Load(S3DModel& model, const std::string& modelFilePath)
 	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->mins: (%f,%f,%f)", model.mins[0], model.mins[1], model.mins[2]);
 	LOG_SL(LOG_SECTION_MODEL, L_DEBUG, "model->maxs: (%f,%f,%f)", model.maxs[0], model.maxs[1], model.maxs[2]);
 	LOG_SL(LOG_SECTION_MODEL, L_INFO, "Model %s Imported.", model.name.c_str());
+
+	if (!cacheFileName.empty())
+		SaveCachedModel(model, cacheFileName, flipTextures, invertTeamColor);
+}
+
+
+std::string CAssParser::GetCacheFileName(const std::string& modelFilePath, const std::string& metaFileName) const
+{
+	if (cacheDir.empty())
+		return "";
+
+	const std::string& modelArchive = CFileHandler::GetArchiveContainingFile(modelFilePath, SPRING_VFS_ZIP);
+	const std::string& metaArchive = CFileHandler::GetArchiveContainingFile(metaFileName, SPRING_VFS_ZIP);
+
+	if (modelArchive.empty())
+		return "";
+
+	// the complete checksum also covers dependencies, which textures may be pulled from
+	uint32_t hash = spring::LiteHash(modelFilePath.data(), modelFilePath.size(), ASS_CACHE_VERSION);
+	hash = spring::LiteHash(archiveScanner->GetArchiveCompleteChecksum(modelArchive), hash);
+
+	if (!metaArchive.empty())
+		hash = spring::LiteHash(archiveScanner->GetArchiveCompleteChecksum(metaArchive), hash);
+
+	// SplitLargeMeshes output depends on these
+	hash = spring::LiteHash(maxVertices, hash);
+	hash = spring::LiteHash(maxIndices, hash);
+
+	return (cacheDir + FileSystem::GetBasename(modelFilePath) + IntToString(hash, "-%08x.bin"));
+}
+
+bool CAssParser::LoadCachedModel(S3DModel& model, const std::string& cacheFileName)
+{
+	std::vector<uint8_t> cacheBuf;
+
+	{
+		FILE* cacheFile = fopen(cacheFileName.c_str(), "rb");
+
+		if (cacheFile == nullptr)
+			return false;
+
+		// read the entire entry in one go
+		fseek(cacheFile, 0, SEEK_END);
+		cacheBuf.resize(std::max(ftell(cacheFile), 0L));
+		fseek(cacheFile, 0, SEEK_SET);
+
+		const bool readOK = (fread(cacheBuf.data(), 1, cacheBuf.size(), cacheFile) == cacheBuf.size());
+
+		fclose(cacheFile);
+
+		if (!readOK || cacheBuf.size() < sizeof(AssCacheHeader))
+			return false;
+	}
+
+	AssCacheHeader header;
+	std::memcpy(&header, cacheBuf.data(), sizeof(header));
+
+	const uint8_t* dataBeg = cacheBuf.data() + sizeof(header);
+	const uint8_t* dataEnd = cacheBuf.data() + cacheBuf.size();
+
+	if (header.magic != ASS_CACHE_MAGIC || header.version != ASS_CACHE_VERSION)
+		return false;
+	if (header.dataSize != static_cast<size_t>(dataEnd - dataBeg) || header.dataHash != spring::LiteHash(dataBeg, header.dataSize, 0))
+		return false;
+
+	// entry is complete and intact, any failure past this point is a format bug
+	AssCacheReader reader(dataBeg, dataEnd);
+
+	uint8_t flipTextures = 0;
+	uint8_t invertTeamColor = 0;
+	int32_t numPieces = 0;
+
+	try {
+		reader.Read(model.name);
+		reader.Read(model.texs[0]);
+		reader.Read(model.texs[1]);
+		reader.Read(flipTextures);
+		reader.Read(invertTeamColor);
+		reader.Read(numPieces);
+
+		reader.Read(model.radius);
+		reader.Read(model.height);
+		reader.Read(model.mins);
+		reader.Read(model.maxs);
+		reader.Read(model.relMidPos);
+
+		model.type = MODELTYPE_ASS;
+		model.numPieces = numPieces;
+
+		// pieces were stored in flattened depth-first order, so appending each
+		// piece to its parent's children restores the original child ordering
+		for (int32_t i = 0; i < numPieces; i++) {
+			SAssPiece* piece = AllocPiece();
+			int32_t parentIndex = -1;
+
+			model.AddPiece(piece);
+			piece->SetParentModel(&model);
+
+			reader.Read(piece->name);
+			reader.Read(parentIndex);
+
+			if (parentIndex >= i || (parentIndex < 0) != (i == 0))
+				throw std::runtime_error("invalid piece hierarchy");
+
+			if (parentIndex >= 0) {
+				piece->parent = model.pieceObjects[parentIndex];
+				piece->parent->children.push_back(piece);
+			}
+
+			CMatrix44f bakedMatrix;
+
+			reader.Read(piece->offset);
+			reader.Read(piece->goffset);
+			reader.Read(piece->scales);
+			reader.Read(bakedMatrix);
+			reader.Read(piece->mins);
+			reader.Read(piece->maxs);
+			reader.Read(piece->numTexCoorChannels);
+			reader.Read(piece->vertices);
+			reader.Read(piece->indices);
+
+			piece->SetBakedMatrix(bakedMatrix);
+			piece->SetCollisionVolume(CollisionVolume('b', 'z', piece->maxs - piece->mins, (piece->maxs + piece->mins) * 0.5f));
+		}
+
+		if (numPieces <= 0 || !reader.AtEnd())
+			throw std::runtime_error("invalid piece count");
+	} catch (const std::runtime_error& err) {
+		LOG_SL(LOG_SECTION_MODEL, L_WARNING, "Failed to load model cache entry %s: %s", cacheFileName.c_str(), err.what());
+
+		// pieces already taken from the pool are not reclaimed, same as for failed imports
+		model.pieceObjects.clear();
+		model.numPieces = 0;
+		return false;
+	}
+
+	model.FlattenPieceTree(model.GetRootPiece());
+
+	textureHandlerS3O.PreloadTexture(&model, flipTextures, invertTeamColor);
+	return true;
+}
+
+void CAssParser::SaveCachedModel(const S3DModel& model, const std::string& cacheFileName, bool flipTextures, bool invertTeamColor)
+{
+	AssCacheWriter writer;
+
+	writer.Write(model.name);
+	writer.Write(model.texs[0]);
+	writer.Write(model.texs[1]);
+	writer.Write(static_cast<uint8_t>(flipTextures));
+	writer.Write(static_cast<uint8_t>(invertTeamColor));
+	writer.Write(static_cast<int32_t>(model.pieceObjects.size()));
+
+	writer.Write(model.radius);
+	writer.Write(model.height);
+	writer.Write(model.mins);
+	writer.Write(model.maxs);
+	writer.Write(model.relMidPos);
+
+	for (const S3DModelPiece* p: model.pieceObjects) {
+		const SAssPiece* piece = static_cast<const SAssPiece*>(p);
+		const auto parentIt = std::find(model.pieceObjects.begin(), model.pieceObjects.end(), piece->parent);
+
+		writer.Write(piece->name);
+		writer.Write(static_cast<int32_t>((piece->parent == nullptr)? -1: std::distance(model.pieceObjects.begin(), parentIt)));
+		writer.Write(piece->offset);
+		writer.Write(piece->goffset);
+		writer.Write(piece->scales);
+		writer.Write(piece->bakedMatrix);
+		writer.Write(piece->mins);
+		writer.Write(piece->maxs);
+		writer.Write(piece->numTexCoorChannels);
+		writer.Write(piece->vertices);
+		writer.Write(piece->indices);
+	}
+
+	const AssCacheHeader header = {
+		ASS_CACHE_MAGIC,
+		ASS_CACHE_VERSION,
+		static_cast<uint32_t>(writer.data.size()),
+		spring::LiteHash(writer.data.data(), writer.data.size(), 0)
+	};
+
+	FILE* cacheFile = fopen(cacheFileName.c_str(), "wb");
+
+	if (cacheFile == nullptr) {
+		LOG_SL(LOG_SECTION_MODEL, L_WARNING, "Failed to open model cache entry %s for writing", cacheFileName.c_str());
+		return;
+	}
+
+	// a partially written entry fails the size/hash check on load
+	if (fwrite(&header, sizeof(header), 1, cacheFile) != 1 || fwrite(writer.data.data(), writer.data.size(), 1, cacheFile) != 1)
+		LOG_SL(LOG_SECTION_MODEL, L_WARNING, "Failed to write model cache entry %s", cacheFileName.c_str());
+
+	fclose(cacheFile);
 }
 
 
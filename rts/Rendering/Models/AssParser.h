@@ -63,6 +63,10 @@ public:
 private:
 	static void PreProcessFileBuffer(std::vector<unsigned char>& fileBuffer);
 
+	std::string GetCacheFileName(const std::string& modelFilePath, const std::string& metaFileName) const;
+	bool LoadCachedModel(S3DModel& model, const std::string& cacheFileName);
+	static void SaveCachedModel(const S3DModel& model, const std::string& cacheFileName, bool flipTextures, bool invertTeamColor);
+
 	static void UpdatePiecesMinMaxExtents(S3DModel* model);
 	static void SetPieceName(
 		SAssPiece* piece,
@@ -149,6 +153,9 @@ private:
 	unsigned int maxVertices = 0;
 	unsigned int numPoolPieces = 0;
 
+	// pre-baked geometry cache (see {Load,Save}CachedModel); empty if disabled
+	std::string cacheDir;
+
 	std::vector<SAssPiece> piecePool;
 	spring::mutex poolMutex;
 };
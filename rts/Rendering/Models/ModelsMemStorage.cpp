@@ -8,12 +8,16 @@ ModelsUniformsStorage::ModelsUniformsStorage()
 {
 	storage[0] = dummy;
 	objectsMap.emplace(nullptr, 0);
+	dirtyMap.resize(storage.size(), 1);
 }
 
 size_t ModelsUniformsStorage::AddObjects(const CWorldObject* o)
 {
 	const size_t idx = storage.Add(ModelUniformData());
 	objectsMap[const_cast<CWorldObject*>(o)] = idx;
+
+	dirtyMap.resize(storage.size(), 1);
+	dirtyMap[idx] = 1;
 	return idx;
 }
 
@@ -23,6 +27,11 @@ void ModelsUniformsStorage::DelObjects(const CWorldObject* o)
 	assert(it != objectsMap.end());
 
 	storage.Del(it->second);
+	dirtyMap.resize(storage.size(), 1);
+
+	if (it->second < dirtyMap.size())
+		dirtyMap[it->second] = 1;
+
 	objectsMap.erase(it);
 }
 
@@ -39,9 +48,19 @@ size_t ModelsUniformsStorage::GetObjOffset(const CWorldObject* o)
 ModelUniformData& ModelsUniformsStorage::GetObjUniformsArray(const CWorldObject* o)
 {
 	size_t offset = GetObjOffset(o);
+	dirtyMap[offset] = 1;
 	return storage[offset];
 }
 
+const ModelUniformData& ModelsUniformsStorage::GetObjUniforms(const CWorldObject* o) const
+{
+	const auto it = objectsMap.find(const_cast<CWorldObject*>(o));
+	if (it != objectsMap.end())
+		return storage[it->second];
+
+	return dummy;
+}
+
 void MatricesMemStorage::SetAllDirty()
 {
 	assert(Threading::IsMainThread());
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -143,7 +144,9 @@ public:
 	size_t AddObjects(const CWorldObject* o);
 	void   DelObjects(const CWorldObject* o);
 	size_t GetObjOffset(const CWorldObject* o);
+	// marks the element for re-upload, see GetObjUniforms for read-only access
 	ModelUniformData& GetObjUniformsArray(const CWorldObject* o);
+	const ModelUniformData& GetObjUniforms(const CWorldObject* o) const;
 
 	size_t AddObjects(const SolidObjectDef* o) { return INVALID_INDEX; }
 	void   DelObjects(const SolidObjectDef* o) {}
@@ -157,6 +160,9 @@ public:
 
 	size_t Size() const { return storage.GetData().size(); }
 	const std::vector<ModelUniformData>& GetData() const { return storage.GetData(); }
+
+	std::vector<uint8_t>& GetDirtyMap() { return dirtyMap; }
+	void SetAllDirty() { std::fill(dirtyMap.begin(), dirtyMap.end(), 1); }
 public:
 	static constexpr size_t INVALID_INDEX = 0;
 private:
@@ -164,6 +170,9 @@ private:
 
 	std::unordered_map<CWorldObject*, size_t> objectsMap;
 	spring::FreeListMap<ModelUniformData> storage;
+
+	// one flag per storage element, set on write and cleared by ModelsUniformsUploader
+	std::vector<uint8_t> dirtyMap;
 };
 
 extern ModelsUniformsStorage modelsUniformsStorage;
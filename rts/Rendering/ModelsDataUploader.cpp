@@ -1,5 +1,6 @@
 #include "ModelsDataUploader.h"
 
+#include <algorithm>
 #include <limits>
 #include <cassert>
 
@@ -8,6 +9,7 @@
 #include "System/Log/ILog.h"
 #include "System/SpringMath.h"
 #include "System/TimeProfiler.h"
+#include "System/Threading/ThreadPool.h"
 #include "Sim/Misc/LosHandler.h"
 #include "Sim/Objects/SolidObject.h"
 #include "Sim/Projectiles/Projectile.h"
@@ -163,30 +165,41 @@ void MatrixUploader::UpdateDerived()
 
 	constexpr bool ENABLE_UPLOAD_OPTIMIZATION = true;
 	if (ssbo->GetBufferImplementation() == IStreamBufferConcept::Types::SB_PERSISTENTMAP && ENABLE_UPLOAD_OPTIMIZATION) {
-		const auto stt = matricesMemStorage.GetDirtyMap().begin();
-		const auto fin = matricesMemStorage.GetDirtyMap().end();
+		auto& dirtyMap = matricesMemStorage.GetDirtyMap();
 
-		auto beg = matricesMemStorage.GetDirtyMap().begin();
-		auto end = matricesMemStorage.GetDirtyMap().begin();
+		// map the whole range once, each job then copies the dirty runs of its own chunk
+		CMatrix44f* mappedPtr = ssbo->Map(clientPtr, 0, storageElemCount);
+
+		const int numElems = std::min(static_cast<int>(dirtyMap.size()), static_cast<int>(storageElemCount));
+		const int numChunks = (numElems + UPLOAD_CHUNK_SIZE - 1) / UPLOAD_CHUNK_SIZE;
 
 		static const auto dirtyPred = [](uint8_t m) -> bool { return m > 0u; };
-		while (beg != fin) {
-			beg = std::find_if    (beg, fin, dirtyPred);
-			end = std::find_if_not(beg, fin, dirtyPred);
 
-			if (beg != fin) {
-				const uint32_t offs = static_cast<uint32_t>(std::distance(stt, beg));
-				const uint32_t size = static_cast<uint32_t>(std::distance(beg, end));
+		for_mt(0, numChunks, [&](const int chunk) {
+			const auto stt = dirtyMap.begin();
+			const auto fin = stt + std::min(numElems, (chunk + 1) * UPLOAD_CHUNK_SIZE);
+
+			auto beg = stt + chunk * UPLOAD_CHUNK_SIZE;
+			auto end = beg;
+
+			while (beg != fin) {
+				beg = std::find_if    (beg, fin, dirtyPred);
+				end = std::find_if_not(beg, fin, dirtyPred);
+
+				if (beg != fin) {
+					const uint32_t offs = static_cast<uint32_t>(std::distance(stt, beg));
+					const uint32_t size = static_cast<uint32_t>(std::distance(beg, end));
+
+					memcpy(mappedPtr + offs, clientPtr + offs, size * sizeof(CMatrix44f));
 
-				CMatrix44f* mappedPtr = ssbo->Map(clientPtr, offs, size);
-				memcpy(mappedPtr, clientPtr + offs, size * sizeof(CMatrix44f));
-				ssbo->Unmap();
+					std::transform(beg, end, beg, [](uint8_t v) { return (v - 1); }); //make it less dirty
+				}
 
-				std::transform(beg, end, beg, [](uint8_t v) { return (v - 1); }); //make it less dirty
+				beg = end; //rewind
 			}
+		});
 
-			beg = end; //rewind
-		}
+		ssbo->Unmap();
 	}
 	else {
 		const CMatrix44f* clientPtr = matricesMemStorage.GetData().data();
@@ -293,6 +306,7 @@ void ModelsUniformsUploader::InitDerived()
 		return;
 
 	InitImpl(MATUNI_SSBO_BINDING_IDX, ELEM_COUNT0, ELEM_COUNTI, IStreamBufferConcept::Types::SB_BUFFERSUBDATA, true, 3);
+	modelsUniformsStorage.SetAllDirty();
 }
 
 void ModelsUniformsUploader::KillDerived()
@@ -318,16 +332,43 @@ void ModelsUniformsUploader::UpdateDerived()
 		const uint32_t newElemCount = AlignUp(storageElemCount, elemCountIncr);
 		LOG_L(L_DEBUG, "[%s::%s] sizing SSBO %s. New elements count = %u, elemCount = %u, storageElemCount = %u", className, __func__, "up", newElemCount, elemCount, storageElemCount);
 		ssbo->Resize(newElemCount);
+
+		modelsUniformsStorage.SetAllDirty(); //Resize doesn't copy the data
 	}
 
 	//update on the GPU
 	const ModelUniformData* clientPtr = modelsUniformsStorage.GetData().data();
-	ModelUniformData* mappedPtr = ssbo->Map(clientPtr, 0, storageElemCount);
+	auto& dirtyMap = modelsUniformsStorage.GetDirtyMap();
 
-	if (!ssbo->HasClientPtr())
-		memcpy(mappedPtr, clientPtr, storageElemCount * sizeof(ModelUniformData));
+	const uint32_t numElems = std::min(static_cast<uint32_t>(dirtyMap.size()), storageElemCount);
+
+	// upload only runs of changed elements; clean gaps shorter than
+	// MAX_CLEAN_GAP are bridged to keep the number of uploads down
+	for (uint32_t beg = 0; beg < numElems; ) {
+		if (dirtyMap[beg] == 0) {
+			beg = static_cast<uint32_t>(std::distance(dirtyMap.begin(), std::find(dirtyMap.begin() + beg, dirtyMap.begin() + numElems, 1)));
+			continue;
+		}
+
+		uint32_t last = beg;
+
+		for (uint32_t i = beg + 1; i < numElems && (i - last) <= MAX_CLEAN_GAP; i++) {
+			if (dirtyMap[i] != 0)
+				last = i;
+		}
+
+		const uint32_t size = last + 1 - beg;
+		ModelUniformData* mappedPtr = ssbo->Map(clientPtr, beg, size);
+
+		if (!ssbo->HasClientPtr())
+			memcpy(mappedPtr, clientPtr + beg, size * sizeof(ModelUniformData));
+
+		ssbo->Unmap();
+
+		std::fill(dirtyMap.begin() + beg, dirtyMap.begin() + last + 1, 0);
+		beg = last + 1;
+	}
 
-	ssbo->Unmap();
 	ssbo->BindBufferRange(bindingIdx);
 	ssbo->SwapBuffer();
 }
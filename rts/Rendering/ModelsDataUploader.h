@@ -85,6 +85,9 @@ private:
 	static constexpr uint32_t MATRIX_SSBO_BINDING_IDX = 0;
 	static constexpr uint32_t ELEM_COUNT0 = 1u << 13;
 	static constexpr uint32_t ELEM_COUNTI = 1u << 12;
+
+	// dirty-map elements scanned and copied per upload job
+	static constexpr int UPLOAD_CHUNK_SIZE = 1 << 12;
 };
 
 class ModelsUniformsUploader : public TypedStorageBufferUploader<ModelUniformData, ModelsUniformsUploader> {
@@ -103,6 +106,9 @@ private:
 	static constexpr uint32_t MATUNI_SSBO_BINDING_IDX = 1;
 	static constexpr uint32_t ELEM_COUNT0 = 1u << 12;
 	static constexpr uint32_t ELEM_COUNTI = 1u << 11;
+
+	// clean elements between two dirty ones that are still uploaded as one range
+	static constexpr uint32_t MAX_CLEAN_GAP = 32;
 };
 
 #define matrixUploader MatrixUploader::GetInstance()
@@ -1,6 +1,9 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <utility>
 #include <cstring>
 #include <memory>
@@ -8,6 +11,8 @@
 #include <IL/il.h>
 #include <SDL_video.h>
 
+// must precede BranchPrediction.h
+#include "System/ConcurrentQueue.h"
 #include "Rendering/GL/myGL.h"
 #ifndef HEADLESS
 	#include "System/TimeProfiler.h"
@@ -20,6 +25,7 @@
 #include "System/ScopedFPUSettings.h"
 #include "System/ContainerUtil.h"
 #include "System/SafeUtil.h"
+#include "System/MemPoolTypes.h"
 #include "System/Log/ILog.h"
 #include "System/Threading/ThreadPool.h"
 #include "System/FileSystem/DataDirsAccess.h"
@@ -36,6 +42,7 @@ struct InitializeOpenIL {
 
 class TexMemPool;
 class TexNoMemPool;
+class TexSizeClassPool;
 
 class ITexMemPool {
 public:
@@ -52,13 +59,13 @@ public:
 	virtual size_t AllocIdx(size_t size) = 0;
 	virtual size_t AllocIdxRaw(size_t size) = 0;
 
-	uint8_t* Alloc(size_t size) {
+	virtual uint8_t* Alloc(size_t size) {
 		std::lock_guard<spring::mutex> lck(bmpMutex);
 		return (AllocRaw(size));
 	}
 	virtual uint8_t* AllocRaw(size_t size) = 0;
 
-	void Free(uint8_t* mem, size_t size) {
+	virtual void Free(uint8_t* mem, size_t size) {
 		std::lock_guard<spring::mutex> lck(bmpMutex);
 		FreeRaw(mem, size);
 	}
@@ -72,16 +79,16 @@ public:
 
 	spring::mutex& GetMutex() { return bmpMutex; }
 public:
-	static void Init(size_t size);
+	static void Init(size_t size, bool concurrent);
 	static void Kill();
 	static inline std::unique_ptr<ITexMemPool> texMemPool = {};
 protected:
-	size_t numAllocs = 0;
-	size_t allocSize = 0;
-	size_t numFrees = 0;
-	size_t freeSize = 0;
+	std::atomic<size_t> numAllocs = {0};
+	std::atomic<size_t> allocSize = {0};
+	std::atomic<size_t> numFrees = {0};
+	std::atomic<size_t> freeSize = {0};
 
-	// libIL is not thread-safe, neither are {Alloc,Free}
+	// libIL is not thread-safe, neither are {Alloc,Free} except in TexSizeClassPool
 	spring::mutex bmpMutex;
 };
 
@@ -213,7 +220,7 @@ public:
 			memArray.resize(size, 0);
 		}
 
-		LOG_L(L_INFO, "[TexMemPool::%s] poolSize=" _STPF_ "u allocSize=" _STPF_ "u texCount=" _STPF_ "u", __func__, size, allocSize, numAllocs - numFrees);
+		LOG_L(L_INFO, "[TexMemPool::%s] poolSize=" _STPF_ "u allocSize=" _STPF_ "u texCount=" _STPF_ "u", __func__, size, allocSize.load(), numAllocs - numFrees);
 	}
 
 	bool Defrag() override {
@@ -314,9 +321,139 @@ public:
 		  uint8_t* GetRawMem(size_t memIdx)       override { return (memIdx == size_t(-1)) ? nullptr : reinterpret_cast<uint8_t*>(memIdx); }
 };
 
-void ITexMemPool::Init(size_t size)
+// serves each request from a lock-free free-list of equally sized chunks, so
+// {Alloc,Free} can be called concurrently by parallel loaders without taking
+// bmpMutex; freed chunks are kept for reuse up to the configured pool size
+class TexSizeClassPool : public ITexMemPool {
+private:
+	// smmalloc only handles requests up to NUM_SMALL_BUCKETS * 16 bytes itself
+	static constexpr uint32_t NUM_SMALL_BUCKETS = 64;
+	static constexpr size_t MAX_SMALL_SIZE = NUM_SMALL_BUCKETS * 16;
+
+	// four classes per power of two, i.e. at most 25% slack per chunk
+	static constexpr size_t NUM_CLASS_STEPS = 4;
+	static constexpr size_t MIN_CLASS_SHIFT = 10;
+	static constexpr size_t MAX_CLASS_SHIFT = 30;
+	static constexpr size_t NUM_CLASSES = (MAX_CLASS_SHIFT - MIN_CLASS_SHIFT) * NUM_CLASS_STEPS;
+
+	static size_t GetClassIndex(size_t size) {
+		const size_t shift = std::bit_width(size - 1) - 1;
+		const size_t step = ((size - 1) >> (shift - 2)) & (NUM_CLASS_STEPS - 1);
+
+		return ((shift - MIN_CLASS_SHIFT) * NUM_CLASS_STEPS + step);
+	}
+	static size_t GetClassSize(size_t classIdx) {
+		const size_t shift = classIdx / NUM_CLASS_STEPS + MIN_CLASS_SHIFT;
+		const size_t step = classIdx % NUM_CLASS_STEPS;
+
+		return ((size_t(1) << shift) + (step + 1) * (size_t(1) << (shift - 2)));
+	}
+public:
+	~TexSizeClassPool() override {
+		DefragRaw();
+	}
+
+	size_t Size() const override { return retainLimit; }
+	size_t AllocIdx(size_t size) override { return reinterpret_cast<std::uintptr_t>(Alloc(size)); }
+	size_t AllocIdxRaw(size_t size) override { return reinterpret_cast<std::uintptr_t>(AllocRaw(size)); }
+
+	uint8_t* Alloc(size_t size) override { return (AllocRaw(size)); }
+	uint8_t* AllocRaw(size_t size) override {
+		if (size == 0)
+			return nullptr;
+
+		numAllocs += 1;
+		allocSize += size;
+
+		if (size <= MAX_SMALL_SIZE)
+			return (static_cast<uint8_t*>(smallPool.allocMem(size)));
+
+		if (size > GetClassSize(NUM_CLASSES - 1))
+			return (new uint8_t[size]);
+
+		const size_t classIdx = GetClassIndex(size);
+
+		uint8_t* mem = nullptr;
+
+		if (freeChunks[classIdx].try_dequeue(mem)) {
+			freeSize -= GetClassSize(classIdx);
+			return mem;
+		}
+
+		return (new uint8_t[GetClassSize(classIdx)]);
+	}
+
+	void Free(uint8_t* mem, size_t size) override { FreeRaw(mem, size); }
+	void FreeRaw(uint8_t* mem, size_t size) override {
+		if (size == 0 || mem == nullptr)
+			return;
+
+		numFrees += 1;
+		allocSize -= size;
+
+		if (size <= MAX_SMALL_SIZE) {
+			smallPool.freeMem(mem);
+			return;
+		}
+
+		if (size > GetClassSize(NUM_CLASSES - 1)) {
+			delete[] mem;
+			return;
+		}
+
+		const size_t classIdx = GetClassIndex(size);
+		const size_t classSize = GetClassSize(classIdx);
+
+		// racing frees may overshoot the limit by a few chunks, which is harmless
+		if ((freeSize + classSize) > retainLimit) {
+			delete[] mem;
+			return;
+		}
+
+		freeSize += classSize;
+		freeChunks[classIdx].enqueue(mem);
+	}
+
+	void Resize(size_t size) override {
+		retainLimit = std::max(retainLimit.load(), size);
+	}
+
+	// releases all retained chunks back to the heap
+	bool Defrag() override { return (DefragRaw()); }
+
+	const uint8_t* GetRawMem(size_t memIdx) const override { return (memIdx == size_t(-1)) ? nullptr : reinterpret_cast<uint8_t*>(memIdx); }
+	      uint8_t* GetRawMem(size_t memIdx)       override { return (memIdx == size_t(-1)) ? nullptr : reinterpret_cast<uint8_t*>(memIdx); }
+
+private:
+	bool DefragRaw() {
+		uint8_t* mem = nullptr;
+		bool ret = false;
+
+		for (size_t classIdx = 0; classIdx < NUM_CLASSES; classIdx++) {
+			while (freeChunks[classIdx].try_dequeue(mem)) {
+				freeSize -= GetClassSize(classIdx);
+				delete[] mem;
+				ret = true;
+			}
+		}
+
+		return ret;
+	}
+
+private:
+	PassThroughPool<NUM_SMALL_BUCKETS, 256 * 1024> smallPool;
+
+	std::array<moodycamel::ConcurrentQueue<uint8_t*>, NUM_CLASSES> freeChunks;
+	std::atomic<size_t> retainLimit = {0};
+};
+
+void ITexMemPool::Init(size_t size, bool concurrent)
 {
-	if (size == 0) {
+	if (concurrent) {
+		if (texMemPool == nullptr || typeid(*texMemPool.get()) != typeid(TexSizeClassPool))
+			texMemPool = std::make_unique<TexSizeClassPool>();
+	}
+	else if (size == 0) {
 		if (texMemPool == nullptr || typeid(*texMemPool.get()) != typeid(TexNoMemPool))
 			texMemPool = std::make_unique<TexNoMemPool>();
 	}
@@ -1011,11 +1148,11 @@ bool CBitmap::CanBeKilled()
 	return ITexMemPool::texMemPool->NoCurrentAllocations();
 }
 
-void CBitmap::InitPool(size_t size)
+void CBitmap::InitPool(size_t size, bool concurrent)
 {
 	// only allow expansion; config-size is in MB
 	size *= (1024 * 1024);
-	ITexMemPool::Init(size);
+	ITexMemPool::Init(size, concurrent);
 	ITexMemPool::texMemPool->Resize(size);
 	ITexMemPool::texMemPool->Defrag();
 }
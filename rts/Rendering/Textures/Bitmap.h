@@ -31,7 +31,7 @@ public:
 	CBitmap CreateRescaled(int newx, int newy) const;
 
 	static bool CanBeKilled();
-	static void InitPool(size_t size);
+	static void InitPool(size_t size, bool concurrent);
 	static void KillPool();
 
 	void Alloc(int w, int h, int c, uint32_t glType);
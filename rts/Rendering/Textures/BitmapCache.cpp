@@ -0,0 +1,299 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Rendering/GL/myGL.h"
+#include "BitmapCache.h"
+#include "Bitmap.h"
+#include "Rendering/GlobalRendering.h"
+#include "System/SpringHash.h"
+#include "System/StringUtil.h"
+#include "System/Config/ConfigHandler.h"
+#include "System/FileSystem/ArchiveScanner.h"
+#include "System/FileSystem/DataDirsAccess.h"
+#include "System/FileSystem/FileHandler.h"
+#include "System/FileSystem/FileQueryFlags.h"
+#include "System/FileSystem/FileSystem.h"
+#include "System/FileSystem/FileSystemAbstraction.h"
+#include "System/Log/ILog.h"
+#include "System/Threading/ThreadPool.h"
+
+#ifndef HEADLESS
+	#include "lib/squish/squish.h"
+#endif
+
+CONFIG(bool, TextureCache).defaultValue(true).headlessValue(false).description("Cache decoded and mipmapped model textures in the cache directory to skip decoding them on later loads. Entries are DXT5-compressed if CompressTextures is enabled.");
+
+
+#ifndef HEADLESS
+
+// bump when the entry layout or the mipmap filter changes
+static constexpr uint32_t BMP_CACHE_MAGIC   = 0x43504D42; // "BMPC"
+static constexpr uint32_t BMP_CACHE_VERSION = 1;
+
+static constexpr int SQUISH_FLAGS = squish::kDxt5 | squish::kColourRangeFit;
+
+
+struct BitmapCacheHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t format; // GL_RGBA or GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+	uint32_t numLevels;
+	uint32_t dataSize;
+	uint32_t dataHash;
+};
+
+struct BitmapCacheLevel {
+	uint32_t xsize;
+	uint32_t ysize;
+	uint32_t size;
+};
+
+
+static const std::string& GetCacheDir()
+{
+	static const std::string cacheDir = configHandler->GetBool("TextureCache")?
+		dataDirsAccess.LocateDir(FileSystem::GetCacheDir() + "/textures/", FileQueryFlags::WRITE | FileQueryFlags::CREATE_DIRS):
+		"";
+
+	return cacheDir;
+}
+
+static bool UseCompression()
+{
+	return (globalRendering->compressTextures && GLEW_EXT_texture_compression_s3tc);
+}
+
+// 2x2 box filter, same as the GL-side mipmap generation; clamps odd edges
+static void DownSampleRGBA8(const uint8_t* src, int sx, int sy, uint8_t* dst, int dx, int dy)
+{
+	for (int y = 0; y < dy; y++) {
+		const int y0 = std::min(y * 2 + 0, sy - 1);
+		const int y1 = std::min(y * 2 + 1, sy - 1);
+
+		for (int x = 0; x < dx; x++) {
+			const int x0 = std::min(x * 2 + 0, sx - 1);
+			const int x1 = std::min(x * 2 + 1, sx - 1);
+
+			const uint8_t* p00 = &src[(y0 * sx + x0) * 4];
+			const uint8_t* p01 = &src[(y0 * sx + x1) * 4];
+			const uint8_t* p10 = &src[(y1 * sx + x0) * 4];
+			const uint8_t* p11 = &src[(y1 * sx + x1) * 4];
+
+			for (int c = 0; c < 4; c++) {
+				dst[(y * dx + x) * 4 + c] = static_cast<uint8_t>((p00[c] + p01[c] + p10[c] + p11[c] + 2) >> 2);
+			}
+		}
+	}
+}
+
+
+static bool ParseEntry(const BitmapCacheHeader& header, const uint8_t* dataBeg, const uint8_t* dataEnd, CBitmap& bitmap)
+{
+	if (header.format == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT && !GLEW_EXT_texture_compression_s3tc)
+		return false;
+
+	nv_dds::CTexture baseImage;
+
+	for (uint32_t i = 0; i < header.numLevels; i++) {
+		BitmapCacheLevel level;
+
+		if (static_cast<size_t>(dataEnd - dataBeg) < sizeof(level))
+			return false;
+
+		std::memcpy(&level, dataBeg, sizeof(level));
+		dataBeg += sizeof(level);
+
+		if (level.xsize == 0 || level.ysize == 0 || level.size == 0 || level.size > static_cast<size_t>(dataEnd - dataBeg))
+			return false;
+
+		if (i == 0) {
+			baseImage.create(level.xsize, level.ysize, 1, level.size, dataBeg);
+		} else {
+			baseImage.add_mipmap(level.xsize, level.ysize, 1, level.size, dataBeg);
+		}
+
+		dataBeg += level.size;
+	}
+
+	// drop any previously held pixel data
+	bitmap = CBitmap();
+
+	bitmap.ddsimage.create_textureFlat(header.format, 4, baseImage);
+	bitmap.xsize = baseImage.get_width();
+	bitmap.ysize = baseImage.get_height();
+	bitmap.channels = 4;
+	bitmap.textype = GL_TEXTURE_2D;
+	bitmap.compressed = true;
+	return true;
+}
+
+
+bool CBitmapCache::IsEnabled() { return (!GetCacheDir().empty() && globalRendering->supportNonPowerOfTwoTex); }
+
+std::string CBitmapCache::GetEntryName(const std::string& fileName, uint32_t variant)
+{
+	if (!IsEnabled())
+		return "";
+
+	// identify the file by where it lives on disk instead of hashing its contents;
+	// files inside packed archives are stamped with their archive's path, size and
+	// modification time
+	std::string stampPath = CFileHandler::GetFileAbsolutePath(fileName, SPRING_VFS_RAW_FIRST);
+
+	if (stampPath.empty()) {
+		const std::string& archiveName = CFileHandler::GetArchiveContainingFile(fileName, SPRING_VFS_RAW_FIRST);
+
+		if (archiveName.empty())
+			return "";
+
+		const std::string& archiveFile = archiveScanner->ArchiveFromName(archiveName);
+		stampPath = archiveScanner->GetArchivePath(archiveFile) + archiveFile;
+	}
+
+	const uint32_t stampSize = FileSystemAbstraction::GetFileSize(stampPath);
+	const uint32_t stampTime = FileSystemAbstraction::GetFileModificationTime(stampPath);
+
+	if (stampTime == 0)
+		return "";
+
+	const std::string& lowerName = StringToLower(fileName);
+
+	uint32_t hash = spring::LiteHash(stampPath.data(), stampPath.size(), BMP_CACHE_VERSION);
+	hash = spring::LiteHash(lowerName.data(), lowerName.size(), hash);
+	hash = spring::LiteHash(stampSize, hash);
+	hash = spring::LiteHash(stampTime, hash);
+	hash = spring::LiteHash(variant, hash);
+	hash = spring::LiteHash(UseCompression(), hash);
+
+	return (GetCacheDir() + FileSystem::GetBasename(fileName) + IntToString(hash, "-%08x.bin"));
+}
+
+
+bool CBitmapCache::Load(const std::string& entryName, CBitmap& bitmap)
+{
+	std::vector<uint8_t> entryBuf;
+
+	{
+		FILE* entryFile = fopen(entryName.c_str(), "rb");
+
+		if (entryFile == nullptr)
+			return false;
+
+		fseek(entryFile, 0, SEEK_END);
+		entryBuf.resize(std::max(ftell(entryFile), 0L));
+		fseek(entryFile, 0, SEEK_SET);
+
+		const bool readOK = (fread(entryBuf.data(), 1, entryBuf.size(), entryFile) == entryBuf.size());
+
+		fclose(entryFile);
+
+		if (!readOK || entryBuf.size() < sizeof(BitmapCacheHeader))
+			return false;
+	}
+
+	BitmapCacheHeader header;
+	std::memcpy(&header, entryBuf.data(), sizeof(header));
+
+	const uint8_t* dataBeg = entryBuf.data() + sizeof(header);
+	const uint8_t* dataEnd = entryBuf.data() + entryBuf.size();
+
+	if (header.magic != BMP_CACHE_MAGIC || header.version != BMP_CACHE_VERSION || header.numLevels == 0)
+		return false;
+	if (header.dataSize != static_cast<size_t>(dataEnd - dataBeg) || header.dataHash != spring::LiteHash(dataBeg, header.dataSize, 0))
+		return false;
+
+	return (ParseEntry(header, dataBeg, dataEnd, bitmap));
+}
+
+static void WriteEntry(const std::string& entryName, std::vector<uint8_t>& levelData, int xsize, int ysize, bool compress)
+{
+	std::vector<uint8_t> entryData;
+	std::vector<uint8_t> nextData;
+	std::vector<uint8_t> blockData;
+
+	uint32_t numLevels = 0;
+
+	for (; ; numLevels++) {
+		const uint8_t* levelMem = levelData.data();
+
+		BitmapCacheLevel level = {uint32_t(xsize), uint32_t(ysize), uint32_t(levelData.size())};
+
+		if (compress) {
+			blockData.resize(squish::GetStorageRequirements(xsize, ysize, SQUISH_FLAGS));
+			squish::CompressImage(levelData.data(), xsize, ysize, blockData.data(), SQUISH_FLAGS);
+
+			level.size = blockData.size();
+			levelMem = blockData.data();
+		}
+
+		entryData.insert(entryData.end(), reinterpret_cast<const uint8_t*>(&level), reinterpret_cast<const uint8_t*>(&level) + sizeof(level));
+		entryData.insert(entryData.end(), levelMem, levelMem + level.size);
+
+		if (xsize == 1 && ysize == 1)
+			break;
+
+		const int nxsize = std::max(xsize >> 1, 1);
+		const int nysize = std::max(ysize >> 1, 1);
+
+		nextData.resize(nxsize * nysize * 4);
+		DownSampleRGBA8(levelData.data(), xsize, ysize, nextData.data(), nxsize, nysize);
+		levelData.swap(nextData);
+
+		xsize = nxsize;
+		ysize = nysize;
+	}
+
+	const BitmapCacheHeader header = {
+		BMP_CACHE_MAGIC,
+		BMP_CACHE_VERSION,
+		uint32_t(compress? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT: GL_RGBA),
+		numLevels + 1,
+		uint32_t(entryData.size()),
+		spring::LiteHash(entryData.data(), entryData.size(), 0)
+	};
+
+	FILE* entryFile = fopen(entryName.c_str(), "wb");
+
+	if (entryFile == nullptr) {
+		LOG_L(L_WARNING, "[BitmapCache::%s] failed to open entry \"%s\" for writing", __func__, entryName.c_str());
+		return;
+	}
+
+	// a partially written entry fails the size/hash check on load
+	if (fwrite(&header, sizeof(header), 1, entryFile) != 1 || fwrite(entryData.data(), entryData.size(), 1, entryFile) != 1)
+		LOG_L(L_WARNING, "[BitmapCache::%s] failed to write entry \"%s\"", __func__, entryName.c_str());
+
+	fclose(entryFile);
+}
+
+bool CBitmapCache::Store(const std::string& entryName, const CBitmap& bitmap)
+{
+	if (bitmap.compressed || bitmap.channels != 4 || bitmap.dataType != GL_UNSIGNED_BYTE || bitmap.GetMemSize() == 0)
+		return false;
+
+	// DXT blocks are 4x4; smaller mip levels are padded by squish
+	const bool compress = (UseCompression() && (bitmap.xsize % 4) == 0 && (bitmap.ysize % 4) == 0);
+
+	std::vector<uint8_t> pixels(bitmap.GetRawMem(), bitmap.GetRawMem() + bitmap.GetMemSize());
+
+	// mipmapping and compression are far slower than decoding, keep them off the
+	// (model-)loading thread; the bitmap itself is used as decoded this time
+	ThreadPool::Enqueue([entryName, pixels = std::move(pixels), xsize = bitmap.xsize, ysize = bitmap.ysize, compress]() mutable {
+		WriteEntry(entryName, pixels, xsize, ysize, compress);
+	});
+
+	return true;
+}
+
+#else
+
+bool CBitmapCache::IsEnabled() { return false; }
+std::string CBitmapCache::GetEntryName(const std::string& fileName, uint32_t variant) { return ""; }
+bool CBitmapCache::Load(const std::string& entryName, CBitmap& bitmap) { return false; }
+bool CBitmapCache::Store(const std::string& entryName, const CBitmap& bitmap) { return false; }
+
+#endif
@@ -0,0 +1,34 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef _BITMAP_CACHE_H
+#define _BITMAP_CACHE_H
+
+#include <cstdint>
+#include <string>
+
+class CBitmap;
+
+/**
+ * Persistent on-disk cache of decoded and fully mipmapped bitmaps, optionally
+ * DXT5-compressed (if CompressTextures is set) so that later loads of the same
+ * image skip both DevIL decoding and mipmap generation.
+ *
+ * Entries are keyed by the source file's path, size and modification time (or
+ * those of the archive containing it) plus a caller supplied variant tag that
+ * describes any transforms applied after decoding, and are loaded back as
+ * precompressed DDS-style bitmaps (CBitmap::compressed).
+ */
+class CBitmapCache {
+public:
+	static bool IsEnabled();
+
+	/// returns the entry path for file <fileName> transformed as <variant>, or "" if uncacheable
+	static std::string GetEntryName(const std::string& fileName, uint32_t variant);
+
+	/// replaces <bitmap> by the cached entry, false if there is no (valid) entry
+	static bool Load(const std::string& entryName, CBitmap& bitmap);
+	/// queues a background job writing the mipmapped form of RGBA8 <bitmap> to <entryName>
+	static bool Store(const std::string& entryName, const CBitmap& bitmap);
+};
+
+#endif // _BITMAP_CACHE_H
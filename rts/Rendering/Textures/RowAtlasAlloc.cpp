@@ -5,7 +5,6 @@
 
 #include <algorithm>
 #include <vector>
-#include <set>
 
 // texture spacing in the atlas (in pixels)
 static constexpr int ATLAS_PADDING = 1;
@@ -100,15 +99,11 @@ bool CRowAtlasAlloc::Allocate()
 	std::vector<SAtlasEntry*> memtextures;
 	memtextures.reserve(entries.size());
 
-	std::set<std::string> sortedNames;
+	// CompareTex falls back to the (unique) names, so the order does not depend on the map
 	for (auto& entry : entries) {
-		sortedNames.insert(entry.first);
+		memtextures.push_back(&entry.second);
 	}
-
-	for (auto& name : sortedNames) {
-		memtextures.push_back(&entries[name]);
-	}
-	std::stable_sort(memtextures.begin(), memtextures.end(), CRowAtlasAlloc::CompareTex);
+	std::sort(memtextures.begin(), memtextures.end(), CRowAtlasAlloc::CompareTex);
 
 	// find space for them
 	for (auto& curtex: memtextures) {
@@ -11,6 +11,7 @@
 #include "Rendering/Models/3DModel.h"
 #include "Rendering/Models/ModelsLock.h"
 #include "Rendering/Textures/Bitmap.h"
+#include "Rendering/Textures/BitmapCache.h"
 #include "System/StringUtil.h"
 #include "System/Exceptions.h"
 #include "System/Log/ILog.h"
@@ -150,18 +151,32 @@ unsigned int CS3OTextureHandler::LoadAndCacheTexture(
 
 		bitmap = &(iter->second);
 
-		if (!bitmap->Load(textureName) && !bitmap->Load("unittextures/" + textureName)) {
-			if (texNum == 0)
-				LOG_L(L_WARNING, "[%s] could not load primary texture \"%s\" from model \"%s\"", __func__, textureName.c_str(), model->name.c_str());
+		// cache entries hold the bitmap *after* the transforms below
+		const uint32_t cacheVariant = (invertAxis << 0) | (invertAlpha << 1);
 
-			// file not found (or headless build), set a single pixel so model is visible
-			bitmap->AllocDummy(SColor(255 * (texNum == 0), 0, 0, 255 * (1 - invertAlpha)));
-		}
+		std::string cacheEntryName = CBitmapCache::GetEntryName(textureName, cacheVariant);
+
+		if (cacheEntryName.empty())
+			cacheEntryName = CBitmapCache::GetEntryName("unittextures/" + textureName, cacheVariant);
+
+		if (cacheEntryName.empty() || !CBitmapCache::Load(cacheEntryName, *bitmap)) {
+			if (!bitmap->Load(textureName) && !bitmap->Load("unittextures/" + textureName)) {
+				if (texNum == 0)
+					LOG_L(L_WARNING, "[%s] could not load primary texture \"%s\" from model \"%s\"", __func__, textureName.c_str(), model->name.c_str());
 
-		if (invertAxis)
-			bitmap->ReverseYAxis();
-		if (invertAlpha)
-			bitmap->InvertAlpha();
+				// file not found (or headless build), set a single pixel so model is visible
+				bitmap->AllocDummy(SColor(255 * (texNum == 0), 0, 0, 255 * (1 - invertAlpha)));
+				cacheEntryName.clear();
+			}
+
+			if (invertAxis)
+				bitmap->ReverseYAxis();
+			if (invertAlpha)
+				bitmap->InvertAlpha();
+
+			if (!cacheEntryName.empty())
+				CBitmapCache::Store(cacheEntryName, *bitmap);
+		}
 	}
 
 	const unsigned int texID = preloadCall ? 0 : bitmap->CreateMipMapTexture();
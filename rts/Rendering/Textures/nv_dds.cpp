@@ -188,7 +188,6 @@ CDDSImage::CDDSImage()
 }
 
 
-#if 0
 void CDDSImage::create_textureFlat(unsigned int format, unsigned int components, const CTexture &baseImage)
 {
     assert(format != 0);
@@ -207,6 +206,7 @@ void CDDSImage::create_textureFlat(unsigned int format, unsigned int components,
     m_valid = true;
 }
 
+#if 0
 void CDDSImage::create_texture3D(unsigned int format, unsigned int components, const CTexture &baseImage)
 {
     assert(format != 0);
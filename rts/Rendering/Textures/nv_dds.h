@@ -166,6 +166,10 @@ namespace nv_dds
             {
                 m_mipmaps.emplace_back();
             }
+            inline void add_mipmap(unsigned int w, unsigned int h, unsigned int d, unsigned int imgsize, const unsigned char *pixels)
+            {
+                m_mipmaps.emplace_back(w, h, d, imgsize, pixels);
+            }
 
             inline unsigned int get_num_mipmaps() const { return (unsigned int)m_mipmaps.size(); }
 
@@ -208,8 +212,8 @@ namespace nv_dds
 				return *this;
 			}
 
-			#if 0
             void create_textureFlat(unsigned int format, unsigned int components, const CTexture &baseImage);
+			#if 0
             void create_texture3D(unsigned int format, unsigned int components, const CTexture &baseImage);
             void create_textureCubemap(unsigned int format, unsigned int components,
                                        const CTexture &positiveX, const CTexture &negativeX,
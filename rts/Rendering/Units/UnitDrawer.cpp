@@ -9,6 +9,7 @@
 #include "Game/GameSetup.h"
 #include "Game/GlobalUnsynced.h"
 #include "Game/Players/Player.h"
+#include "Game/SelectedUnitsHandler.h"
 #include "Game/UI/MiniMap.h"
 #include "Map/MapInfo.h"
 #include "Map/ReadMap.h"
@@ -113,6 +114,166 @@ public:
 
 		return scale;
 	}
+
+	static const uint8_t* GetMiniMapIconColor(const CUnit* unit) {
+		if (!minimap->UseSimpleColors())
+			return teamHandler.Team(unit->team)->color;
+
+		if (unit->team == gu->myTeam)
+			return minimap->GetMyTeamIconColor();
+
+		if (teamHandler.Ally(gu->myAllyTeam, unit->allyteam))
+			return minimap->GetAllyTeamIconColor();
+
+		return minimap->GetEnemyTeamIconColor();
+	}
+
+	static bool HasMiniMapIcon(const CUnit* unit) {
+		return (!unit->noMinimap && unit->myIcon != nullptr && unit->drawIcon && !unit->IsInVoid());
+	}
+
+	// icon center (x, z) and scale, if <unit> currently has a minimap icon
+	static bool GetMiniMapIconState(const CUnit* unit, float4& iconState) {
+		if (!HasMiniMapIcon(unit))
+			return false;
+
+		const float3& iconPos = (!gu->spectatingFullView) ?
+			unit->GetObjDrawErrorPos(gu->myAllyTeam) :
+			unit->GetObjDrawMidPos();
+
+		iconState = {iconPos.x, iconPos.z, GetUnitIconScale(unit), 1.0f};
+		return true;
+	}
+
+	// quad corners (x0, y0, x1, y1) in top-down minimap coordinates
+	static float4 GetMiniMapIconRect(const float4& iconState) {
+		const float iconSizeX = (iconState.z * minimap->GetUnitSizeX());
+		const float iconSizeY = (iconState.z * minimap->GetUnitSizeY());
+
+		float x0 = iconState.x - iconSizeX;
+		float x1 = iconState.x + iconSizeX;
+		float y0 = iconState.y - iconSizeY;
+		float y1 = iconState.y + iconSizeY;
+
+		if (minimap->GetFlipped()) {
+			x0 = mapDims.mapx * SQUARE_SIZE - x0;
+			x1 = mapDims.mapx * SQUARE_SIZE - x1;
+			y0 = mapDims.mapy * SQUARE_SIZE - y0;
+			y1 = mapDims.mapy * SQUARE_SIZE - y1;
+			std::swap(x0, x1);
+			std::swap(y0, y1);
+		}
+
+		return {x0, y0, x1, y1};
+	}
+
+	static bool GetMiniMapIconRect(const CUnit* unit, float4& iconRect) {
+		float4 iconState;
+
+		if (!GetMiniMapIconState(unit, iconState))
+			return false;
+
+		iconRect = GetMiniMapIconRect(iconState);
+		return true;
+	}
+
+	static void UpdateMiniMapIconBatches(CUnitDrawerData* mdd) {
+		// anything that changes all quads at once forces a full refresh (no padding, it is hashed)
+		struct {
+			float unitSizeX;
+			float unitSizeY;
+			float flipped;
+			int sizeX;
+			int myTeam;
+			int myAllyTeam;
+			int fullView;
+			int useIcons;
+			int simpleColors;
+		} params = {
+			minimap->GetUnitSizeX(),
+			minimap->GetUnitSizeY(),
+			minimap->GetFlipped(),
+			minimap->GetSizeX(),
+			gu->myTeam,
+			gu->myAllyTeam,
+			gu->spectatingFullView,
+			minimap->UseUnitIcons(),
+			minimap->UseSimpleColors(),
+		};
+
+		const uint32_t paramsHash = spring::LiteHash(&params, sizeof(params));
+		const bool newParams = (paramsHash != mdd->miniMapIconParams);
+		// icon positions only change noticeably once per sim-frame
+		const bool newFrame = (gs->frameNum != mdd->miniMapIconFrame);
+
+		mdd->miniMapIconParams = paramsHash;
+		mdd->miniMapIconFrame = gs->frameNum;
+
+		// quads are only rewritten once their icon moved by half a minimap pixel
+		const float moveThreshold = 0.5f * (mapDims.mapx * SQUARE_SIZE) / std::max(minimap->GetSizeX(), 1);
+
+		auto& iconBatches = mdd->GetMiniMapIconBatches();
+
+		for (const auto& [icon, units] : mdd->GetUnitsByIcon()) {
+			if (icon == nullptr)
+				continue;
+
+			auto& batch = iconBatches[icon];
+
+			if (!newParams && !newFrame && !batch.dirty)
+				continue;
+
+			if (batch.state.size() != units.size() || newParams) {
+				batch.verts.assign(units.size() * 6, VA_TYPE_2DTC{});
+				batch.state.assign(units.size(), float4{});
+			}
+
+			batch.dirty = false;
+
+			const auto UpdateQuad = [&](const int i) {
+				const CUnit* unit = units[i];
+
+				float4& oldState = batch.state[i];
+				float4 newState;
+
+				VA_TYPE_2DTC* quad = &batch.verts[i * 6];
+
+				if (!GetMiniMapIconState(unit, newState)) {
+					if (oldState.w != 0.0f)
+						std::fill(quad, quad + 6, VA_TYPE_2DTC{});
+
+					oldState = float4{};
+					return;
+				}
+
+				const SColor color = GetMiniMapIconColor(unit);
+				const bool sameColor = (quad[0].c.r == color.r && quad[0].c.g == color.g && quad[0].c.b == color.b && quad[0].c.a == color.a);
+
+				if (oldState.w != 0.0f && sameColor && oldState.z == newState.z) {
+					if (std::fabs(newState.x - oldState.x) < moveThreshold && std::fabs(newState.y - oldState.y) < moveThreshold)
+						return;
+				}
+
+				const float4 r = GetMiniMapIconRect(oldState = newState);
+
+				// same triangles as AddQuadTriangles, {bl, tl, tr} and {bl, tr, br}
+				quad[0] = { r.x, r.w, 0.0f, 1.0f, color };
+				quad[1] = { r.x, r.y, 0.0f, 0.0f, color };
+				quad[2] = { r.z, r.y, 1.0f, 0.0f, color };
+				quad[3] = { r.x, r.w, 0.0f, 1.0f, color };
+				quad[4] = { r.z, r.y, 1.0f, 0.0f, color };
+				quad[5] = { r.z, r.w, 1.0f, 1.0f, color };
+			};
+
+			if (units.size() >= 512) {
+				for_mt(0, units.size(), UpdateQuad);
+			} else {
+				for (size_t i = 0; i < units.size(); i++) {
+					UpdateQuad(i);
+				}
+			}
+		}
+	}
 };
 
 
@@ -292,13 +453,16 @@ void CUnitDrawerLegacy::DrawUnitMiniMapIcons() const
 	sh.Enable();
 	sh.SetUniform("alphaCtrl", 0.0f, 1.0f, 0.0f, 0.0f); // GL_GREATER > 0.0
 
-	static constexpr uint8_t defaultColor[4] = { 255, 255, 255, 255 };
-
 	if (!minimap->UseUnitIcons())
 		icon::iconHandler.GetDefaultIconData()->BindTexture();
 
-	for (const auto& [icon, units] : modelDrawerData->GetUnitsByIcon()) {
+	// icon quads persist across frames and are only rebuilt for units that
+	// changed; the cached ones are just resubmitted
+	CUnitDrawerHelper::UpdateMiniMapIconBatches(modelDrawerData);
 
+	auto& iconBatches = modelDrawerData->GetMiniMapIconBatches();
+
+	for (const auto& [icon, units] : modelDrawerData->GetUnitsByIcon()) {
 		if (icon == nullptr)
 			continue;
 		if (units.empty())
@@ -307,66 +471,47 @@ void CUnitDrawerLegacy::DrawUnitMiniMapIcons() const
 		if (minimap->UseUnitIcons())
 			icon->BindTexture();
 
-		for (const CUnit* unit : units) {
-			assert(unit->myIcon == icon);
-			if (unit->noMinimap)
-				continue;
-			if (unit->myIcon == nullptr)
-				continue;
-			if (!unit->drawIcon)
-				continue;
-			if (unit->IsInVoid())
-				continue;
+		rb.AddVertices(iconBatches[icon].verts);
+		rb.Submit(GL_TRIANGLES);
+	}
 
-			const uint8_t* color = &defaultColor[0];
-
-			if (!unit->isSelected) {
-				if (minimap->UseSimpleColors()) {
-					if (unit->team == gu->myTeam) {
-						color = minimap->GetMyTeamIconColor();
-					}
-					else if (teamHandler.Ally(gu->myAllyTeam, unit->allyteam)) {
-						color = minimap->GetAllyTeamIconColor();
-					}
-					else {
-						color = minimap->GetEnemyTeamIconColor();
-					}
-				}
-				else {
-					color = teamHandler.Team(unit->team)->color;
-				}
-			}
+	// selection is not part of the cached quads, redraw selected units on top in white
+	static std::vector<const CUnit*> selectedIconUnits;
+	selectedIconUnits.clear();
 
-			const float iconScale = CUnitDrawerHelper::GetUnitIconScale(unit);
-			const float3& iconPos = (!gu->spectatingFullView) ?
-				unit->GetObjDrawErrorPos(gu->myAllyTeam) :
-				unit->GetObjDrawMidPos();
+	for (const int unitID : selectedUnitsHandler.selectedUnits) {
+		const CUnit* unit = unitHandler.GetUnit(unitID);
 
-			const float iconSizeX = (iconScale * minimap->GetUnitSizeX());
-			const float iconSizeY = (iconScale * minimap->GetUnitSizeY());
-
-			float x0 = iconPos.x - iconSizeX;
-			float x1 = iconPos.x + iconSizeX;
-			float y0 = iconPos.z - iconSizeY;
-			float y1 = iconPos.z + iconSizeY;
-
-			if (minimap->GetFlipped()) {
-				x0 = mapDims.mapx * SQUARE_SIZE - x0;
-				x1 = mapDims.mapx * SQUARE_SIZE - x1;
-				y0 = mapDims.mapy * SQUARE_SIZE - y0;
-				y1 = mapDims.mapy * SQUARE_SIZE - y1;
-				std::swap(x0, x1);
-				std::swap(y0, y1);
-			}
+		if (unit == nullptr || unit->myIcon == nullptr)
+			continue;
+
+		selectedIconUnits.push_back(unit);
+	}
+
+	std::sort(selectedIconUnits.begin(), selectedIconUnits.end(), [](const CUnit* a, const CUnit* b) { return (a->myIcon < b->myIcon); });
+
+	static constexpr uint8_t defaultColor[4] = { 255, 255, 255, 255 };
 
+	for (size_t i = 0, n = selectedIconUnits.size(); i < n; i++) {
+		const CUnit* unit = selectedIconUnits[i];
+
+		float4 iconRect;
+
+		if (CUnitDrawerHelper::GetMiniMapIconRect(unit, iconRect)) {
 			rb.AddQuadTriangles(
-				{ x0, y0, 0.0f, 0.0f, color },
-				{ x1, y0, 1.0f, 0.0f, color },
-				{ x1, y1, 1.0f, 1.0f, color },
-				{ x0, y1, 0.0f, 1.0f, color }
+				{ iconRect.x, iconRect.y, 0.0f, 0.0f, defaultColor },
+				{ iconRect.z, iconRect.y, 1.0f, 0.0f, defaultColor },
+				{ iconRect.z, iconRect.w, 1.0f, 1.0f, defaultColor },
+				{ iconRect.x, iconRect.w, 0.0f, 1.0f, defaultColor }
 			);
 		}
 
+		if ((i + 1) < n && selectedIconUnits[i + 1]->myIcon == unit->myIcon)
+			continue;
+
+		if (minimap->UseUnitIcons())
+			unit->myIcon->BindTexture();
+
 		rb.Submit(GL_TRIANGLES);
 	}
 
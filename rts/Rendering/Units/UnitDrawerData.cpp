@@ -157,6 +157,7 @@ CUnitDrawerData::~CUnitDrawerData()
 	}
 
 	unitsByIcon.clear();
+	miniMapIconBatches.clear();
 }
 
 void CUnitDrawerData::Update()
@@ -280,15 +281,55 @@ void CUnitDrawerData::UpdateUnitIcon(const CUnit* unit, bool forced, bool killed
 
 	if (!killed) {
 		if ((oldIcon != newIcon) || forced) {
-			spring::VectorErase(unitsByIcon[oldIcon], unit);
-			unitsByIcon[newIcon].push_back(unit);
+			DelUnitFromIcon(oldIcon, unit);
+			AddUnitToIcon(newIcon, unit);
 		}
 
 		u->myIcon = newIcon;
 		return;
 	}
 
-	spring::VectorErase(unitsByIcon[oldIcon], unit);
+	DelUnitFromIcon(oldIcon, unit);
+}
+
+void CUnitDrawerData::AddUnitToIcon(icon::CIconData* icon, const CUnit* unit)
+{
+	auto& units = unitsByIcon[icon];
+	auto& batch = miniMapIconBatches[icon];
+
+	units.push_back(unit);
+
+	// quad is filled in by the next refresh
+	batch.verts.resize(units.size() * 6, VA_TYPE_2DTC{});
+	batch.state.resize(units.size(), float4{});
+	batch.dirty = true;
+}
+
+void CUnitDrawerData::DelUnitFromIcon(icon::CIconData* icon, const CUnit* unit)
+{
+	auto& units = unitsByIcon[icon];
+	auto& batch = miniMapIconBatches[icon];
+
+	const auto it = std::find(units.begin(), units.end(), unit);
+
+	if (it == units.end())
+		return;
+
+	// mirror the swap-and-pop on the batch
+	const size_t idx = it - units.begin();
+	const size_t end = units.size() - 1;
+
+	if (batch.state.size() == units.size()) {
+		std::copy(batch.verts.begin() + end * 6, batch.verts.begin() + end * 6 + 6, batch.verts.begin() + idx * 6);
+		batch.state[idx] = batch.state[end];
+	}
+
+	*it = units.back();
+	units.pop_back();
+
+	batch.verts.resize(units.size() * 6, VA_TYPE_2DTC{});
+	batch.state.resize(units.size(), float4{});
+	batch.dirty = true;
 }
 
 void CUnitDrawerData::UpdateUnitIconState(CUnit* unit)
@@ -647,6 +688,10 @@ void CUnitDrawerData::PlayerChanged(int playerNum)
 	for (auto& [icon, units] : unitsByIcon) {
 		units.clear();
 	}
+	for (auto& [icon, batch] : miniMapIconBatches) {
+		batch.verts.clear();
+		batch.state.clear();
+	}
 
 	for (CUnit* unit : unsortedObjects) {
 		// force an erase (no-op) followed by an insert
@@ -2,7 +2,9 @@
 #pragma once
 
 #include "System/float3.h"
+#include "System/float4.h"
 #include "Rendering/Common/ModelDrawerData.h"
+#include "Rendering/GL/VertexArrayTypes.h"
 #include "Rendering/UnitDefImage.h"
 #include "Game/GlobalUnsynced.h"
 
@@ -95,6 +97,12 @@ public:
 		/// buildings that left LOS but are still alive
 		std::vector<std::array<std::vector<CUnit*>, MODELTYPE_CNT>> liveGhostBuildings;
 	};
+	// minimap icon quads kept across frames, parallel to the unitsByIcon entry of the same icon
+	struct MiniMapIconBatch {
+		std::vector<VA_TYPE_2DTC> verts; // six per unit, collapsed while the unit has no visible icon
+		std::vector<float4> state;       // icon center (x, z), scale and visibility the quads were built for
+		bool dirty = true;               // refresh at the next draw even if no sim-frame has passed
+	};
 public:
 	CUnitDrawerData(bool& mtModelDrawer_);
 	virtual ~CUnitDrawerData();
@@ -144,6 +152,7 @@ public:
 	const auto* GetSavedData() const { return &savedData; }
 
 	const spring::unsynced_map<icon::CIconData*, std::vector<const CUnit*> >& GetUnitsByIcon() const { return unitsByIcon; }
+	      spring::unsynced_map<icon::CIconData*, MiniMapIconBatch>& GetMiniMapIconBatches() { return miniMapIconBatches; }
 protected:
 	void UpdateObjectDrawFlags(CSolidObject* o) const override;
 private:
@@ -152,6 +161,8 @@ private:
 	void UpdateTempDrawUnits(std::vector<TempDrawUnit>& tempDrawUnits);
 
 	void UpdateUnitIcon(const CUnit* unit, bool forced, bool killed);
+	void AddUnitToIcon(icon::CIconData* icon, const CUnit* unit);
+	void DelUnitFromIcon(icon::CIconData* icon, const CUnit* unit);
 	void UpdateUnitIconState(CUnit* unit);
 	void UpdateUnitIconStateScreen(CUnit* unit);
 	static void UpdateDrawPos(CUnit* unit);
@@ -174,10 +185,15 @@ public:
 	float iconScale = 1.0f;
 	float iconFadeStart = 3000.0f;
 	float iconFadeVanish = 1000.0f;
+
+	// minimap parameters and sim-frame the icon batches were last refreshed for
+	uint32_t miniMapIconParams = 0;
+	int miniMapIconFrame = -1;
 private:
 	SavedData savedData;
 
 	spring::unsynced_map<icon::CIconData*, std::vector<const CUnit*> > unitsByIcon;
+	spring::unsynced_map<icon::CIconData*, MiniMapIconBatch> miniMapIconBatches;
 
 	std::vector<UnitDefImage> unitDefImages;
 
@@ -223,9 +223,19 @@ void CWorldDrawer::Update(bool newSimFrame)
 		modelLoader.LogErrors();
 	}
 
+	// grass culling samples the unsynced heightmap and normals, so it
+	// may only start after readMap->UpdateDraw has refreshed them
+	grassDrawer->StartUpdate();
+
 	numUpdates += 1;
 }
 
+void CWorldDrawer::FinishUpdate() const
+{
+	// jobs started by Update must not outlive the draw-frame
+	grassDrawer->FinishUpdate();
+}
+
 
 
 void CWorldDrawer::GenerateIBLTextures() const
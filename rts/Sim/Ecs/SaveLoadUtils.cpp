@@ -10,6 +10,7 @@
 #include "System/Log/ILog.h"
 #include "Sim/Misc/Resource.h"
 #include "Sim/MoveTypes/Components/MoveTypesComponents.h"
+#include "Sim/Units/Components/UnitEconomyComponents.h"
 
 
 
@@ -45,6 +46,7 @@ void ProcessComponents(T&& archive, S&& snapshot) {
     snapshot.entities(archive);
 
     MoveTypes::serializeComponents(archive, snapshot);
+    UnitEconomy::serializeComponents(archive, snapshot);
 }
 
 
@@ -97,6 +97,16 @@ void ILosType::Init(const int mipLevel_, LosType type_)
 	for (CLosMap& losMap: losMaps) {
 		losMap.Init(size, int2(mapDims.mapx, mapDims.mapy), ctrHeightMap, mipHeightMap, type == LOS_TYPE_LOS);
 	}
+
+	numTiles = {(size.x + TILE_SIZE - 1) / TILE_SIZE, (size.y + TILE_SIZE - 1) / TILE_SIZE};
+	updateNum = 0;
+
+	tileUpdateNums.resize(losMaps.size());
+
+	for (std::vector<int>& tileNums: tileUpdateNums) {
+		tileNums.clear();
+		tileNums.resize(numTiles.x * numTiles.y, 0);
+	}
 }
 
 void ILosType::Kill()
@@ -128,6 +138,28 @@ void ILosType::Kill()
 }
 
 
+bool ILosType::GetChangedTiles(int allyTeam, int sinceUpdateNum, std::vector<uint8_t>& tileMask) const
+{
+	const std::vector<int>& tileNums = tileUpdateNums[allyTeam];
+
+	tileMask.resize(tileNums.size(), 0);
+
+	if (sinceUpdateNum >= updateNum)
+		return false;
+
+	bool changed = false;
+
+	for (size_t i = 0; i < tileNums.size(); i++) {
+		const bool tileChanged = (tileNums[i] > sinceUpdateNum);
+
+		tileMask[i] |= tileChanged;
+		changed |= tileChanged;
+	}
+
+	return changed;
+}
+
+
 float ILosType::GetRadius(const CUnit* unit) const
 {
 	switch (type) {
@@ -279,6 +311,8 @@ inline void ILosType::LosAdd(SLosInstance* li)
 	} else {
 		losMaps[li->allyteam].AddCircle(li, 1);
 	}
+
+	TouchTiles(li);
 }
 
 
@@ -289,6 +323,26 @@ inline void ILosType::LosRemove(SLosInstance* li)
 	} else {
 		losMaps[li->allyteam].AddCircle(li, -1);
 	}
+
+	TouchTiles(li);
+}
+
+
+inline void ILosType::TouchTiles(const SLosInstance* li)
+{
+	// raycast and circle squares both stay within radius of basePos
+	const int x1 = std::clamp(li->basePos.x - li->radius, 0, size.x - 1) / TILE_SIZE;
+	const int y1 = std::clamp(li->basePos.y - li->radius, 0, size.y - 1) / TILE_SIZE;
+	const int x2 = std::clamp(li->basePos.x + li->radius, 0, size.x - 1) / TILE_SIZE;
+	const int y2 = std::clamp(li->basePos.y + li->radius, 0, size.y - 1) / TILE_SIZE;
+
+	std::vector<int>& tileNums = tileUpdateNums[li->allyteam];
+
+	for (int y = y1; y <= y2; y++) {
+		for (int x = x1; x <= x2; x++) {
+			tileNums[y * numTiles.x + x] = updateNum;
+		}
+	}
 }
 
 
@@ -497,6 +551,7 @@ void ILosType::Update()
 	if (losUpdate.empty())
 		return;
 
+	updateNum += 1;
 
 	losRemove.clear();
 	losRemove.reserve(losUpdate.size());
@@ -127,6 +127,9 @@ public:
 	void Init(const int mipLevel, LosType type);
 	void Kill();
 
+	/// ORs the tiles of <allyTeam>'s map changed after update <sinceUpdateNum> into <tileMask>
+	bool GetChangedTiles(int allyTeam, int sinceUpdateNum, std::vector<uint8_t>& tileMask) const;
+
 public:
 	void Update();
 	void UpdateHeightMapSynced(SRectangle rect);
@@ -138,6 +141,7 @@ private:
 
 	void LosAdd(SLosInstance* instance);
 	void LosRemove(SLosInstance* instance);
+	void TouchTiles(const SLosInstance* instance);
 
 	void RefInstance(SLosInstance* instance);
 	void UnrefInstance(SLosInstance* instance);
@@ -176,6 +180,15 @@ public:
 	std::deque<SLosInstance> instances;
 	std::vector<int> freeIDs;
 
+	// per allyteam, the updateNum at which each TILE_SIZE^2 block of
+	// its losMap was last changed; lets unsynced consumers such as the
+	// info-textures refresh only the parts that changed since they looked
+	std::vector< std::vector<int> > tileUpdateNums;
+	int2 numTiles;
+	int updateNum = 0;
+
+	static constexpr int TILE_SIZE = 32;
+
 private:
 	struct DelayedInstance {
 		SLosInstance* instance;
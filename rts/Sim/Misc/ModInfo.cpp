@@ -104,6 +104,7 @@ void CModInfo::ResetState()
 	}
 	{
 		pathFinderSystem = NOPFS_TYPE;
+		unitEconomySystem = UNIT_ECONOMY_LEGACY;
 		pfRawDistMult    = 1.25f;
 		pfUpdateRateScale = 1.f;
 		pfRepathDelayInFrames = 60;
@@ -163,6 +164,8 @@ void CModInfo::Init(const std::string& modFileName)
 
 		enableSmoothMesh = system.GetBool("enableSmoothMesh", enableSmoothMesh);
 
+		unitEconomySystem = std::clamp(system.GetInt("unitEconomySystem", unitEconomySystem), int(UNIT_ECONOMY_LEGACY), int(UNIT_ECONOMY_PROPORTIONAL));
+
 		quadFieldQuadSizeInElmos = std::clamp(system.GetInt("quadFieldQuadSizeInElmos", quadFieldQuadSizeInElmos), 8, 1024);
 
 		// Specify in megabytes: 1 << 20 = (1024 * 1024)
@@ -186,6 +186,17 @@ public:
 	/// which pathfinder system (NOP, DEFAULT/legacy, or QT) the mod will use
 	int pathFinderSystem;
 
+	enum {
+		UNIT_ECONOMY_LEGACY = 0,
+		UNIT_ECONOMY_BATCHED,
+		UNIT_ECONOMY_PROPORTIONAL,
+	};
+
+	/// how unit resource production and upkeep is applied: 0 - per unit in its SlowUpdate,
+	/// 1 - batched per team by UnitEconomySystem with upkeeps paid first come first served,
+	/// 2 - as 1 but a team short on a resource gives every consumer the same fraction
+	int unitEconomySystem;
+
 	/// Minimum delay after unit has made progress to next waypoint before allowing repath
 	int pfRepathDelayInFrames;
 
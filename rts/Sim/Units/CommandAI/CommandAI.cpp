@@ -1032,7 +1032,7 @@ void CCommandAI::GiveAllowedCommand(const Command& c, bool fromSynced)
 	}
 
 	// do not allow overlapping commands
-	if (!GetOverlapQueued(c).empty())
+	if (HasOverlapQueued(c, commandQue))
 		return;
 
 	if (c.GetID() == CMD_ATTACK) {
@@ -1142,20 +1142,7 @@ void CCommandAI::ExecuteInsert(const Command& c, bool fromSynced)
 		std::advance(insertIt, pos);
 	} else {
 		// treat param0 as a command tag
-		const unsigned int tag = (unsigned int)c.GetParam(0);
-
-		bool found = false;
-
-		for (auto ci = queue->begin(); ci != queue->end(); ++ci) {
-			const Command& qc = *ci;
-
-			if ((found = (qc.GetTag() == tag))) {
-				insertIt = ci;
-				break;
-			}
-		}
-
-		if (!found)
+		if ((insertIt = queue->find_tag(static_cast<unsigned int>(c.GetParam(0)))) == queue->end())
 			return;
 
 		if ((c.GetOpts() & RIGHT_MOUSE_KEY) && (insertIt != queue->end())) {
@@ -1234,15 +1221,19 @@ void CCommandAI::ExecuteRemove(const Command& c)
 		CCommandQueue::iterator ci;
 
 		do {
-			for (ci = queue->begin(); ci != queue->end(); ++ci) {
+			for (ci = queue->begin(); ci != queue->end(); /*NOOP*/) {
 				const Command& qc = *ci;
 
 				if (removeByID) {
-					if (qc.GetID() != removeValue)
+					if (qc.GetID() != removeValue) {
+						++ci;
 						continue;
+					}
 				} else {
-					if (qc.GetTag() != removeValue)
+					if (qc.GetTag() != removeValue) {
+						++ci;
 						continue;
+					}
 				}
 
 				if (qc.GetID() == CMD_WAIT) {
@@ -1268,11 +1259,10 @@ void CCommandAI::ExecuteRemove(const Command& c)
 					active = true;
 				}
 
-				queue->erase(ci);
-				ci = queue->begin();
-
-				// the removal may have corrupted the iterator
-				break;
+				// everything before <ci> was already checked, no need to
+				// restart the scan; tags are unique so stop at the first
+				if ((ci = queue->erase(ci)) != queue->end() && !removeByID)
+					ci = queue->end();
 			}
 		} while (ci != queue->end());
 	}
@@ -1386,57 +1376,70 @@ std::vector<Command> CCommandAI::GetOverlapQueued(const Command& c) const
 
 std::vector<Command> CCommandAI::GetOverlapQueued(const Command& c, const CCommandQueue& q) const
 {
-	CCommandQueue::const_iterator ci = q.end();
 	std::vector<Command> v;
-	BuildInfo cbi(c);
+	const BuildInfo cbi(c);
 
-	if (ci != q.begin()) {
-		do {
-			--ci; //iterate from the end and dont check the current order
-			const Command& t = *ci;
+	// iterate from the end and dont check the current order
+	for (auto ci = q.rbegin(); ci != q.rend(); ++ci) {
+		if (IsOverlapQueued(c, cbi, *ci))
+			v.push_back(*ci);
+	}
 
-			if (t.GetNumParams() != c.GetNumParams())
-				continue;
+	return v;
+}
 
-			if (t.GetID() == c.GetID() || (c.GetID() < 0 && t.GetID() < 0)) {
-				if (c.GetNumParams() == 1) {
-					// assume the param is a unit or feature id
-					if (t.GetParam(0) == c.GetParam(0)) {
-						v.push_back(t);
-					}
-				}
-				else if (c.GetNumParams() >= 3) {
-					// assume c and t are positional commands
-					// NOTE: uses a BuildInfo structure, but <t> can be ANY command
-					BuildInfo tbi;
-					if (tbi.Parse(t)) {
-						const float dist2X = 2.0f * math::fabs(cbi.pos.x - tbi.pos.x);
-						const float dist2Z = 2.0f * math::fabs(cbi.pos.z - tbi.pos.z);
-						const float addSizeX = SQUARE_SIZE * (cbi.GetXSize() + tbi.GetXSize());
-						const float addSizeZ = SQUARE_SIZE * (cbi.GetZSize() + tbi.GetZSize());
-						const float maxSizeX = SQUARE_SIZE * std::max(cbi.GetXSize(), tbi.GetXSize());
-						const float maxSizeZ = SQUARE_SIZE * std::max(cbi.GetZSize(), tbi.GetZSize());
-
-						if (cbi.def == NULL) continue;
-						if (tbi.def == NULL) continue;
-
-						if (((dist2X > maxSizeX) || (dist2Z > maxSizeZ)) &&
-						    ((dist2X < addSizeX) && (dist2Z < addSizeZ))) {
-							v.push_back(t);
-						}
-					} else {
-						if ((cbi.pos - tbi.pos).SqLength2D() >= (COMMAND_CANCEL_DIST * COMMAND_CANCEL_DIST))
-							continue;
-						if ((c.GetOpts() & SHIFT_KEY) != 0 && c.IsInternalOrder())
-							continue;
+bool CCommandAI::HasOverlapQueued(const Command& c, const CCommandQueue& q) const
+{
+	const BuildInfo cbi(c);
 
-						v.push_back(t);
-					}
-				}
-			}
-		} while (ci != q.begin());
+	// same as GetOverlapQueued, but without copying every overlapping command
+	for (auto ci = q.rbegin(); ci != q.rend(); ++ci) {
+		if (IsOverlapQueued(c, cbi, *ci))
+			return true;
 	}
-	return v;
+
+	return false;
+}
+
+bool CCommandAI::IsOverlapQueued(const Command& c, const BuildInfo& cbi, const Command& t)
+{
+	if (t.GetNumParams() != c.GetNumParams())
+		return false;
+
+	if (t.GetID() != c.GetID() && (c.GetID() >= 0 || t.GetID() >= 0))
+		return false;
+
+	if (c.GetNumParams() == 1) {
+		// assume the param is a unit or feature id
+		return (t.GetParam(0) == c.GetParam(0));
+	}
+
+	if (c.GetNumParams() < 3)
+		return false;
+
+	// assume c and t are positional commands
+	// NOTE: uses a BuildInfo structure, but <t> can be ANY command
+	BuildInfo tbi;
+	if (tbi.Parse(t)) {
+		const float dist2X = 2.0f * math::fabs(cbi.pos.x - tbi.pos.x);
+		const float dist2Z = 2.0f * math::fabs(cbi.pos.z - tbi.pos.z);
+		const float addSizeX = SQUARE_SIZE * (cbi.GetXSize() + tbi.GetXSize());
+		const float addSizeZ = SQUARE_SIZE * (cbi.GetZSize() + tbi.GetZSize());
+		const float maxSizeX = SQUARE_SIZE * std::max(cbi.GetXSize(), tbi.GetXSize());
+		const float maxSizeZ = SQUARE_SIZE * std::max(cbi.GetZSize(), tbi.GetZSize());
+
+		if (cbi.def == nullptr) return false;
+		if (tbi.def == nullptr) return false;
+
+		return (((dist2X > maxSizeX) || (dist2Z > maxSizeZ)) && ((dist2X < addSizeX) && (dist2Z < addSizeZ)));
+	}
+
+	if ((cbi.pos - tbi.pos).SqLength2D() >= (COMMAND_CANCEL_DIST * COMMAND_CANCEL_DIST))
+		return false;
+	if ((c.GetOpts() & SHIFT_KEY) != 0 && c.IsInternalOrder())
+		return false;
+
+	return true;
 }
 
 
@@ -1605,19 +1608,20 @@ void CCommandAI::DependentDied(CObject* o)
 	if (commandDeathDependences.erase(o) && o != owner) {
 		CFactoryCAI* facCAI = dynamic_cast<CFactoryCAI*>(this);
 		CCommandQueue& dq = facCAI ? facCAI->newUnitCommands : commandQue;
-		int lastTag;
-		int curTag = -1;
-		do {
-			lastTag = curTag;
-			for (CCommandQueue::iterator qit = dq.begin(); qit != dq.end(); ++qit) {
-				Command &c = *qit;
-				int cpos;
-				if (c.IsObjectCommand(cpos) && (c.GetParam(cpos) == CSolidObject::GetDeletingRefID())) {
-					ExecuteRemove(Command(CMD_REMOVE, 0, curTag = c.GetTag()));
-					break;
-				}
-			}
-		} while(curTag != lastTag);
+		std::vector<unsigned int> deadTags;
+
+		// gather all tags in one scan, but remove them one by one so that
+		// each removed front command is finished (ExecuteRemove only does
+		// so for the first one if given several tags)
+		for (const Command& c: dq) {
+			int cpos;
+			if (c.IsObjectCommand(cpos) && (c.GetParam(cpos) == CSolidObject::GetDeletingRefID()))
+				deadTags.push_back(c.GetTag());
+		}
+
+		for (const unsigned int tag: deadTags) {
+			ExecuteRemove(Command(CMD_REMOVE, 0, tag));
+		}
 	}
 }
 
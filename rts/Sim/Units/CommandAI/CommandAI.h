@@ -15,6 +15,7 @@
 class CUnit;
 class CFeature;
 class CWeapon;
+struct BuildInfo;
 struct Command;
 
 class CCommandAI : public CObject
@@ -81,6 +82,7 @@ public:
 	 */
 	std::vector<Command> GetOverlapQueued(const Command& c) const;
 	std::vector<Command> GetOverlapQueued(const Command& c, const CCommandQueue& queue) const;
+	bool HasOverlapQueued(const Command& c, const CCommandQueue& queue) const;
 
 	const std::vector<const SCommandDescription*>& GetPossibleCommands() const { return possibleCommands; }
 
@@ -154,6 +156,9 @@ protected:
 	int UpdateTargetLostTimer(int unitID);
 	void DrawDefaultCommand(const Command& c) const;
 
+private:
+	static bool IsOverlapQueued(const Command& c, const BuildInfo& cbi, const Command& t);
+
 private:
 	// FIXME make synced?
 	spring::unsynced_set<CObject*> commandDeathDependences;
@@ -3,6 +3,7 @@
 #ifndef _COMMAND_QUEUE_H
 #define _COMMAND_QUEUE_H
 
+#include <algorithm>
 #include <deque>
 #include "Command.h"
 
@@ -88,6 +89,10 @@ class CCommandQueue {
 		inline       Command& operator[](size_type i)       { return queue[i]; }
 		inline const Command& operator[](size_type i) const { return queue[i]; }
 
+		/// @return iterator to the command with the given tag, or end()
+		inline iterator       find_tag(unsigned int tag);
+		inline const_iterator find_tag(unsigned int tag) const;
+
 	private:
 		CCommandQueue() : queueType(CommandQueueType), tagCounter(0) {};
 		CCommandQueue(const CCommandQueue&);
@@ -128,6 +133,18 @@ inline void CCommandQueue::push_front(const Command& cmd)
 }
 
 
+// tags are unique, but only increasing for commands that were push_back'ed
+inline CCommandQueue::iterator CCommandQueue::find_tag(unsigned int tag)
+{
+	return std::find_if(queue.begin(), queue.end(), [tag](const Command& c) { return (c.GetTag() == tag); });
+}
+
+inline CCommandQueue::const_iterator CCommandQueue::find_tag(unsigned int tag) const
+{
+	return std::find_if(queue.begin(), queue.end(), [tag](const Command& c) { return (c.GetTag() == tag); });
+}
+
+
 inline CCommandQueue::iterator CCommandQueue::insert(iterator pos, const Command& cmd)
 {
 	Command tmpCmd = cmd;
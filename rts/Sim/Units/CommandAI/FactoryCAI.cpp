@@ -196,7 +196,7 @@ void CFactoryCAI::GiveCommandReal(const Command& c, bool fromSynced)
 				if (CancelCommands(c, newUnitCommands, dummy) > 0) {
 					return;
 				} else {
-					if (GetOverlapQueued(c, newUnitCommands).empty()) {
+					if (!HasOverlapQueued(c, newUnitCommands)) {
 						newUnitCommands.push_back(c);
 					} else {
 						return;
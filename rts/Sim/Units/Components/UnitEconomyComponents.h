@@ -0,0 +1,60 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef UNIT_ECONOMY_COMPONENTS_H__
+#define UNIT_ECONOMY_COMPONENTS_H__
+
+#include <array>
+
+#include "Sim/Misc/Resource.h"
+
+namespace UnitEconomy {
+
+struct UnitEconomyUpkeep {
+	SResourcePack use;
+	// only produced if all of `use` could be paid
+	SResourcePack make;
+	bool requiresActivation = false;
+
+	template<class Archive>
+	void serialize(Archive& ar) { ar(use.metal, use.energy, make.metal, make.energy, requiresActivation); }
+};
+
+// Resource flows of a unit that are applied per team by UnitEconomySystem
+// instead of per unit in CUnit::SlowUpdate. Amounts are per unit slow-update
+// (UNIT_SLOWUPDATE_RATE frames), refreshed each time the unit slow-updates.
+struct UnitEconomyFlows {
+	// two unconditional, two conditional and two unitdef upkeeps, plus
+	// four more for negative production values which turn into upkeeps
+	static constexpr int MAX_UPKEEPS = 10;
+
+	std::array<UnitEconomyUpkeep, MAX_UPKEEPS> upkeeps;
+
+	SResourcePack make;
+	SResourcePack activeMake;
+
+	// wind-energy is evaluated on every economy update
+	float windGenerator = 0.0f;
+
+	int unitId = -1;
+	int numUpkeeps = 0;
+
+	template<class Archive>
+	void serialize(Archive& ar) {
+		ar(make.metal, make.energy, activeMake.metal, activeMake.energy, windGenerator, unitId, numUpkeeps);
+
+		for (int i = 0; i < numUpkeeps; ++i) {
+			upkeeps[i].serialize(ar);
+		}
+	}
+};
+
+template<class Archive, class Snapshot>
+void serializeComponents(Archive &archive, Snapshot &snapshot) {
+    snapshot.template component
+        < UnitEconomyFlows
+        >(archive);
+}
+
+}
+
+#endif
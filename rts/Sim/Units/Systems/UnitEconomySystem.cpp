@@ -0,0 +1,202 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include <algorithm>
+#include <vector>
+
+#include "UnitEconomySystem.h"
+#include "UnitEconomyUtils.h"
+
+#include "Sim/Ecs/Registry.h"
+#include "Sim/Misc/GlobalConstants.h"
+#include "Sim/Misc/GlobalSynced.h"
+#include "Sim/Misc/ModInfo.h"
+#include "Sim/Misc/Team.h"
+#include "Sim/Misc/TeamHandler.h"
+#include "Sim/Misc/Wind.h"
+#include "Sim/Units/Components/UnitEconomyComponents.h"
+#include "Sim/Units/Unit.h"
+#include "Sim/Units/UnitDef.h"
+#include "Sim/Units/UnitHandler.h"
+
+#include "System/Ecs/SlowUpdate.h"
+#include "System/TimeProfiler.h"
+
+using namespace UnitEconomy;
+
+// flows are stored per unit slow-update, but applied every economy update
+static constexpr float FLOW_SCALE = UNIT_ECONOMY_UPDATE_RATE / float(UNIT_SLOWUPDATE_RATE);
+
+// per-team scratch space, only used in proportional mode
+static std::vector<SResourcePack> teamDemands;
+static std::vector<SResourcePack> teamFractions;
+
+
+static bool IsEconomyActive(const CUnit* unit)
+{
+	return (!unit->isDead && !unit->beingBuilt && !unit->IsStunned());
+}
+
+static SResourcePack GetScaledMake(const CUnit* unit, const UnitEconomyFlows& flows)
+{
+	SResourcePack make = flows.make;
+
+	if (unit->activated) {
+		make += flows.activeMake;
+		make.energy += std::min(envResHandler.GetCurrentWindStrength(), flows.windGenerator) * 0.5f;
+	}
+
+	make *= FLOW_SCALE;
+	return make;
+}
+
+
+void UnitEconomySystem::UpdateUnitFlows(const CUnit* unit)
+{
+	const UnitDef* ud = unit->unitDef;
+
+	UnitEconomyFlows flows;
+	flows.unitId = unit->id;
+
+	// same terms as the legacy path in CUnit::SlowUpdateResources
+	AddMake(flows, 0, unit->resourcesUncondMake.metal, false);
+	AddMake(flows, 1, unit->resourcesUncondMake.energy, false);
+	AddUpkeep(flows, 0, unit->resourcesUncondUse.metal, {}, false);
+	AddUpkeep(flows, 1, unit->resourcesUncondUse.energy, {}, false);
+
+	AddUpkeep(flows, 0, unit->resourcesCondUse.metal, {0.0f, unit->resourcesCondMake.energy}, true);
+	AddUpkeep(flows, 1, unit->resourcesCondUse.energy, {unit->resourcesCondMake.metal, 0.0f}, true);
+
+	AddMake(flows, 0, ud->metalMake * 0.5f, false);
+
+	{
+		const float extractMetal = (ud->extractsMetal > 0.0f)? (unit->metalExtract * 0.5f): 0.0f;
+
+		AddUpkeep(flows, 1, ud->energyUpkeep * 0.5f, {ud->makesMetal * 0.5f + extractMetal, 0.0f}, true);
+		AddUpkeep(flows, 0, ud->metalUpkeep * 0.5f, {}, true);
+	}
+
+	AddMake(flows, 1, (ud->energyMake + ud->tidalGenerator * envResHandler.GetCurrentTidalStrength()) * 0.5f, false);
+
+	flows.windGenerator = std::max(ud->windGenerator, 0.0f);
+
+	Sim::registry.emplace_or_replace<UnitEconomyFlows>(unit->entityReference, flows);
+}
+
+
+void UnitEconomySystem::Update()
+{
+	if (modInfo.unitEconomySystem == CModInfo::UNIT_ECONOMY_LEGACY)
+		return;
+	if ((gs->frameNum % UNIT_ECONOMY_UPDATE_RATE) != UNIT_ECONOMY_TICK)
+		return;
+
+	SCOPED_TIMER("Sim::Unit::Economy");
+
+	const bool proportional = (modInfo.unitEconomySystem == CModInfo::UNIT_ECONOMY_PROPORTIONAL);
+	auto view = Sim::registry.view<UnitEconomyFlows>();
+
+	if (proportional) {
+		teamDemands.clear();
+		teamDemands.resize(teamHandler.ActiveTeams());
+		teamFractions.clear();
+		teamFractions.resize(teamHandler.ActiveTeams(), {1.0f, 1.0f});
+	}
+
+	// production goes first, so upkeeps see this update's income like in the
+	// legacy path where AddMetal precedes UseMetal
+	view.each([proportional](const UnitEconomyFlows& flows) {
+		CUnit* unit = unitHandler.GetUnit(flows.unitId);
+
+		if (!IsEconomyActive(unit))
+			return;
+
+		CTeam* team = teamHandler.Team(unit->team);
+		const SResourcePack make = GetScaledMake(unit, flows);
+
+		unit->resourcesMakeI += make;
+		team->AddResources(make);
+
+		if (!proportional)
+			return;
+
+		for (int i = 0; i < flows.numUpkeeps; ++i) {
+			const UnitEconomyUpkeep& upkeep = flows.upkeeps[i];
+
+			if (upkeep.requiresActivation && !unit->activated)
+				continue;
+
+			teamDemands[unit->team] += upkeep.use;
+		}
+	});
+
+	if (proportional) {
+		for (int teamNum = 0, numTeams = teamHandler.ActiveTeams(); teamNum < numTeams; ++teamNum) {
+			const CTeam* team = teamHandler.Team(teamNum);
+
+			for (int i = 0; i < SResourcePack::MAX_RESOURCES; ++i) {
+				const float demand = teamDemands[teamNum][i] * FLOW_SCALE;
+
+				if (demand <= team->res[i])
+					continue;
+
+				teamFractions[teamNum][i] = std::max(team->res[i], 0.0f) / demand;
+			}
+		}
+	}
+
+	// upkeeps are either paid in full in entity order (first come, first
+	// served), or every consumer of a team gets the same share of what it
+	// can afford
+	view.each([proportional](const UnitEconomyFlows& flows) {
+		CUnit* unit = unitHandler.GetUnit(flows.unitId);
+
+		if (!IsEconomyActive(unit))
+			return;
+
+		CTeam* team = teamHandler.Team(unit->team);
+
+		for (int i = 0; i < flows.numUpkeeps; ++i) {
+			const UnitEconomyUpkeep& upkeep = flows.upkeeps[i];
+
+			if (upkeep.requiresActivation && !unit->activated)
+				continue;
+
+			SResourcePack use = upkeep.use;
+			SResourcePack make = upkeep.make;
+
+			use *= FLOW_SCALE;
+			make *= FLOW_SCALE;
+
+			if (!proportional) {
+				ApplyUpkeep(team, unit->resourcesUseI, unit->resourcesMakeI, use, make);
+				continue;
+			}
+
+			team->resPull += use;
+
+			float fraction = 1.0f;
+
+			for (int j = 0; j < SResourcePack::MAX_RESOURCES; ++j) {
+				if (use[j] > 0.0f)
+					fraction = std::min(fraction, teamFractions[unit->team][j]);
+			}
+
+			if (fraction <= 0.0f)
+				continue;
+
+			use *= fraction;
+			make *= fraction;
+
+			// shares may exceed the stored amount by rounding error
+			for (int j = 0; j < SResourcePack::MAX_RESOURCES; ++j) {
+				use[j] = std::min(use[j], std::max(team->res[j], 0.0f));
+			}
+
+			team->res -= use;
+			team->resExpense += use;
+
+			unit->resourcesUseI += use;
+			ApplyMake(team, unit->resourcesUseI, unit->resourcesMakeI, make);
+		}
+	});
+}
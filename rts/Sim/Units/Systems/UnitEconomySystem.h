@@ -0,0 +1,22 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef UNIT_ECONOMY_SYSTEM_H__
+#define UNIT_ECONOMY_SYSTEM_H__
+
+class CUnit;
+
+/**
+ * Applies the per-slowupdate resource production and upkeep of all units
+ * team by team, over the contiguous UnitEconomyFlows storage rather than
+ * through per-unit UseMetal / AddEnergy / ... calls. Only active when the
+ * game sets modrules system.unitEconomySystem to a non-legacy value.
+ */
+class UnitEconomySystem {
+public:
+    static void Update();
+
+    /// captures the unit's current flows; called from CUnit::SlowUpdate
+    static void UpdateUnitFlows(const CUnit* unit);
+};
+
+#endif
@@ -0,0 +1,106 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef UNIT_ECONOMY_UTILS_H__
+#define UNIT_ECONOMY_UTILS_H__
+
+#include <cassert>
+
+#include "Sim/Misc/Resource.h"
+#include "Sim/Units/Components/UnitEconomyComponents.h"
+
+// Flow capture and resource accounting of UnitEconomySystem, templated on the
+// team type so the results can be checked against the per-unit (legacy) calls
+// of CUnit::SlowUpdateResources without a running simulation.
+namespace UnitEconomy {
+
+inline void AddUpkeep(UnitEconomyFlows& flows, int resIdx, float amount, const SResourcePack& make, bool requiresActivation);
+
+inline void AddMake(UnitEconomyFlows& flows, int resIdx, float amount, bool requiresActivation)
+{
+	// negative production is an upkeep, same as in CUnit::AddMetal
+	if (amount < 0.0f) {
+		AddUpkeep(flows, resIdx, -amount, {}, requiresActivation);
+		return;
+	}
+
+	if (requiresActivation) {
+		flows.activeMake[resIdx] += amount;
+	} else {
+		flows.make[resIdx] += amount;
+	}
+}
+
+inline void AddUpkeep(UnitEconomyFlows& flows, int resIdx, float amount, const SResourcePack& make, bool requiresActivation)
+{
+	// a non-positive upkeep always succeeds (see CUnit::UseMetal), so its
+	// (negated) amount and everything gated by it are plain production
+	if (amount <= 0.0f) {
+		AddMake(flows, resIdx, -amount, requiresActivation);
+
+		for (int i = 0; i < SResourcePack::MAX_RESOURCES; ++i) {
+			AddMake(flows, i, make[i], requiresActivation);
+		}
+
+		return;
+	}
+
+	assert(flows.numUpkeeps < UnitEconomyFlows::MAX_UPKEEPS);
+
+	UnitEconomyUpkeep& upkeep = flows.upkeeps[flows.numUpkeeps++];
+	upkeep.use = {};
+	upkeep.use[resIdx] = amount;
+	upkeep.make = make;
+	upkeep.requiresActivation = requiresActivation;
+}
+
+
+/**
+ * Adds the positive entries of `make` to the team's and unit's income.
+ * Negative entries are consumption, which like CUnit::AddMetal(-x) turning
+ * into CUnit::UseMetal(x) is only taken if the team can afford it, one
+ * resource at a time.
+ */
+template<typename TeamType>
+void ApplyMake(TeamType* team, SResourcePack& unitUse, SResourcePack& unitMake, const SResourcePack& make)
+{
+	SResourcePack income;
+
+	for (int i = 0; i < SResourcePack::MAX_RESOURCES; ++i) {
+		if (make[i] >= 0.0f) {
+			income[i] = make[i];
+			continue;
+		}
+
+		SResourcePack use;
+		use[i] = -make[i];
+
+		team->resPull += use;
+
+		if (team->UseResources(use))
+			unitUse += use;
+	}
+
+	unitMake += income;
+	team->AddResources(income);
+}
+
+/**
+ * Pays `use` in full or not at all and applies the production gated by it
+ * on success (first come, first served).
+ */
+template<typename TeamType>
+bool ApplyUpkeep(TeamType* team, SResourcePack& unitUse, SResourcePack& unitMake, const SResourcePack& use, const SResourcePack& make)
+{
+	team->resPull += use;
+
+	if (!team->UseResources(use))
+		return false;
+
+	unitUse += use;
+	ApplyMake(team, unitUse, unitMake, make);
+	return true;
+}
+
+}
+
+#endif
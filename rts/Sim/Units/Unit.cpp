@@ -55,6 +55,7 @@
 #include "Sim/Projectiles/FlareProjectile.h"
 #include "Sim/Projectiles/ProjectileMemPool.h"
 #include "Sim/Projectiles/WeaponProjectiles/MissileProjectile.h"
+#include "Sim/Units/Systems/UnitEconomySystem.h"
 #include "Sim/Weapons/Weapon.h"
 #include "Sim/Weapons/WeaponDefHandler.h"
 #include "Sim/Weapons/WeaponLoader.h"
@@ -993,6 +994,31 @@ void CUnit::SlowUpdate()
 	moveType->SlowUpdate();
 
 
+	if (modInfo.unitEconomySystem == CModInfo::UNIT_ECONOMY_LEGACY) {
+		SlowUpdateResources();
+	} else {
+		UnitEconomySystem::UpdateUnitFlows(this);
+	}
+
+	if (health < maxHealth) {
+		health += (unitDef->idleAutoHeal * (restTime > unitDef->idleTime));
+		health += unitDef->autoHeal;
+		health = std::min(health, maxHealth);
+	}
+
+	SlowUpdateCloak(false);
+	SlowUpdateKamikaze(fireState >= FIRESTATE_FIREATWILL);
+
+	if (moveType->progressState == AMoveType::Active)
+		DoSeismicPing(seismicSignature);
+
+	CalculateTerrainType();
+	UpdateTerrainType();
+}
+
+
+void CUnit::SlowUpdateResources()
+{
 	// FIXME: scriptMakeMetal ...?
 	AddMetal(resourcesUncondMake.metal);
 	AddEnergy(resourcesUncondMake.energy);
@@ -1031,22 +1057,6 @@ void CUnit::SlowUpdate()
 
 	// FIXME: tidal part should be under "if (activated)"?
 	AddEnergy((unitDef->energyMake + unitDef->tidalGenerator * envResHandler.GetCurrentTidalStrength()) * 0.5f);
-
-
-	if (health < maxHealth) {
-		health += (unitDef->idleAutoHeal * (restTime > unitDef->idleTime));
-		health += unitDef->autoHeal;
-		health = std::min(health, maxHealth);
-	}
-
-	SlowUpdateCloak(false);
-	SlowUpdateKamikaze(fireState >= FIRESTATE_FIREATWILL);
-
-	if (moveType->progressState == AMoveType::Active)
-		DoSeismicPing(seismicSignature);
-
-	CalculateTerrainType();
-	UpdateTerrainType();
 }
 
 
@@ -196,6 +196,7 @@ public:
 
 	void UpdateWeapons();
 
+	void SlowUpdateResources();
 	void SlowUpdateWeapons();
 	void SlowUpdateKamikaze(bool scanForTargets);
 	void SlowUpdateCloak(bool stunCheck);
@@ -18,6 +18,7 @@
 #include "Sim/MoveTypes/MoveType.h"
 #include "Sim/MoveTypes/Systems/GeneralMoveSystem.h"
 #include "Sim/MoveTypes/Systems/GroundMoveSystem.h"
+#include "Sim/Units/Systems/UnitEconomySystem.h"
 #include "Sim/Path/IPathManager.h"
 #include "Sim/Weapons/Weapon.h"
 #include "System/EventHandler.h"
@@ -345,14 +346,29 @@ void CUnitHandler::SlowUpdateUnits()
 	activeSlowUpdateUnit = idxEnd;
 
 	// stagger the SlowUpdate's
-	for (size_t i = idxBeg; i<idxEnd; ++i) {
-		CUnit* unit = activeUnits[i];
+	{
+		// everything with side-effects (damage, resources, Lua and script
+		// callins, weapon target queries through shared GameHelper buffers)
+		// has to run in unit order
+		SCOPED_TIMER("Sim::Unit::SlowUpdate::ST");
+
+		for (size_t i = idxBeg; i < idxEnd; ++i) {
+			CUnit* unit = activeUnits[i];
+
+			unit->SanityCheck();
+			unit->SlowUpdate();
+			unit->SlowUpdateWeapons();
+			unit->SanityCheck();
+		}
+	}
+	{
+		// purely per-unit; units killed above are only deleted next frame
+		// and new ones are appended, so [idxBeg, idxEnd) is still the same
+		SCOPED_TIMER("Sim::Unit::SlowUpdate::BoundingVolumesMT");
 
-		unit->SanityCheck();
-		unit->SlowUpdate();
-		unit->SlowUpdateWeapons();
-		unit->localModel.UpdateBoundingVolume();
-		unit->SanityCheck();
+		for_mt(idxBeg, idxEnd, [this](const int i) {
+			activeUnits[i]->localModel.UpdateBoundingVolume();
+		});
 	}
 }
 
@@ -393,6 +409,7 @@ void CUnitHandler::Update()
 	QueueDeleteUnits();
 	UpdateUnitLosStates();
 	SlowUpdateUnits();
+	UnitEconomySystem::Update();
 	UpdateUnits();
 	UpdateUnitWeapons();
 
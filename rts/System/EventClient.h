@@ -39,6 +39,31 @@ class LuaMaterial;
 #endif
 
 
+// records accumulated by CEventHandler for the *Batch call-ins; these hold
+// plain IDs since the objects may be gone by the time a batch is delivered
+struct SUnitDamagedEvent {
+	int unitID;
+	int unitDefID;
+	int unitTeam;
+	int unitAllyTeam;
+	int attackerID; // -1 if none
+	int weaponDefID;
+	int projectileID;
+	float damage;
+	bool paralyzer;
+};
+
+struct SProjectileEvent {
+	int projectileID;
+	int ownerID;     // -1 if none
+	int ownerDefID;  // -1 if none or already dead
+	int ownerTeam;
+	int allyTeam;    // -1 if unowned at creation
+	int weaponDefID; // -1 for non-weapon projectiles
+	bool piece;
+};
+
+
 enum DbgTimingInfoType {
 	TIMING_VIDEO,
 	TIMING_SIM,
@@ -75,6 +100,23 @@ class CEventClient
 			return (GetFullRead() || (GetReadAllyTeam() == allyTeam));
 		}
 
+		/**
+		 * Restricts the *Batch call-ins to events concerning units (or for
+		 * projectiles, owners) of the given defs and teams; empty passes all.
+		 */
+		void SetBatchFilter(std::vector<bool>&& unitDefs, std::vector<bool>&& teams) {
+			batchUnitDefs = std::move(unitDefs);
+			batchTeams = std::move(teams);
+		}
+		bool BatchFilterPasses(int unitDefID, int teamID) const {
+			if (!batchUnitDefs.empty() && (unitDefID < 0 || unitDefID >= int(batchUnitDefs.size()) || !batchUnitDefs[unitDefID]))
+				return false;
+			if (!batchTeams.empty() && (teamID < 0 || teamID >= int(batchTeams.size()) || !batchTeams[teamID]))
+				return false;
+
+			return true;
+		}
+
 	protected:
 		CEventClient(const std::string& name, int order, bool synced);
 		virtual ~CEventClient();
@@ -91,6 +133,9 @@ class CEventClient
 
 		std::vector<LinkPair> autoLinkedEvents;
 
+		std::vector<bool> batchUnitDefs;
+		std::vector<bool> batchTeams;
+
 		template <class T>
 		void RegisterLinkedEvents(T* foo) {
 			#define SETUP_EVENT(eventname, props) \
@@ -140,6 +185,7 @@ class CEventClient
 			int weaponDefID,
 			int projectileID,
 			bool paralyzer) {}
+		virtual void UnitDamagedBatch(const std::vector<SUnitDamagedEvent>& events) {}
 		virtual void UnitStunned(const CUnit* unit, bool stunned) {}
 		virtual void UnitExperience(const CUnit* unit, float oldExperience) {}
 		virtual void UnitHarvestStorageFull(const CUnit* unit) {}
@@ -189,6 +235,8 @@ class CEventClient
 
 		virtual void ProjectileCreated(const CProjectile* proj) {}
 		virtual void ProjectileDestroyed(const CProjectile* proj) {}
+		virtual void ProjectileCreatedBatch(const std::vector<SProjectileEvent>& events) {}
+		virtual void ProjectileDestroyedBatch(const std::vector<SProjectileEvent>& events) {}
 
 		virtual void RenderProjectileCreated(const CProjectile* proj) {}
 		virtual void RenderProjectileDestroyed(const CProjectile* proj) {}
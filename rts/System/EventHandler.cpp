@@ -8,6 +8,9 @@
 #include "System/Config/ConfigHandler.h"
 #include "System/Platform/Threading.h"
 #include "System/GlobalConfig.h"
+#include "Sim/Projectiles/WeaponProjectiles/WeaponProjectile.h"
+#include "Sim/Units/UnitDef.h"
+#include "Sim/Weapons/WeaponDef.h"
 
 #include <tracy/Tracy.hpp>
 
@@ -40,6 +43,10 @@ void CEventHandler::ResetState()
 	handles.clear();
 	handles.reserve(16);
 
+	unitDamagedBatch.clear();
+	projectileCreatedBatch.clear();
+	projectileDestroyedBatch.clear();
+
 	SetupEvents();
 }
 
@@ -549,6 +556,94 @@ void CEventHandler::GamePaused(int playerID, bool paused)
 	ITERATE_EVENTCLIENTLIST(GamePaused, playerID, paused);
 }
 
+static bool AcceptBatchedEvent(CEventClient* ec, const SUnitDamagedEvent& e)
+{
+	return (ec->CanReadAllyTeam(e.unitAllyTeam) && ec->BatchFilterPasses(e.unitDefID, e.unitTeam));
+}
+
+static bool AcceptBatchedEvent(CEventClient* ec, const SProjectileEvent& e)
+{
+	// projectile had no owner at creation if allyTeam is negative
+	return ((e.allyTeam < 0 || ec->CanReadAllyTeam(e.allyTeam)) && ec->BatchFilterPasses(e.ownerDefID, e.ownerTeam));
+}
+
+template<typename T, typename F> static void DeliverEventBatch(std::vector<CEventClient*>& list, std::vector<T>& batch, const F& func)
+{
+	static std::vector<T> frameBatch;
+	static std::vector<T> clientBatch;
+
+	// events raised by the call-ins themselves go into the next batch
+	frameBatch.clear();
+	std::swap(frameBatch, batch);
+
+	if (frameBatch.empty())
+		return;
+
+	for (size_t i = 0; i < list.size(); ) {
+		CEventClient* ec = list[i];
+
+		clientBatch.clear();
+
+		for (const T& e: frameBatch) {
+			if (AcceptBatchedEvent(ec, e))
+				clientBatch.push_back(e);
+		}
+
+		if (!clientBatch.empty())
+			(ec->*func)(clientBatch);
+
+		// the call-in may remove itself from the list
+		i += (i < list.size() && ec == list[i]);
+	}
+}
+
+void CEventHandler::RecordUnitDamagedEvent(
+	std::vector<SUnitDamagedEvent>& batch,
+	const CUnit* unit,
+	const CUnit* attacker,
+	float damage,
+	int weaponDefID,
+	int projectileID,
+	bool paralyzer
+) {
+	batch.push_back({
+		unit->id,
+		unit->unitDef->id,
+		unit->team,
+		unit->allyteam,
+		((attacker != nullptr)? attacker->id: -1),
+		weaponDefID,
+		projectileID,
+		damage,
+		paralyzer
+	});
+}
+
+void CEventHandler::RecordProjectileEvent(std::vector<SProjectileEvent>& batch, const CProjectile* proj, int allyTeam)
+{
+	const CUnit* owner = proj->owner();
+	const WeaponDef* wd = proj->weapon? static_cast<const CWeaponProjectile*>(proj)->GetWeaponDef(): nullptr;
+
+	batch.push_back({
+		proj->id,
+		static_cast<int>(proj->GetOwnerID()),
+		((owner != nullptr)? owner->unitDef->id: -1),
+		((owner != nullptr)? owner->team: int(proj->GetTeamID())),
+		allyTeam,
+		((wd != nullptr)? wd->id: -1),
+		proj->piece
+	});
+}
+
+void CEventHandler::FlushBatchedEvents()
+{
+	ZoneScoped;
+	DeliverEventBatch(listUnitDamagedBatch, unitDamagedBatch, &CEventClient::UnitDamagedBatch);
+	DeliverEventBatch(listProjectileCreatedBatch, projectileCreatedBatch, &CEventClient::ProjectileCreatedBatch);
+	DeliverEventBatch(listProjectileDestroyedBatch, projectileDestroyedBatch, &CEventClient::ProjectileDestroyedBatch);
+}
+
+
 void CEventHandler::GameFrame(int gameFrame)
 {
 	ZoneScoped;
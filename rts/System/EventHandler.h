@@ -132,6 +132,9 @@ class CEventHandler
 		void ProjectileCreated(const CProjectile* proj, int allyTeam);
 		void ProjectileDestroyed(const CProjectile* proj, int allyTeam);
 
+		/// delivers the *Batch call-ins accumulated since the previous call, once per client
+		void FlushBatchedEvents();
+
 		bool Explosion(int weaponDefID, int projectileID, const float3& pos, const CUnit* owner);
 
 		void StockpileChanged(const CUnit* unit,
@@ -344,6 +347,9 @@ class CEventHandler
 		void ListInsert(EventClientList& ciList, CEventClient* ec);
 		void ListRemove(EventClientList& ciList, CEventClient* ec);
 
+		static void RecordUnitDamagedEvent(std::vector<SUnitDamagedEvent>& batch, const CUnit* unit, const CUnit* attacker, float damage, int weaponDefID, int projectileID, bool paralyzer);
+		static void RecordProjectileEvent(std::vector<SProjectileEvent>& batch, const CProjectile* proj, int allyTeam);
+
 	private:
 		CEventClient* mouseOwner;
 
@@ -352,6 +358,11 @@ class CEventHandler
 
 		EventClientList handles;
 
+		// only filled while some client has the matching *Batch call-in
+		std::vector<SUnitDamagedEvent> unitDamagedBatch;
+		std::vector<SProjectileEvent> projectileCreatedBatch;
+		std::vector<SProjectileEvent> projectileDestroyedBatch;
+
 	#define SETUP_EVENT(name, props) EventClientList list ## name;
 	#define SETUP_UNMANAGED_EVENT(name, props)
 		#include "Events.def"
@@ -537,6 +548,9 @@ inline void CEventHandler::UnitDamaged(
 	bool paralyzer)
 {
 	ITERATE_UNIT_ALLYTEAM_EVENTCLIENTLIST(UnitDamaged, unit, attacker, damage, weaponDefID, projectileID, paralyzer)
+
+	if (!listUnitDamagedBatch.empty())
+		RecordUnitDamagedEvent(unitDamagedBatch, unit, attacker, damage, weaponDefID, projectileID, paralyzer);
 }
 
 inline void CEventHandler::UnitStunned(
@@ -663,6 +677,9 @@ inline void CEventHandler::ProjectileCreated(const CProjectile* proj, int allyTe
 			ec->ProjectileCreated(proj);
 		}
 	}
+
+	if (!listProjectileCreatedBatch.empty())
+		RecordProjectileEvent(projectileCreatedBatch, proj, allyTeam);
 }
 
 
@@ -677,6 +694,9 @@ inline void CEventHandler::ProjectileDestroyed(const CProjectile* proj, int ally
 			ec->ProjectileDestroyed(proj);
 		}
 	}
+
+	if (!listProjectileDestroyedBatch.empty())
+		RecordProjectileEvent(projectileDestroyedBatch, proj, allyTeam);
 }
 
 
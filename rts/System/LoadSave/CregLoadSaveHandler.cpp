@@ -240,12 +240,77 @@ static void LoadLuaState(CSplitLuaHandle* handle, creg::CInputStreamSerializer&
 	assert(plsc && plsccls == CLuaStateCollector::StaticClass());
 	CLuaStateCollector* lsc = static_cast<CLuaStateCollector*>(plsc);
 
+	// the freshly loaded state would not match what the rest of the save
+	// (e.g. Lua unit script indices) refers to
+	if (!lsc->valid && (handle != nullptr) && handle->syncedLuaHandle.IsValid()) {
+		spring::SafeDelete(lsc);
+		throw content_error("[LSH::LoadLuaState] save-file holds no synced " + handle->syncedLuaHandle.GetName() + " state");
+	}
+
 	lsc->Write(handle);
 
 	spring::SafeDelete(lsc);
 }
 
 
+const char* CCregLoadSaveHandler::GetSnapshotBlocker()
+{
+	if ((luaRules != nullptr) && luaRules->syncedLuaHandle.IsValid())
+		return "synced LuaRules";
+	if ((luaGaia != nullptr) && luaGaia->syncedLuaHandle.IsValid())
+		return "synced LuaGaia";
+	if (!skirmishAIHandler.GetAllSkirmishAIs().empty())
+		return "Skirmish AIs";
+
+	return nullptr;
+}
+
+
+bool CCregLoadSaveHandler::SaveSnapshot(const std::string& filePath)
+{
+#ifdef USING_CREG
+	if (GetSnapshotBlocker() != nullptr)
+		return false;
+
+	try {
+		std::stringstream oss;
+
+		WriteString(oss, SpringVersion::GetSync());
+		WriteString(oss, gameSetup->setupText);
+		WriteString(oss, modName);
+		WriteString(oss, mapName);
+
+		{
+			Sim::SaveComponents(oss);
+
+			creg::COutputStreamSerializer os;
+
+			// neither handle has a synced state (see GetSnapshotBlocker) and
+			// there are no AI blocks, so this touches nothing but creg data
+			SaveLuaState(luaGaia, os, oss);
+			SaveLuaState(luaRules, os, oss);
+
+			CGameStateCollector gsc;
+			os.SavePackage(&oss, &gsc, gsc.GetClass());
+		}
+
+		gzFile file = gzopen(filePath.c_str(), "wb5");
+
+		if (file == nullptr)
+			return false;
+
+		const std::string data = std::move(oss).str();
+		const bool written = (gzwrite(file, data.c_str(), data.size()) == int(data.size()));
+
+		return ((gzclose(file) == Z_OK) && written);
+	} catch (...) {
+		return false;
+	}
+#else //USING_CREG
+	return false;
+#endif //USING_CREG
+}
+
 void CCregLoadSaveHandler::SaveGame(const std::string& path)
 {
 #ifdef USING_CREG
@@ -306,7 +371,8 @@ void CCregLoadSaveHandler::SaveGame(const std::string& path)
 				return;
 			}
 
-			std::string data = oss.str();
+			// take over the buffer instead of copying what can be several hundred MB
+			std::string data = std::move(oss).str();
 			std::function<void(gzFile, std::string&&)> func = [](gzFile file, std::string&& data) {
 				gzwrite(file, data.c_str(), data.size());
 				gzflush(file, Z_FINISH);
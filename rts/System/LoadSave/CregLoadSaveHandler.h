@@ -18,6 +18,22 @@ public:
 	void LoadAIData() override;
 	void SaveGame(const std::string& path) override;
 
+	/**
+	 * Synchronously writes only the engine's creg state, for the forked
+	 * snapshot child: no logging, Lua or AI calls, any of which may wait
+	 * on a lock some other parent thread held at fork time. Fails if
+	 * GetSnapshotBlocker does, since that state can not be captured.
+	 * @return true once the file has been fully written
+	 */
+	bool SaveSnapshot(const std::string& filePath);
+	/**
+	 * Synced Lua (gadgets, and the Lua unit scripts living in them) and AI
+	 * state can not be serialized by SaveSnapshot, resuming without it
+	 * would silently diverge from the original game.
+	 * @return why no snapshot can be taken right now, or nullptr
+	 */
+	static const char* GetSnapshotBlocker();
+
 protected:
 	std::stringstream iss;
 };
@@ -1,11 +1,29 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <csignal>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 #include "LoadSaveHandler.h"
 #include "CregLoadSaveHandler.h"
 #include "LuaLoadSaveHandler.h"
 #include "Game/GameSetup.h"
+#include "System/FileSystem/DataDirsAccess.h"
+#include "System/FileSystem/FileQueryFlags.h"
 #include "System/FileSystem/FileSystem.h"
+#include "System/FileSystem/FileSystemAbstraction.h"
 #include "System/Log/ILog.h"
+#include "System/Misc/SpringTime.h"
+
+// a snapshot child still running after this long is assumed to be hung
+static constexpr int SNAPSHOT_TIMEOUT_SECS = 300;
 
 SaveFileData globalSaveFileData;
 
@@ -45,6 +63,109 @@ bool ILoadSaveHandler::CreateSave(
 	return true;
 }
 
+bool ILoadSaveHandler::CreateSnapshot(const std::string& saveFile)
+{
+	if (!FileSystem::CreateDirectory("Saves"))
+		return false;
+
+#ifdef _WIN32
+	return (CreateSave(saveFile, "-y"));
+#else
+	static pid_t snapshotPid = 0;
+	static spring_time snapshotTime;
+	static std::string snapshotTempPath;
+
+	if (snapshotPid > 0) {
+		int status = 0;
+
+		switch (waitpid(snapshotPid, &status, WNOHANG)) {
+			case 0: {
+				// previous child still serializing or compressing, don't pile them up
+				if (spring_diffsecs(spring_gettime(), snapshotTime) < SNAPSHOT_TIMEOUT_SECS) {
+					LOG_L(L_WARNING, "[ILoadSaveHandler::%s] previous snapshot still being written, skipping \"%s\"", __func__, saveFile.c_str());
+					return false;
+				}
+
+				LOG_L(L_WARNING, "[ILoadSaveHandler::%s] snapshot process %d did not finish within %ds, killing it", __func__, int(snapshotPid), SNAPSHOT_TIMEOUT_SECS);
+				kill(snapshotPid, SIGKILL);
+				waitpid(snapshotPid, nullptr, 0);
+				remove(snapshotTempPath.c_str());
+			} break;
+			case -1: {
+			} break;
+			default: {
+				if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+					LOG_L(L_WARNING, "[ILoadSaveHandler::%s] snapshot process %d failed (status %d)", __func__, int(snapshotPid), status);
+			} break;
+		}
+
+		snapshotPid = 0;
+	}
+
+	if (const char* blocker = CCregLoadSaveHandler::GetSnapshotBlocker(); blocker != nullptr) {
+		static bool warned = false;
+
+		// checked every interval, the game can change (e.g. /luarules reload)
+		if (!warned)
+			LOG_L(L_WARNING, "[ILoadSaveHandler::%s] snapshots can not capture %s state, not writing \"%s\" (use /save instead)", __func__, blocker, saveFile.c_str());
+
+		warned = true;
+		return false;
+	}
+
+	const std::string tempFile = saveFile + ".tmp";
+	const std::string tempPath = dataDirsAccess.LocateFile(tempFile, FileQueryFlags::WRITE);
+	const std::string filePath = dataDirsAccess.LocateFile(saveFile, FileQueryFlags::WRITE);
+
+	// set up before forking, the child does nothing but serialize
+	CCregLoadSaveHandler ls;
+	ls.SaveInfo(gameSetup->mapName, gameSetup->mapName);
+
+	switch ((snapshotPid = fork())) {
+		case -1: {
+			LOG_L(L_ERROR, "[ILoadSaveHandler::%s] fork failed (%s), snapshot \"%s\" not written", __func__, strerror(errno), saveFile.c_str());
+			snapshotPid = 0;
+			return false;
+		} break;
+		case 0: {
+			// child; owns a copy-on-write image of the sim state as of the
+			// end of the last frame and nothing but the calling thread, so
+			// it only serializes creg state (see SaveSnapshot) and skips all
+			// exit handlers
+			if (!ls.SaveSnapshot(tempPath))
+				_exit(1);
+
+			_exit((rename(tempPath.c_str(), filePath.c_str()) == 0)? 0: 1);
+		} break;
+		default: {
+			snapshotTime = spring_gettime();
+			snapshotTempPath = tempPath;
+		} break;
+	}
+
+	LOG("[ILoadSaveHandler::%s] writing snapshot \"%s\" (pid %d)", __func__, saveFile.c_str(), int(snapshotPid));
+	return true;
+#endif
+}
+
+std::string ILoadSaveHandler::FindNewestSnapshot()
+{
+	std::string newestFile;
+	unsigned int newestTime = 0;
+
+	for (const std::string& file: dataDirsAccess.FindFiles("Saves", "snapshot-*.ssf")) {
+		const unsigned int time = FileSystemAbstraction::GetFileModificationTime(file);
+
+		if (!newestFile.empty() && time < newestTime)
+			continue;
+
+		newestFile = file;
+		newestTime = time;
+	}
+
+	return newestFile;
+}
+
 std::string ILoadSaveHandler::FindSaveFile(const std::string& file)
 {
 	if (FileSystem::FileExists(file))
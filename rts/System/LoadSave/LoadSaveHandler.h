@@ -9,6 +9,7 @@
 struct SaveFileData {
 	std::string name; // "saves/quicksave.ssf"
 	std::string args; // "-y"
+	bool snapshot = false; // see ILoadSaveHandler::CreateSnapshot
 };
 
 class ILoadSaveHandler
@@ -20,10 +21,24 @@ public:
 	static bool CreateSave(SaveFileData fileData) {
 		if (fileData.name.empty())
 			return false;
+		if (fileData.snapshot)
+			return (CreateSnapshot(fileData.name));
 
 		return (CreateSave(fileData.name, fileData.args));
 	}
 
+	/**
+	 * Like CreateSave, but serializes from a forked copy of the process so
+	 * the game continues while the snapshot is written (where fork exists,
+	 * otherwise this is a blocking save). The file is only replaced once
+	 * the new snapshot is complete. Forked snapshots hold only the creg
+	 * state, so they are not written while synced Lua gadgets or AIs are
+	 * present (see CCregLoadSaveHandler::GetSnapshotBlocker).
+	 */
+	static bool CreateSnapshot(const std::string& saveFile);
+	/// @return the most recently written "Saves/snapshot-*.ssf", or an empty string
+	static std::string FindNewestSnapshot();
+
 protected:
 	static std::string FindSaveFile(const std::string& file);
 
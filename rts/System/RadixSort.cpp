@@ -0,0 +1,103 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "RadixSort.h"
+#include "System/Threading/ThreadPool.h"
+
+#include <algorithm>
+#include <array>
+
+static constexpr uint32_t RADIX_BITS = 8;
+static constexpr uint32_t RADIX_SIZE = 1 << RADIX_BITS;
+static constexpr uint32_t RADIX_MASK = RADIX_SIZE - 1;
+static constexpr uint32_t NUM_PASSES = 64 / RADIX_BITS;
+
+// smaller chunks are not worth the per-pass scheduling overhead
+static constexpr size_t MIN_CHUNK_SIZE = 4096;
+
+typedef std::array<uint32_t, RADIX_SIZE> Histogram;
+
+
+void spring::RadixSortMT(std::vector<uint64_t>& keys, std::vector<uint64_t>& temp)
+{
+	const size_t numKeys = keys.size();
+
+	if (numKeys < 2)
+		return;
+
+	temp.resize(numKeys);
+
+	const size_t numChunks = std::clamp(numKeys / MIN_CHUNK_SIZE, size_t(1), size_t(ThreadPool::GetNumThreads()));
+	const size_t chunkSize = (numKeys + numChunks - 1) / numChunks;
+
+	std::vector< std::array<Histogram, NUM_PASSES> > digitCounts(numChunks);
+	std::vector< Histogram > chunkOffsets(numChunks);
+
+	// count the digits of all passes in one read; a pass can be
+	// skipped when every key falls into the same bucket
+	for_mt(0, numChunks, [&](const int c) {
+		auto& counts = digitCounts[c];
+
+		for (auto& h: counts) {
+			h.fill(0);
+		}
+
+		for (size_t i = c * chunkSize, n = std::min(numKeys, i + chunkSize); i < n; i++) {
+			for (uint32_t p = 0; p < NUM_PASSES; p++) {
+				counts[p][(keys[i] >> (p * RADIX_BITS)) & RADIX_MASK] += 1;
+			}
+		}
+	});
+
+	uint64_t* src = keys.data();
+	uint64_t* dst = temp.data();
+
+	for (uint32_t p = 0; p < NUM_PASSES; p++) {
+		const uint32_t shift = p * RADIX_BITS;
+
+		{
+			Histogram totals = {};
+
+			for (size_t c = 0; c < numChunks; c++) {
+				for (uint32_t b = 0; b < RADIX_SIZE; b++) {
+					totals[b] += digitCounts[c][p][b];
+				}
+			}
+
+			if (std::find(totals.begin(), totals.end(), numKeys) != totals.end())
+				continue;
+		}
+
+		// chunk contents change after every scatter, so per-chunk counts
+		// from the initial read are only valid for the first real pass
+		for_mt(0, numChunks, [&](const int c) {
+			Histogram& counts = chunkOffsets[c];
+			counts.fill(0);
+
+			for (size_t i = c * chunkSize, n = std::min(numKeys, i + chunkSize); i < n; i++) {
+				counts[(src[i] >> shift) & RADIX_MASK] += 1;
+			}
+		});
+
+		// bucket-major prefix sum; lower chunks go first within each bucket to keep the sort stable
+		for (uint32_t b = 0, sum = 0; b < RADIX_SIZE; b++) {
+			for (size_t c = 0; c < numChunks; c++) {
+				const uint32_t n = chunkOffsets[c][b];
+				chunkOffsets[c][b] = sum;
+				sum += n;
+			}
+		}
+
+		for_mt(0, numChunks, [&](const int c) {
+			Histogram& offsets = chunkOffsets[c];
+
+			for (size_t i = c * chunkSize, n = std::min(numKeys, i + chunkSize); i < n; i++) {
+				dst[offsets[(src[i] >> shift) & RADIX_MASK]++] = src[i];
+			}
+		});
+
+		std::swap(src, dst);
+	}
+
+	if (src != keys.data())
+		keys.swap(temp);
+}
@@ -0,0 +1,19 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <cstdint>
+#include <vector>
+
+namespace spring {
+	/**
+	 * Sorts <keys> ascending with a stable LSD radix sort (8 bits per pass).
+	 * Histogram and scatter steps are split over the ThreadPool for larger
+	 * inputs, and passes in which all keys share the same digit are skipped.
+	 * <temp> is scratch space, kept by the caller to avoid reallocations.
+	 */
+	void RadixSortMT(std::vector<uint64_t>& keys, std::vector<uint64_t>& temp);
+}
+
+#endif
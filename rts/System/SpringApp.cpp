@@ -106,6 +106,7 @@
 
 CONFIG(unsigned, SetCoreAffinity).defaultValue(0).safemodeValue(1).description("Defines a bitmask indicating which CPU cores the main-thread should use.");
 CONFIG(unsigned, TextureMemPoolSize).defaultValue(512).minimumValue(0).description("Set to 0 to disable, otherwise specify a predefined memory to serve Bitmap allocation requests");
+CONFIG(bool, TextureMemPoolConcurrent).defaultValue(true).description("Serve Bitmap allocation requests from lock-free size-class free-lists rather than one contiguous block, so textures can be loaded in parallel. TextureMemPoolSize then limits the memory kept for reuse.");
 CONFIG(bool, UseLuaMemPools).defaultValue(true).description("Whether Lua VM memory allocations are made from pools.");
 CONFIG(bool, UseHighResTimer).defaultValue(false).description("On Windows, sets whether Spring will use low- or high-resolution timer functions for tasks like graphical interpolation between game frames.");
 CONFIG(bool, UseFontConfigLib).defaultValue(true).description("Whether the system fontconfig library (if present and enabled at compile-time) should be used for handling fonts.");
@@ -144,6 +145,8 @@ DEFINE_string   (game,                                     "",    "Specify the g
 DEFINE_string   (map,                                      "",    "Specify the map that will be instantly loaded");
 DEFINE_string   (menu,                                     "",    "Specify a lua menu archive to be used by spring");
 DEFINE_string   (name,                                     "",    "Set your player name");
+DEFINE_string_EX(sim_benchmark,      "sim-benchmark",      "",    "Run the given demo or start-script at maximum speed and write sim timings as JSON to this file (see SimBenchmarkFile)");
+DEFINE_bool_EX  (resume_snapshot,    "resume-snapshot",    false, "Load the newest crash-recovery snapshot (see SnapshotInterval) from the Saves directory");
 DEFINE_bool     (oldmenu,                                  false, "Start the old menu");
 
 
@@ -254,7 +257,7 @@ bool SpringApp::Init()
 	globalRendering->InitGLState();
 
 	CCameraHandler::InitStatic();
-	CBitmap::InitPool(configHandler->GetInt("TextureMemPoolSize"));
+	CBitmap::InitPool(configHandler->GetInt("TextureMemPoolSize"), configHandler->GetBool("TextureMemPoolConcurrent"));
 
 	UpdateInterfaceGeometry();
 	InitFonts();
@@ -551,6 +554,9 @@ void SpringApp::ParseCmdLine(int argc, char* argv[])
 	// logOutput's init depends on configHandler
 	FileSystemInitializer::PreInitializeConfigHandler(FLAGS_config, FLAGS_name, FLAGS_safemode);
 	FileSystemInitializer::InitializeLogOutput();
+
+	if (!FLAGS_sim_benchmark.empty())
+		configHandler->SetString("SimBenchmarkFile", FLAGS_sim_benchmark, true);
 }
 
 
@@ -669,6 +675,14 @@ void SpringApp::Startup()
 
 	luaMenuController = new CLuaMenuController(FLAGS_menu);
 
+	if (FLAGS_resume_snapshot) {
+		if ((inputFile = ILoadSaveHandler::FindNewestSnapshot()).empty())
+			throw content_error("no snapshot found to resume from");
+
+		LoadSaveFile(inputFile);
+		return;
+	}
+
 	// no argument (either game is given or show selectmenu)
 	if (inputFile.empty()) {
 		clientSetup->isHost = true;
@@ -777,7 +791,7 @@ void SpringApp::Reload(const std::string script)
 	*
 	CglFont::ReallocSystemFontAtlases(true);
 	CBitmap::KillPool();
-	CBitmap::InitPool(configHandler->GetInt("TextureMemPoolSize"));
+	CBitmap::InitPool(configHandler->GetInt("TextureMemPoolSize"), configHandler->GetBool("TextureMemPoolConcurrent"));
 	CglFont::ReallocSystemFontAtlases(false);
 	*/
 
@@ -0,0 +1,165 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifdef SYNCCHECK
+
+#include <algorithm>
+
+#include "SyncChannels.h"
+
+#include "Lua/LuaHandleSynced.h"
+#include "Sim/Features/Feature.h"
+#include "Sim/Features/FeatureHandler.h"
+#include "Sim/Misc/GlobalConstants.h"
+#include "Sim/Misc/GlobalSynced.h"
+#include "Sim/Misc/Team.h"
+#include "Sim/Misc/TeamHandler.h"
+#include "Sim/MoveTypes/MoveType.h"
+#include "Sim/Projectiles/Projectile.h"
+#include "Sim/Projectiles/ProjectileHandler.h"
+#include "Sim/Units/Unit.h"
+#include "Sim/Units/UnitDef.h"
+#include "Sim/Units/UnitHandler.h"
+#include "System/SpringHash.h"
+#include "System/Threading/ThreadPool.h"
+
+
+static int GetRange(int id, int maxID, int numRanges = CSyncChannels::NUM_RANGES)
+{
+	return std::clamp((id * numRanges) / maxID, 0, numRanges - 1);
+}
+
+static uint32_t* GetChannel(CSyncChannels::Checksums& checksums, int channel)
+{
+	return &checksums[channel * CSyncChannels::NUM_RANGES];
+}
+
+// combined by addition; rules-params maps are hashed order-independently
+static uint32_t HashParams(const LuaRulesParams::Params& params)
+{
+	uint32_t sum = 0;
+
+	for (const auto& p: params) {
+		uint32_t hash = spring::LiteHash(p.first.data(), p.first.size(), p.second.los);
+
+		std::visit([&hash](const auto& v) {
+			using T = std::decay_t<decltype(v)>;
+
+			if constexpr (std::is_same_v<T, std::string>) {
+				hash = spring::LiteHash(v.data(), v.size(), hash);
+			} else {
+				hash = spring::LiteHash(v, hash);
+			}
+		}, p.second.value);
+
+		sum += hash;
+	}
+
+	return sum;
+}
+
+
+static void HashUnits(uint32_t* hashes)
+{
+	for (const CUnit* u: unitHandler.GetActiveUnits()) {
+		uint32_t& hash = hashes[GetRange(u->id, MAX_UNITS)];
+
+		hash = spring::LiteHash(u->id, hash);
+		hash = spring::LiteHash(u->unitDef->id, hash);
+		hash = spring::LiteHash(u->team, hash);
+		hash = spring::LiteHash(u->pos, hash);
+		hash = spring::LiteHash(u->speed, hash);
+		hash = spring::LiteHash(u->heading, hash);
+		hash = spring::LiteHash(u->health, hash);
+		hash = spring::LiteHash(u->buildProgress, hash);
+		hash = spring::LiteHash(u->paralyzeDamage, hash);
+	}
+}
+
+static void HashProjectiles(uint32_t* hashes)
+{
+	for (const CProjectile* p: projectileHandler.GetActiveProjectiles(true)) {
+		uint32_t& hash = hashes[GetRange(p->id, MAX_PROJECTILES)];
+
+		hash = spring::LiteHash(p->id, hash);
+		hash = spring::LiteHash(p->pos, hash);
+		hash = spring::LiteHash(p->speed, hash);
+	}
+}
+
+static void HashFeatures(uint32_t* hashes)
+{
+	// unordered_set, combine by addition
+	for (const int featureID: featureHandler.GetActiveFeatureIDs()) {
+		const CFeature* f = featureHandler.GetFeature(featureID);
+
+		uint32_t hash = spring::LiteHash(f->id);
+		hash = spring::LiteHash(f->pos, hash);
+		hash = spring::LiteHash(f->health, hash);
+		hash = spring::LiteHash(f->reclaimLeft, hash);
+
+		hashes[GetRange(f->id, MAX_FEATURES)] += hash;
+	}
+}
+
+static void HashPaths(uint32_t* hashes)
+{
+	for (const CUnit* u: unitHandler.GetActiveUnits()) {
+		AMoveType* mt = u->moveType;
+
+		if (mt == nullptr)
+			continue;
+
+		uint32_t& hash = hashes[GetRange(u->id, MAX_UNITS)];
+
+		hash = spring::LiteHash(u->id, hash);
+		hash = spring::LiteHash(mt->goalPos, hash);
+		hash = spring::LiteHash(mt->progressState, hash);
+		hash = spring::LiteHash(mt->GetPathId(), hash);
+	}
+}
+
+static void HashRulesParams(uint32_t* hashes)
+{
+	hashes[0] = HashParams(CSplitLuaHandle::GetGameParams());
+
+	for (int teamNum = 0; teamNum < teamHandler.ActiveTeams(); ++teamNum) {
+		hashes[1] = spring::LiteHash(HashParams(teamHandler.Team(teamNum)->modParams), hashes[1]);
+	}
+
+	for (const CUnit* u: unitHandler.GetActiveUnits()) {
+		uint32_t& hash = hashes[2 + GetRange(u->id, MAX_UNITS, CSyncChannels::NUM_UNIT_PARAM_RANGES)];
+
+		hash = spring::LiteHash(u->id, hash);
+		hash = spring::LiteHash(HashParams(u->modParams), hash);
+	}
+}
+
+static void HashRNG(uint32_t* hashes)
+{
+	hashes[0] = spring::LiteHash(gsRNG.GetGenState());
+	hashes[1] = spring::LiteHash(gsRNG.GetLastSeed());
+}
+
+
+
+void CSyncChannels::Calculate(Checksums& checksums)
+{
+	checksums.fill(0);
+
+	// channels only read sim state, one job each
+	for_mt(0, NUM_CHANNELS, [&checksums](const int channel) {
+		uint32_t* hashes = GetChannel(checksums, channel);
+
+		switch (channel) {
+			case CHANNEL_UNITS      : { HashUnits      (hashes); } break;
+			case CHANNEL_PROJECTILES: { HashProjectiles(hashes); } break;
+			case CHANNEL_FEATURES   : { HashFeatures   (hashes); } break;
+			case CHANNEL_PATHS      : { HashPaths      (hashes); } break;
+			case CHANNEL_RULESPARAMS: { HashRulesParams(hashes); } break;
+			case CHANNEL_RNG        : { HashRNG        (hashes); } break;
+			default: {} break;
+		}
+	});
+}
+
+#endif // SYNCCHECK
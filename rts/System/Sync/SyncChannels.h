@@ -0,0 +1,92 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef SYNC_CHANNELS_H
+#define SYNC_CHANNELS_H
+
+#ifdef SYNCCHECK
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include "Sim/Misc/GlobalConstants.h"
+
+/**
+ * @brief per-subsystem sync checksums
+ *
+ * Unlike CSyncChecker's running checksum over synced assignments, these hash
+ * the end-of-frame state of a few subsystems, each split into a number of
+ * object ranges. Clients send them every SyncChannelInterval frames, so the
+ * server can name the subsystem and range that diverged first instead of
+ * only noticing that something did.
+ */
+class CSyncChannels {
+public:
+	enum {
+		CHANNEL_UNITS       = 0,
+		CHANNEL_PROJECTILES = 1,
+		CHANNEL_FEATURES    = 2,
+		CHANNEL_PATHS       = 3,
+		CHANNEL_RULESPARAMS = 4,
+		CHANNEL_RNG         = 5,
+		NUM_CHANNELS        = 6,
+	};
+
+	static constexpr int NUM_RANGES = 8;
+	static constexpr int NUM_CHECKSUMS = NUM_CHANNELS * NUM_RANGES;
+
+	// rules-params ranges 0 and 1 hold the game- and team-params, the rest unit-params
+	static constexpr int NUM_UNIT_PARAM_RANGES = NUM_RANGES - 2;
+
+	typedef std::array<uint32_t, NUM_CHECKSUMS> Checksums;
+
+public:
+	/// hashes all channels (in parallel); call at the end of a SimFrame
+	static void Calculate(Checksums& checksums);
+
+	/// @return index (channel * NUM_RANGES + range) of the first differing checksum, or -1
+	static int FindFirstMismatch(const Checksums& a, const Checksums& b) {
+		for (int i = 0; i < NUM_CHECKSUMS; ++i) {
+			if (a[i] != b[i])
+				return i;
+		}
+
+		return -1;
+	}
+
+	/// e.g. "units 4000-7999"; header-only since the dedicated server does not link the sim
+	static std::string GetDescription(int index) {
+		const int channel = index / NUM_RANGES;
+		const int range = index % NUM_RANGES;
+
+		const auto FormatRange = [](const char* name, int range, int maxID, int numRanges) {
+			return std::string(name) + " " + std::to_string((range * maxID) / numRanges) + "-" + std::to_string(((range + 1) * maxID) / numRanges - 1);
+		};
+
+		switch (channel) {
+			case CHANNEL_UNITS      : return FormatRange("units"      , range, MAX_UNITS      , NUM_RANGES);
+			case CHANNEL_PROJECTILES: return FormatRange("projectiles", range, MAX_PROJECTILES, NUM_RANGES);
+			case CHANNEL_FEATURES   : return FormatRange("features"   , range, MAX_FEATURES   , NUM_RANGES);
+			case CHANNEL_PATHS      : return FormatRange("unit paths" , range, MAX_UNITS      , NUM_RANGES);
+			case CHANNEL_RULESPARAMS: {
+				if (range == 0)
+					return "game rules-params";
+				if (range == 1)
+					return "team rules-params";
+
+				return FormatRange("unit rules-params", range - 2, MAX_UNITS, NUM_UNIT_PARAM_RANGES);
+			} break;
+			case CHANNEL_RNG: {
+				return (range == 0)? "rng state": "rng seed";
+			} break;
+			default: {
+			} break;
+		}
+
+		return "unknown";
+	}
+};
+
+#endif // SYNCCHECK
+
+#endif // SYNC_CHANNELS_H
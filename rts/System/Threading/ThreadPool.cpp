@@ -42,6 +42,7 @@
 
 #ifndef UNIT_TEST
 CONFIG(int, WorkerThreadCount).defaultValue(-1).safemodeValue(0).minimumValue(-1).description("Number of workers (including the main thread!) used by ThreadPool.");
+CONFIG(int, WorkerThreadSpinTime).defaultValue(30).minimumValue(0).maximumValue(1000).description("Microseconds the first ThreadPool worker busy-waits for new tasks before sleeping; 0 makes all idle workers sleep right away, which is preferable when several engines share a machine.");
 #endif
 
 
@@ -73,11 +74,25 @@ static std::array<boost::lockfree::queue<ITaskGroup*>, ThreadPool::MAX_THREADS>
 static std::array<moodycamel::ConcurrentQueue<ITaskGroup*>, ThreadPool::MAX_THREADS> taskQueues[2];
 #endif
 
+// per-thread queues for stealable tasks; kept apart from taskQueues since
+// tasks there (e.g. from parallel_reduce) must run on their wanted thread
+#ifdef USE_BOOST_LOCKFREE_QUEUE
+static std::array<boost::lockfree::queue<ITaskGroup*>, ThreadPool::MAX_THREADS> stealQueues[2];
+#else
+static std::array<moodycamel::ConcurrentQueue<ITaskGroup*>, ThreadPool::MAX_THREADS> stealQueues[2];
+#endif
+
 static std::vector<void*> workerThreads[2];
 static std::array<bool, ThreadPool::MAX_THREADS> exitFlags;
 static std::array<ThreadStats, ThreadPool::MAX_THREADS> threadStats[2];
 static spring::signal newTasksSignal[2];
 
+// number of threads inside WaitForFinished; async (background) workers
+// hold off on new tasks while this is non-zero so sim-critical tasks in
+// the sync pool do not have to compete with them for cores
+static std::atomic_int numSyncWaiters = {0};
+static int workerSpinTime = 30;
+
 static _threadlocal int threadnum(0);
 
 #ifndef UNITSYNC
@@ -107,6 +122,14 @@ static int GetConfigNumWorkers() {
 	#endif
 }
 
+static int GetConfigSpinTime() {
+	#ifndef UNIT_TEST
+	return configHandler->GetInt("WorkerThreadSpinTime");
+	#else
+	return 30;
+	#endif
+}
+
 static int GetDefaultNumWorkers() {
 	const int maxNumThreads = GetMaxThreads(); // min(MAX_THREADS, logicalCpus)
 	const int cfgNumWorkers = GetConfigNumWorkers();
@@ -133,6 +156,50 @@ bool HasThreads() { return !workerThreads[false].empty(); }
 
 
 
+static void ExecuteTask(ITaskGroup* tg, int tid, bool async)
+{
+	assert(!async || tg->IsAsyncTask());
+
+	#ifdef USE_TASK_STATS_TRACKING
+	const uint64_t wdt = tg->GetDeltaTime(spring_now());
+	const uint64_t edt = tg->ExecuteLoop(tid, false);
+
+	threadStats[async][tid].numTasksRun += 1;
+	threadStats[async][tid].sumExecTime += edt;
+	threadStats[async][tid].sumWaitTime += wdt;
+	threadStats[async][tid].minExecTime  = std::min(threadStats[async][tid].minExecTime, edt);
+	threadStats[async][tid].maxExecTime  = std::max(threadStats[async][tid].maxExecTime, edt);
+	threadStats[async][tid].minWaitTime  = std::min(threadStats[async][tid].minWaitTime, wdt);
+	threadStats[async][tid].maxWaitTime  = std::max(threadStats[async][tid].maxWaitTime, wdt);
+	#else
+	tg->ExecuteLoop(tid, false);
+	#endif
+}
+
+static bool StealTask(int tid, bool async)
+{
+	const int numThreads = GetNumThreads();
+
+	// own queue first, then the others starting at our neighbour
+	for (int n = 0; n < numThreads; n++) {
+		auto& queue = stealQueues[async][(tid + n) % numThreads];
+		ITaskGroup* tg = nullptr;
+
+		#ifdef USE_BOOST_LOCKFREE_QUEUE
+		if (!queue.pop(tg))
+			continue;
+		#else
+		if (!queue.try_dequeue(tg))
+			continue;
+		#endif
+
+		ExecuteTask(tg, tid, async);
+		return true;
+	}
+
+	return false;
+}
+
 static bool DoTask(int tid, bool async)
 {
 	#ifndef UNIT_TEST
@@ -158,22 +225,7 @@ static bool DoTask(int tid, bool async)
 			if (idx == 0)
 				NotifyWorkerThreads(true, async);
 
-			assert(!async || tg->IsAsyncTask());
-
-			#ifdef USE_TASK_STATS_TRACKING
-			const uint64_t wdt = tg->GetDeltaTime(spring_now());
-			const uint64_t edt = tg->ExecuteLoop(tid, false);
-
-			threadStats[async][tid].numTasksRun += 1;
-			threadStats[async][tid].sumExecTime += edt;
-			threadStats[async][tid].sumWaitTime += wdt;
-			threadStats[async][tid].minExecTime  = std::min(threadStats[async][tid].minExecTime, edt);
-			threadStats[async][tid].maxExecTime  = std::max(threadStats[async][tid].maxExecTime, edt);
-			threadStats[async][tid].minWaitTime  = std::min(threadStats[async][tid].minWaitTime, wdt);
-			threadStats[async][tid].maxWaitTime  = std::max(threadStats[async][tid].maxWaitTime, wdt);
-			#else
-			tg->ExecuteLoop(tid, false);
-			#endif
+			ExecuteTask(tg, tid, async);
 		}
 
 		#ifdef USE_BOOST_LOCKFREE_QUEUE
@@ -181,27 +233,16 @@ static bool DoTask(int tid, bool async)
 		#else
 		while (queue.try_dequeue(tg)) {
 		#endif
-			assert(!async || tg->IsAsyncTask());
-
-			#ifdef USE_TASK_STATS_TRACKING
-			const uint64_t wdt = tg->GetDeltaTime(spring_now());
-			const uint64_t edt = tg->ExecuteLoop(tid, false);
-
-			threadStats[async][tid].numTasksRun += 1;
-			threadStats[async][tid].sumExecTime += edt;
-			threadStats[async][tid].sumWaitTime += wdt;
-			threadStats[async][tid].minExecTime  = std::min(threadStats[async][tid].minExecTime, edt);
-			threadStats[async][tid].maxExecTime  = std::max(threadStats[async][tid].maxExecTime, edt);
-			threadStats[async][tid].minWaitTime  = std::min(threadStats[async][tid].minWaitTime, wdt);
-			threadStats[async][tid].maxWaitTime  = std::max(threadStats[async][tid].maxWaitTime, wdt);
-			#else
-			tg->ExecuteLoop(tid, false);
-			#endif
+			ExecuteTask(tg, tid, async);
 		}
 	}
 
 	// if true, queue contained at least one element
-	return (tg != nullptr);
+	if (tg != nullptr)
+		return true;
+
+	// nothing pinned to us, help out whoever has a backlog
+	return (tid != 0 && StealTask(tid, async));
 }
 
 
@@ -219,13 +260,27 @@ static void WorkerLoop(int tid, bool async)
 	// is inserted, which can then take over the job of waking up sleeping workers
 	// (see NotifyWorkerThreads)
 	// NOTE: the spin-time has to be *short* to avoid biasing thread 1's workload
-	const auto ourSpinTime = spring_time::fromMicroSecs(30 * (tid == 1));
+	const auto ourSpinTime = spring_time::fromMicroSecs(workerSpinTime * (tid == 1));
 	const auto maxSleepTime = spring_time::fromMilliSecs(30);
+	const auto maxDeferTime = spring_time::fromMilliSecs(2);
+
+	auto deferTime = spring_notime;
 
 	while (!exitFlags[tid]) {
 		const auto spinlockEnd = spring_now() + ourSpinTime;
 		      auto sleepTime   = spring_time::fromMicroSecs(1);
 
+		// background work yields to the sync pool while anyone waits on it;
+		// running tasks are not interrupted, and the deferral is bounded in
+		// case a sync task itself waits on a background one
+		if (async && numSyncWaiters.load(std::memory_order_relaxed) > 0 && deferTime < maxDeferTime) {
+			newTasksSignal[async].wait_for(spring_time::fromMicroSecs(100));
+			deferTime += spring_time::fromMicroSecs(100);
+			continue;
+		}
+
+		deferTime = spring_notime;
+
 		while (!DoTask(tid, async) && !exitFlags[tid]) {
 			if (spring_now() < spinlockEnd)
 				continue;
@@ -244,6 +299,11 @@ void WaitForFinished(std::shared_ptr<ITaskGroup>&& taskGroup)
 	// can be any worker-thread (for_mt inside another for_mt, etc)
 	const int tid = GetThreadNum();
 
+	struct SyncWaiter {
+		SyncWaiter() { numSyncWaiters.fetch_add(1, std::memory_order_relaxed); }
+		~SyncWaiter() { numSyncWaiters.fetch_sub(1, std::memory_order_relaxed); }
+	} syncWaiter;
+
 	{
 		#ifndef UNIT_TEST
 		SCOPED_MT_TIMER("ThreadPool::WaitFor");
@@ -301,7 +361,8 @@ void WaitForFinished(std::shared_ptr<ITaskGroup>&& taskGroup)
 void PushTaskGroup(std::shared_ptr<ITaskGroup>&& taskGroup) { PushTaskGroup(taskGroup.get()); }
 void PushTaskGroup(ITaskGroup* taskGroup)
 {
-	auto& queue = taskQueues[ taskGroup->IsAsyncTask() ][ taskGroup->WantedThread() ];
+	auto& queues = taskGroup->IsStealable()? stealQueues: taskQueues;
+	auto& queue = queues[ taskGroup->IsAsyncTask() ][ taskGroup->WantedThread() ];
 
 	#if 0
 	// fake single-task group, handled by WaitForFinished to
@@ -407,9 +468,13 @@ static void KillThreads(int wantedNumThreads, int curNumThreads)
 		#ifdef USE_BOOST_LOCKFREE_QUEUE
 		while (taskQueues[false][i].pop(tg));
 		while (taskQueues[ true][i].pop(tg));
+		while (stealQueues[false][i].pop(tg));
+		while (stealQueues[ true][i].pop(tg));
 		#else
 		while (taskQueues[false][i].try_dequeue(tg));
 		while (taskQueues[ true][i].try_dequeue(tg));
+		while (stealQueues[false][i].try_dequeue(tg));
+		while (stealQueues[ true][i].try_dequeue(tg));
 		#endif
 	}
 
@@ -505,6 +570,8 @@ void SetThreadCount(int wantedNumThreads)
 	#endif
 
 	if (curNumThreads < wtdNumThreads) {
+		workerSpinTime = GetConfigSpinTime();
+
 		SpawnThreads(wtdNumThreads, curNumThreads);
 	} else {
 		KillThreads(wtdNumThreads, curNumThreads);
@@ -170,6 +170,7 @@ public:
 	}
 
 	bool IsFinished() const { assert(remainingTasks.load() >= 0); return (remainingTasks.load(std::memory_order_relaxed) == 0); }
+	bool IsStealable() const { return (stealable.load(std::memory_order_relaxed)); }
 	bool IsInJobQueue() const { return (inTaskQueue.load(std::memory_order_relaxed)); }
 	bool IsInTaskPool() const { return ((taskPoolMask.load(std::memory_order_relaxed) & (1 << 0)) != 0); }
 	bool IsInPoolUse() const { return ((taskPoolMask.load(std::memory_order_relaxed) & (1 << 1)) != 0); }
@@ -198,6 +199,7 @@ public:
 		wantedThread.store(0);
 		taskPoolMask.store(((1 * pooled) << 0) + ((1 * inuse) << 1));
 
+		stealable.store(false);
 		inTaskQueue.store(queued);
 		execLoopDone.store(false);
 	}
@@ -207,6 +209,7 @@ public:
 	std::atomic_int wantedThread; // if 0 (default), task will be executed by an arbitrary thread
 	std::atomic_int taskPoolMask; // whether this task is managed (owned) and in use by a TaskPool
 
+	std::atomic_bool stealable; // if true, wantedThread is only a hint and idle threads may take the task
 	std::atomic_bool inTaskQueue; // whether this task is still in a thread's queue
 	std::atomic_bool execLoopDone; // whether the thread running this task is about to exit ExecLoop
 
@@ -718,15 +721,22 @@ static inline void for_mt(int start, int end, F&& f)
 template <typename F>
 static inline void for_mt_chunk(int b, int e, F&& f, int chunkOrMinChinkSize = 0)
 {
+	// number of chunks per thread if the chunk-size is not given; more
+	// chunks than threads let faster threads pick up the slack of ones
+	// that were handed expensive elements
+	constexpr int CHUNKS_PER_THREAD = 4;
+
 	const int numElems = e - b;
 	if (numElems <= 0)
 		return;
 
-	static const int maxThreads = ThreadPool::GetNumThreads();
+	const int maxThreads = ThreadPool::GetNumThreads();
 
 	int chunkSize = chunkOrMinChinkSize;
 	if (chunkOrMinChinkSize <= 0) {
-		chunkSize = numElems / maxThreads + (numElems % maxThreads != 0); //split the work evenly. Does for_mt() do the same?
+		const int numWantedChunks = maxThreads * CHUNKS_PER_THREAD;
+
+		chunkSize = numElems / numWantedChunks + (numElems % numWantedChunks != 0);
 		chunkSize = std::max(chunkSize, -chunkOrMinChinkSize);
 	}
 	chunkSize = std::max(chunkSize, 1);
@@ -740,12 +750,10 @@ static inline void for_mt_chunk(int b, int e, F&& f, int chunkOrMinChinkSize = 0
 		return;
 	}
 
-	const int chunksPerThread = numChunks / maxThreads + (numChunks % maxThreads != 0);
-	const int numThreads = std::min(numChunks, maxThreads);
-
-	for_mt(0, numThreads, 1, [&f, b, e, chunkSize, chunksPerThread](const int jobId) {
-		const int bb = b + jobId * chunksPerThread * chunkSize;
-		const int ee = std::min(bb + chunksPerThread * chunkSize, e);
+	// chunks are claimed one at a time (see ForTaskGroup::ExecuteStep)
+	for_mt(0, numChunks, 1, [&f, b, e, chunkSize](const int chunkId) {
+		const int bb = b + chunkId * chunkSize;
+		const int ee = std::min(bb + chunkSize, e);
 
 		for (int i = bb; i < ee; ++i)
 			std::forward<F>(f)(i);
@@ -846,7 +854,9 @@ namespace ThreadPool {
 		// minor hack: assume AsyncTask's will cause (heavy) disk IO
 		// although these can never block the main thread, the async
 		// workers might still be handed an uneven work distribution
+		// so the task may be stolen by any idle worker
 		task->wantedThread.store(1 + task->GetId() % (ThreadPool::GetNumThreads() - 1));
+		task->stealable.store(true);
 
 		ThreadPool::PushTaskGroup(task);
 		return fut;
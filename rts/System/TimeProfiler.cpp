@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstdio>
 #include <cstring>
 
 #include "System/TimeProfiler.h"
@@ -24,6 +25,46 @@ static spring::unordered_map<unsigned, int> refCounters;
 
 static CGlobalUnsyncedRNG profileColorRNG;
 
+
+// layout of the StartRecording file: header, <numSamples> ring slots
+// and the hash-to-name table; bump the version when changing either
+static constexpr uint32_t PROFILE_RECORD_MAGIC   = 0x46525053; // "SPRF"
+static constexpr uint32_t PROFILE_RECORD_VERSION = 1;
+
+struct ProfileRecordHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t numSamples;
+	uint32_t numNames;
+	// total number of samples written, the next goes to slot (numWritten % numSamples)
+	uint64_t numWritten;
+};
+
+struct ProfileRecordSample {
+	int32_t frameNum;
+	uint32_t nameHash;
+	uint32_t duration; // in microseconds
+	uint16_t threadNum;
+	uint16_t padding;
+};
+
+static_assert(sizeof(ProfileRecordSample) == 16, "");
+
+struct ProfileRecorder {
+	FILE* file = nullptr;
+
+	ProfileRecordHeader header;
+
+	// filled by AddTime (any thread), drained into the file by Update
+	std::vector<ProfileRecordSample> pendingSamples;
+	std::vector<ProfileRecordSample> flushedSamples;
+
+	spring::spinlock samplesMutex;
+};
+
+static ProfileRecorder profileRecorder;
+
+
 const std::array<CTimeProfiler::ProfileSortFunc, CTimeProfiler::SortType::ST_COUNT> CTimeProfiler::SortingFunctions = {
 	[](const TimeRecordPair& a, const TimeRecordPair& b) { return (a.first          < b.first         ); }, // ST_ALPHABETICAL = 0,
 	[](const TimeRecordPair& a, const TimeRecordPair& b) { return (a.second.total   > b.second.total  ); }, // ST_TOTALTIME    = 1,
@@ -217,6 +258,7 @@ void CTimeProfiler::Update()
 		UpdateRaw();
 		ResortProfilesRaw();
 		RefreshProfilesRaw();
+		FlushRecording();
 		return;
 	}
 
@@ -229,6 +271,7 @@ void CTimeProfiler::Update()
 	UpdateRaw();
 	ResortProfilesRaw();
 	RefreshProfilesRaw();
+	FlushRecording();
 }
 
 void CTimeProfiler::UpdateRaw()
@@ -352,6 +395,9 @@ void CTimeProfiler::AddTime(
 ) {
 	const spring_time t0 = spring_now();
 
+	if (recording)
+		RecordSample(nameHash, deltaTime);
+
 	if (!enabled) {
 		if (!specialTimer)
 			return;
@@ -421,3 +467,121 @@ void CTimeProfiler::PrintProfilingInfo() const
 	}
 }
 
+
+
+bool CTimeProfiler::StartRecording(const std::string& fileName, size_t numSamples)
+{
+	StopRecording();
+
+	ProfileRecorder& rec = profileRecorder;
+
+	if ((rec.file = fopen(fileName.c_str(), "wb+")) == nullptr) {
+		LOG_L(L_ERROR, "[TimeProfiler::%s] failed to open \"%s\"", __func__, fileName.c_str());
+		return false;
+	}
+
+	// keep file offsets below 2GB
+	rec.header = {PROFILE_RECORD_MAGIC, PROFILE_RECORD_VERSION, uint32_t(std::clamp(numSamples, size_t(1024), size_t(1) << 26)), 0, 0};
+
+	rec.pendingSamples.clear();
+	rec.pendingSamples.reserve(4096);
+	rec.flushedSamples.clear();
+	rec.flushedSamples.reserve(4096);
+
+	fwrite(&rec.header, sizeof(rec.header), 1, rec.file);
+
+	LOG("[TimeProfiler::%s] recording last %u samples to \"%s\"", __func__, rec.header.numSamples, fileName.c_str());
+
+	recording = true;
+	return true;
+}
+
+void CTimeProfiler::StopRecording()
+{
+	ProfileRecorder& rec = profileRecorder;
+
+	if (rec.file == nullptr)
+		return;
+
+	recording = false;
+
+	FlushRecording();
+	fclose(rec.file);
+
+	rec.file = nullptr;
+}
+
+void CTimeProfiler::FlushRecording()
+{
+	ProfileRecorder& rec = profileRecorder;
+	ProfileRecordHeader& hdr = rec.header;
+
+	if (rec.file == nullptr)
+		return;
+
+	{
+		std::lock_guard<spring::spinlock> lock(rec.samplesMutex);
+		std::swap(rec.pendingSamples, rec.flushedSamples);
+	}
+
+	// contiguous runs of slots, split where the ring wraps around
+	for (size_t i = 0, n = 0; i < rec.flushedSamples.size(); i += n) {
+		const uint64_t slot = hdr.numWritten % hdr.numSamples;
+
+		n = std::min(rec.flushedSamples.size() - i, size_t(hdr.numSamples - slot));
+
+		fseek(rec.file, long(sizeof(hdr) + slot * sizeof(ProfileRecordSample)), SEEK_SET);
+		fwrite(&rec.flushedSamples[i], sizeof(ProfileRecordSample), n, rec.file);
+
+		hdr.numWritten += n;
+	}
+
+	rec.flushedSamples.clear();
+
+	{
+		std::lock_guard<HashNamMutexType> lock(hashToNameMutex);
+
+		// names only ever get added, rewrite the table whenever it grew
+		if (hashToName.size() != hdr.numNames) {
+			fseek(rec.file, long(sizeof(hdr) + hdr.numSamples * sizeof(ProfileRecordSample)), SEEK_SET);
+
+			for (const auto& p: hashToName) {
+				const uint32_t nameLen = p.second.size();
+
+				fwrite(&p.first, sizeof(p.first), 1, rec.file);
+				fwrite(&nameLen, sizeof(nameLen), 1, rec.file);
+				fwrite(p.second.data(), nameLen, 1, rec.file);
+			}
+
+			hdr.numNames = hashToName.size();
+		}
+	}
+
+	fseek(rec.file, 0, SEEK_SET);
+	fwrite(&hdr, sizeof(hdr), 1, rec.file);
+	fflush(rec.file);
+}
+
+void CTimeProfiler::RecordSample(unsigned nameHash, const spring_time deltaTime)
+{
+	ProfileRecorder& rec = profileRecorder;
+	ProfileRecordSample sample;
+
+	sample.frameNum = recordFrameNum;
+	sample.nameHash = nameHash;
+	sample.duration = uint32_t(std::max<int64_t>(deltaTime.toMicroSecsi(), 0));
+	#ifdef THREADPOOL
+	sample.threadNum = ThreadPool::GetThreadNum();
+	#else
+	sample.threadNum = 0;
+	#endif
+	sample.padding = 0;
+
+	std::lock_guard<spring::spinlock> lock(rec.samplesMutex);
+
+	// anything beyond one full ring between two flushes would be overwritten anyway
+	if (rec.pendingSamples.size() >= rec.header.numSamples)
+		return;
+
+	rec.pendingSamples.push_back(sample);
+}
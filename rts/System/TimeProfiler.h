@@ -187,6 +187,21 @@ public:
 	void SetEnabled(bool b) { enabled = b; }
 	void PrintProfilingInfo() const;
 
+	/**
+	 * Per-sample recording of all timers (regardless of <enabled>) into
+	 * a ring-buffer file holding the last <numSamples> samples, for later
+	 * inspection with tools/scripts/profile-summary.py; samples are kept
+	 * in memory and written out on each Update.
+	 */
+	bool StartRecording(const std::string& fileName, size_t numSamples);
+	void StopRecording();
+	void FlushRecording();
+
+	bool IsRecording() const { return recording; }
+
+	/// tags subsequent samples; set by the sim at the start of each frame
+	void SetFrameNum(int frameNum) { recordFrameNum = frameNum; }
+
 	void AddTime(
 		unsigned nameHash,
 		const spring_time startTime,
@@ -203,6 +218,9 @@ public:
 		const bool threadTimer
 	);
 
+private:
+	void RecordSample(unsigned nameHash, const spring_time deltaTime);
+
 private:
 	SortType sortingType = SortType::ST_ALPHABETICAL;
 	spring::unordered_map<unsigned, TimeRecord> profiles;
@@ -218,6 +236,10 @@ private:
 
 	// if false, AddTime is a no-op for (almost) all timers
 	std::atomic<bool> enabled;
+	// if true, AddTime also records each individual sample
+	std::atomic<bool> recording = false;
+
+	std::atomic<int> recordFrameNum = -1;
 };
 
 
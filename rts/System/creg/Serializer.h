@@ -8,11 +8,12 @@
 
 #ifdef USING_CREG
 
-#include <map>
 #include <vector>
 #include <deque>
 #include <istream>
 
+#include "System/UnorderedMap.hpp"
+
 namespace creg {
 
 	/**
@@ -23,43 +24,24 @@ namespace creg {
 	class COutputStreamSerializer : public ISerializer
 	{
 	protected:
-		struct ObjectMember {
-			Class::Member* member;
-			int memberId;
-			int size;
-		};
-		struct ObjectMemberGroup {
-			Class* membersClass;
-			std::vector<COutputStreamSerializer::ObjectMember> members;
-			int size;
-		};
 		struct ObjectRef {
-			ObjectRef() {
-				ptr = 0;
-				id=0;
-				classIndex=0;
-				isEmbedded=false;
-				class_=0;
-			}
+			ObjectRef() = default;
 			ObjectRef(void* ptr, int id, bool isEmbedded, Class* class_) {
 				this->ptr = ptr;
-				this->id=id;
-				classIndex=0;
-				this->isEmbedded=isEmbedded;
-				this->class_=class_;
-			}
-			ObjectRef(const ObjectRef&src) :memberGroups(src.memberGroups){
-				ptr=src.ptr;
-				id=src.id;
-				classIndex=src.classIndex;
-				isEmbedded=src.isEmbedded;
-				class_=src.class_;
+				this->id = id;
+				this->isEmbedded = isEmbedded;
+				this->class_ = class_;
 			}
-			void* ptr;
-			int id, classIndex;
-			bool isEmbedded;
-			Class* class_;
-			std::vector<COutputStreamSerializer::ObjectMemberGroup> memberGroups;
+
+			void* ptr = nullptr;
+			int id = 0, classIndex = 0;
+			bool isEmbedded = false;
+			// referenced through a pointer but not yet written
+			bool isPending = false;
+			Class* class_ = nullptr;
+			// next object registered at the same address (e.g. an embedded member at offset 0)
+			ObjectRef* next = nullptr;
+
 			bool isThisObject(void* objPtr, Class* objClass, bool objEmbedded) const
 			{
 				if (ptr != objPtr) return false;
@@ -81,11 +63,13 @@ namespace creg {
 		struct ClassRef;
 
 		std::ostream* stream;
-		std::map<void*,std::vector<ObjectRef*> > ptrToId;
+		// first ObjectRef per address; objects is a deque so these stay valid
+		spring::unsynced_map<void*, ObjectRef*> ptrToId;
 		std::deque<ObjectRef> objects;
 		std::vector<ObjectRef*> pendingObjects; // these objects still have to be saved
-		std::map<Class*, int> classSizes;
-		std::map<Class*, int> classCounts;
+		// only collected when debug-logging is enabled
+		spring::unsynced_map<Class*, int> classSizes;
+		spring::unsynced_map<Class*, int> classCounts;
 
 		// Serialize all class names
 		void WriteObjectInfo();
@@ -93,8 +77,11 @@ namespace creg {
 		void WriteObjectRef(void* inst, Class* cls, bool embedded);
 
 		ObjectRef* FindObjectRef(void* inst, Class* objClass, bool isEmbedded);
+		ObjectRef* AddObjectRef(void* inst, Class* objClass, bool isEmbedded);
+
+		void SerializeObject(Class* c, void* ptr);
 
-		void SerializeObject(Class* c, void* ptr, ObjectRef* objr);
+		bool logClassSizes = false;
 
 	public:
 		COutputStreamSerializer();
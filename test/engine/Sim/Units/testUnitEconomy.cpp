@@ -0,0 +1,189 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "Sim/Units/Systems/UnitEconomyUtils.h"
+
+#include <vector>
+
+#define CATCH_CONFIG_MAIN
+#include "lib/catch.hpp"
+
+using namespace UnitEconomy;
+
+
+// the parts of CTeam the accounting touches
+struct TestTeam {
+	SResourcePack res;
+	SResourcePack resStorage = {1e6f, 1e6f};
+	SResourcePack resPull;
+	SResourcePack resIncome;
+	SResourcePack resExpense;
+
+	bool UseResources(const SResourcePack& amount) {
+		if (!(res >= amount))
+			return false;
+
+		res -= amount;
+		resExpense += amount;
+		return true;
+	}
+
+	void AddResources(const SResourcePack& amount) {
+		res += amount;
+		resIncome += amount;
+	}
+};
+
+struct TestUnit {
+	SResourcePack uncondMake;
+	SResourcePack uncondUse;
+	SResourcePack condMake;
+	SResourcePack condUse;
+
+	SResourcePack resourcesUseI;
+	SResourcePack resourcesMakeI;
+};
+
+
+// CUnit::{Use,Add}{Metal,Energy}
+static bool LegacyUse(TestTeam& team, TestUnit& unit, int resIdx, float amount);
+
+static void LegacyAdd(TestTeam& team, TestUnit& unit, int resIdx, float amount)
+{
+	if (amount < 0.0f) {
+		LegacyUse(team, unit, resIdx, -amount);
+		return;
+	}
+
+	SResourcePack pack;
+	pack[resIdx] = amount;
+
+	unit.resourcesMakeI += pack;
+	team.AddResources(pack);
+}
+
+static bool LegacyUse(TestTeam& team, TestUnit& unit, int resIdx, float amount)
+{
+	if (amount < 0.0f) {
+		LegacyAdd(team, unit, resIdx, -amount);
+		return true;
+	}
+
+	SResourcePack pack;
+	pack[resIdx] = amount;
+
+	team.resPull += pack;
+
+	if (!team.UseResources(pack))
+		return false;
+
+	unit.resourcesUseI += pack;
+	return true;
+}
+
+// the unit-resource part of CUnit::SlowUpdateResources for an activated unit
+static void LegacyUpdate(TestTeam& team, std::vector<TestUnit>& units)
+{
+	for (TestUnit& u: units) {
+		LegacyAdd(team, u, 0, u.uncondMake.metal);
+		LegacyAdd(team, u, 1, u.uncondMake.energy);
+		LegacyUse(team, u, 0, u.uncondUse.metal);
+		LegacyUse(team, u, 1, u.uncondUse.energy);
+
+		if (LegacyUse(team, u, 0, u.condUse.metal))
+			LegacyAdd(team, u, 1, u.condMake.energy);
+		if (LegacyUse(team, u, 1, u.condUse.energy))
+			LegacyAdd(team, u, 0, u.condMake.metal);
+	}
+}
+
+// UnitEconomySystem::{UpdateUnitFlows,Update} in first-come-first-served mode
+static void BatchedUpdate(TestTeam& team, std::vector<TestUnit>& units)
+{
+	std::vector<UnitEconomyFlows> flows(units.size());
+
+	for (size_t i = 0; i < units.size(); i++) {
+		const TestUnit& u = units[i];
+
+		AddMake(flows[i], 0, u.uncondMake.metal, false);
+		AddMake(flows[i], 1, u.uncondMake.energy, false);
+		AddUpkeep(flows[i], 0, u.uncondUse.metal, {}, false);
+		AddUpkeep(flows[i], 1, u.uncondUse.energy, {}, false);
+
+		AddUpkeep(flows[i], 0, u.condUse.metal, {0.0f, u.condMake.energy}, true);
+		AddUpkeep(flows[i], 1, u.condUse.energy, {u.condMake.metal, 0.0f}, true);
+	}
+
+	for (size_t i = 0; i < units.size(); i++) {
+		ApplyMake(&team, units[i].resourcesUseI, units[i].resourcesMakeI, flows[i].make + flows[i].activeMake);
+	}
+
+	for (size_t i = 0; i < units.size(); i++) {
+		for (int j = 0; j < flows[i].numUpkeeps; j++) {
+			const UnitEconomyUpkeep& upkeep = flows[i].upkeeps[j];
+			ApplyUpkeep(&team, units[i].resourcesUseI, units[i].resourcesMakeI, upkeep.use, upkeep.make);
+		}
+	}
+}
+
+
+static void CheckEqual(const SResourcePack& a, const SResourcePack& b)
+{
+	for (int i = 0; i < SResourcePack::MAX_RESOURCES; i++) {
+		CHECK(a[i] == Approx(b[i]));
+	}
+}
+
+static void CompareUpdates(const SResourcePack& startRes, const std::vector<TestUnit>& units)
+{
+	TestTeam legacyTeam;
+	TestTeam batchedTeam;
+	std::vector<TestUnit> legacyUnits = units;
+	std::vector<TestUnit> batchedUnits = units;
+
+	legacyTeam.res = startRes;
+	batchedTeam.res = startRes;
+
+	LegacyUpdate(legacyTeam, legacyUnits);
+	BatchedUpdate(batchedTeam, batchedUnits);
+
+	CheckEqual(legacyTeam.res, batchedTeam.res);
+	CheckEqual(legacyTeam.resPull, batchedTeam.resPull);
+	CheckEqual(legacyTeam.resIncome, batchedTeam.resIncome);
+	CheckEqual(legacyTeam.resExpense, batchedTeam.resExpense);
+
+	for (size_t i = 0; i < units.size(); i++) {
+		CheckEqual(legacyUnits[i].resourcesUseI, batchedUnits[i].resourcesUseI);
+		CheckEqual(legacyUnits[i].resourcesMakeI, batchedUnits[i].resourcesMakeI);
+	}
+}
+
+
+TEST_CASE("UnitEconomyMixedTeam")
+{
+	std::vector<TestUnit> units(4);
+
+	// energy producer
+	units[0].uncondMake = {0.0f, 10.0f};
+	// metal maker, energy -> metal
+	units[1].condUse = {0.0f, 3.0f};
+	units[1].condMake = {1.0f, 0.0f};
+	// consumes metal and drains energy through negative conditional production
+	units[2].condUse = {2.0f, 0.0f};
+	units[2].condMake = {0.0f, -5.0f};
+	// negative production and negative upkeep
+	units[3].uncondMake = {-1.0f, 0.0f};
+	units[3].uncondUse = {0.0f, -2.0f};
+
+	SECTION("enough stored") {
+		CompareUpdates({20.0f, 20.0f}, units);
+	}
+	SECTION("energy starved") {
+		// 4 + 2 energy produced, 3 + 5 demanded; the negative production
+		// must not push the team below zero
+		units[0].uncondMake = {0.0f, 4.0f};
+		CompareUpdates({20.0f, 0.0f}, units);
+	}
+	SECTION("metal starved") {
+		CompareUpdates({0.5f, 20.0f}, units);
+	}
+}
@@ -0,0 +1,70 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "System/RadixSort.h"
+#include "System/Threading/ThreadPool.h"
+#include "System/Platform/Threading.h"
+#include "System/Misc/SpringTime.h"
+#include "System/GlobalRNG.h"
+
+#include <algorithm>
+#include <vector>
+
+#define CATCH_CONFIG_MAIN
+#include "lib/catch.hpp"
+
+
+InitSpringTime ist;
+
+static void SortAndCompare(std::vector<uint64_t> keys)
+{
+	std::vector<uint64_t> temp;
+	std::vector<uint64_t> sorted = keys;
+
+	std::sort(sorted.begin(), sorted.end());
+	spring::RadixSortMT(keys, temp);
+
+	CHECK(keys == sorted);
+}
+
+
+TEST_CASE("RadixSort")
+{
+	Threading::DetectCores();
+	ThreadPool::SetThreadCount(ThreadPool::GetMaxThreads());
+
+	CGlobalUnsyncedRNG rng;
+	rng.Seed(123);
+
+	const auto NextKey = [&]() { return ((uint64_t(rng.NextInt()) << 32) | rng.NextInt()); };
+
+	SECTION("trivial") {
+		SortAndCompare({});
+		SortAndCompare({42});
+		SortAndCompare({3, 1, 2});
+	}
+
+	for (const size_t numKeys: {100, 5000, 100000}) {
+		SECTION("random " + std::to_string(numKeys)) {
+			std::vector<uint64_t> keys(numKeys);
+
+			for (uint64_t& k: keys) {
+				k = NextKey();
+			}
+
+			SortAndCompare(keys);
+		}
+
+		SECTION("skipped passes " + std::to_string(numKeys)) {
+			// only the low and one middle byte vary, all other passes are skipped
+			std::vector<uint64_t> keys(numKeys);
+
+			for (uint64_t& k: keys) {
+				k = 0xAB00000000000000ull | (uint64_t(rng.NextInt(256)) << 24) | rng.NextInt(256);
+			}
+
+			SortAndCompare(keys);
+		}
+	}
+
+	ThreadPool::SetThreadCount(0);
+}
@@ -158,6 +158,42 @@ TEST_CASE("test_nested_parallel")
 	#endif
 }
 
+TEST_CASE("test_uneven_for_mt_chunk")
+{
+	LOG("[%s::test_uneven_for_mt_chunk]", __func__);
+
+	std::vector<int> nums(NUM_RUNS, 0);
+
+	// first few elements are far more expensive than the rest
+	for_mt_chunk(0, NUM_RUNS, [&](const int i) {
+		if (i < 16)
+			spring::this_thread::sleep_for(std::chrono::microseconds(100));
+
+		nums[i] += 1;
+	});
+
+	for (int i = 0; i < NUM_RUNS; i++) {
+		CHECK(nums[i] == 1);
+	}
+}
+
+TEST_CASE("test_stealable_enqueue")
+{
+	LOG("[%s::test_stealable_enqueue]", __func__);
+
+	std::atomic_int cnt = {0};
+	std::vector< std::shared_ptr< std::future<void> > > futures;
+
+	for (int i = 0; i < 64; i++) {
+		futures.emplace_back(ThreadPool::Enqueue([&cnt]() { ++cnt; }));
+	}
+	for (auto& f: futures) {
+		f->get();
+	}
+
+	CHECK(cnt == 64);
+}
+
 TEST_CASE("test_throw_for_mt")
 {
 	//FIXME FAILS ATM
@@ -0,0 +1,95 @@
+#!/bin/sh
+
+# Checks that a game resumed from a crash-recovery snapshot (see SnapshotInterval)
+# stays in sync with the original: plays the start-script until one snapshot has
+# been written, resumes from it and compares the sync-checksums both runs report
+# (see --sim-benchmark) for the frames they have in common.
+#
+# Needs an engine built with SYNCCHECK, and a game without synced Lua gadgets
+# or AIs; forked snapshots are not written while either is present.
+
+set -e # abort on error
+
+if [ $# -ne 2 ]; then
+	echo "Usage: $0 /path/to/spring-headless script.txt"
+	echo "Environment: SPRING_DATADIR (where the game and map are found)"
+	exit 1
+fi
+
+ENGINE="$1"
+SCRIPT="$2"
+
+if [ ! -x "$ENGINE" ]; then
+	echo "Parameter 1 $ENGINE isn't executable!"
+	exit 1
+fi
+
+WORKDIR=$(mktemp -d)
+
+# one snapshot at frame 300, the run ends before the next one is due
+INTERVAL=10
+FULL_FRAMES=540
+RESUMED_FRAMES=300
+
+write_config() {
+	(
+		if [ -n "$SPRING_DATADIR" ]; then
+			echo "SpringData = $SPRING_DATADIR"
+		fi
+		echo "SnapshotInterval = $1"
+		echo "SnapshotCount = 1"
+		echo "SimBenchmarkFrames = $2"
+	) > "$WORKDIR/springsettings.cfg"
+}
+
+fail() {
+	echo "$1, logs are in $WORKDIR"
+	exit 1
+}
+
+
+echo "Playing $SCRIPT for $FULL_FRAMES frames"
+write_config $INTERVAL $FULL_FRAMES
+"$ENGINE" --nocolor --write-dir "$WORKDIR" --config "$WORKDIR/springsettings.cfg" --sim-benchmark "$WORKDIR/full.json" "$SCRIPT" >"$WORKDIR/full.log" 2>&1 || fail "first run failed"
+
+# written by a forked process which can outlive the game
+for i in $(seq 60); do
+	if [ -s "$WORKDIR/Saves/snapshot-0.ssf" ]; then
+		break
+	fi
+	sleep 1
+done
+
+if [ ! -s "$WORKDIR/Saves/snapshot-0.ssf" ]; then
+	fail "no snapshot was written"
+fi
+
+echo "Resuming for $RESUMED_FRAMES frames"
+write_config 0 $RESUMED_FRAMES
+"$ENGINE" --nocolor --write-dir "$WORKDIR" --config "$WORKDIR/springsettings.cfg" --sim-benchmark "$WORKDIR/resumed.json" --resume-snapshot >"$WORKDIR/resumed.log" 2>&1 || fail "resumed run failed"
+
+python3 - "$WORKDIR/full.json" "$WORKDIR/resumed.json" <<'EOD' || fail "checksums differ"
+import json
+import sys
+
+full = json.load(open(sys.argv[1]))["sync"]
+resumed = json.load(open(sys.argv[2]))["sync"]
+
+if not full["enabled"]:
+	print("engine was built without SYNCCHECK")
+	sys.exit(1)
+
+common = sorted(set(full["frameChecksums"]) & set(resumed["frameChecksums"]), key = int)
+diffs = [f for f in common if full["frameChecksums"][f] != resumed["frameChecksums"][f]]
+
+for f in common:
+	print("frame %s: %s %s" % (f, full["frameChecksums"][f], resumed["frameChecksums"][f]))
+
+if not common:
+	print("the runs have no frames in common")
+
+sys.exit(1 if (diffs or not common) else 0)
+EOD
+
+echo "Resumed game is in sync"
+rm -rf "$WORKDIR"
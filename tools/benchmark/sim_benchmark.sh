@@ -0,0 +1,35 @@
+#!/bin/bash
+
+# Replays each given demo (or start-script) with engine-headless at maximum
+# speed and collects the per-run JSON reports written by --sim-benchmark.
+#
+# Compare two result directories with sim_benchmark_compare.py.
+
+if [ $# -lt 3 ]; then
+	echo "Usage: $0 <engine-headless> <result-dir> <demo-or-script> [...]"
+	echo "Environment: RUNS (default 3)"
+	exit 1
+fi
+set -e
+
+ENGINE=$1
+RESULTS=$2
+shift 2
+
+RUNS=${RUNS:-3}
+
+mkdir -p "$RESULTS"
+
+for INPUT in "$@"; do
+	NAME=$(basename "$INPUT")
+	NAME=${NAME%.*}
+
+	for (( i=1; i <= RUNS; i++ )); do
+		echo "Running $NAME ($i/$RUNS)"
+		"$ENGINE" --sim-benchmark "$RESULTS/$NAME-$i.json" "$INPUT" >"$RESULTS/$NAME-$i.log" 2>&1 || true
+
+		if ! [ -s "$RESULTS/$NAME-$i.json" ]; then
+			echo "  no report written, see $RESULTS/$NAME-$i.log"
+		fi
+	done
+done
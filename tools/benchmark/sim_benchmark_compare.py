@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+
+# Compares two directories of sim benchmark reports (see sim_benchmark.sh).
+# Runs of the same input are matched by name and their best (minimum) times
+# are compared; exits non-zero on a regression above the threshold or if the
+# sync-checksums of a replay differ between the two sets.
+
+import argparse
+import glob
+import json
+import os
+import re
+import sys
+
+
+def load_reports(path):
+	reports = {}
+
+	for name in sorted(glob.glob(os.path.join(path, "*.json"))):
+		key = re.sub(r"-\d+$", "", os.path.splitext(os.path.basename(name))[0])
+
+		with open(name) as f:
+			reports.setdefault(key, []).append(json.load(f))
+
+	return reports
+
+
+def best_frame_time(runs):
+	return min(r["frames"]["meanMs"] for r in runs)
+
+
+def best_timer_times(runs):
+	timers = {}
+
+	for r in runs:
+		for name, t in r["timers"].items():
+			timers[name] = min(timers.get(name, float("inf")), t["perFrameMs"])
+
+	return timers
+
+
+def main():
+	parser = argparse.ArgumentParser(description = "Compare two sets of sim benchmark reports")
+	parser.add_argument("base", help = "directory with baseline reports")
+	parser.add_argument("test", help = "directory with reports to check")
+	parser.add_argument("--threshold", type = float, default = 5.0, help = "allowed slowdown in percent")
+	parser.add_argument("--prefix", default = "Sim", help = "only compare timers starting with this prefix")
+	args = parser.parse_args()
+
+	base = load_reports(args.base)
+	test = load_reports(args.test)
+	fail = False
+
+	for key in sorted(set(base) & set(test)):
+		baseMs = best_frame_time(base[key])
+		testMs = best_frame_time(test[key])
+		diff = (testMs - baseMs) * 100.0 / max(baseMs, 1e-6)
+
+		print("%s: mean frame %.4fms -> %.4fms (%+.1f%%)" % (key, baseMs, testMs, diff))
+		fail |= (diff > args.threshold)
+
+		baseSums = set(r["sync"]["checksum"] for r in base[key])
+		testSums = set(r["sync"]["checksum"] for r in test[key])
+
+		if baseSums != testSums:
+			print("\tsync checksum changed: %s -> %s" % (",".join(sorted(baseSums)), ",".join(sorted(testSums))))
+			fail = True
+
+		for r in test[key]:
+			if r["sync"]["demoDesyncs"] > 0:
+				print("\tdesynced from demo at frame %d" % r["sync"]["firstDesyncFrame"])
+				fail = True
+				break
+
+		baseTimers = best_timer_times(base[key])
+		testTimers = best_timer_times(test[key])
+
+		for name in sorted(set(baseTimers) & set(testTimers)):
+			if not name.startswith(args.prefix):
+				continue
+
+			baseT = baseTimers[name]
+			testT = testTimers[name]
+
+			if baseT <= 0.0:
+				continue
+
+			print("\t%-40s %.4fms -> %.4fms (%+.1f%%)" % (name, baseT, testT, (testT - baseT) * 100.0 / baseT))
+
+	return 1 if fail else 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())
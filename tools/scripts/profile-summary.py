@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+
+## purpose: summarizes a profiler ring-buffer file written via ProfileRecordFile
+##          or /ProfileRecord; prints per-timer duration percentiles and the
+##          sim-frames that took longest together with their costliest timers
+
+import argparse
+import struct
+import sys
+
+HEADER_FORMAT = "<IIIIQ"
+SAMPLE_FORMAT = "<iIIHH"
+RECORD_MAGIC = 0x46525053
+RECORD_VERSION = 1
+
+
+def ReadRecording(fileName):
+	with open(fileName, "rb") as f:
+		data = f.read()
+
+	headerSize = struct.calcsize(HEADER_FORMAT)
+	sampleSize = struct.calcsize(SAMPLE_FORMAT)
+
+	magic, version, numSlots, numNames, numWritten = struct.unpack_from(HEADER_FORMAT, data, 0)
+
+	if magic != RECORD_MAGIC or version != RECORD_VERSION:
+		raise ValueError("\"%s\" is not a version %d profile recording" % (fileName, RECORD_VERSION))
+
+	## oldest sample first
+	numSamples = min(numWritten, numSlots)
+	firstSlot = (numWritten - numSamples) % numSlots
+	samples = []
+
+	for i in range(numSamples):
+		offset = headerSize + ((firstSlot + i) % numSlots) * sampleSize
+		samples.append(struct.unpack_from(SAMPLE_FORMAT, data, offset)[0: 4])
+
+	names = {}
+	offset = headerSize + numSlots * sampleSize
+
+	for i in range(numNames):
+		nameHash, nameLen = struct.unpack_from("<II", data, offset)
+		names[nameHash] = data[offset + 8: offset + 8 + nameLen].decode("utf-8", "replace")
+		offset += 8 + nameLen
+
+	return samples, names
+
+
+def Percentile(sortedValues, p):
+	return sortedValues[min(int(len(sortedValues) * p), len(sortedValues) - 1)]
+
+
+def main():
+	parser = argparse.ArgumentParser(description = "Summarize a profiler ring-buffer recording")
+	parser.add_argument("file")
+	parser.add_argument("--frame-timer", default = "Sim", help = "timer whose per-frame total ranks the spikes")
+	parser.add_argument("--spikes", type = int, default = 10, help = "number of slowest frames to list")
+	parser.add_argument("--prefix", default = "", help = "only list timers starting with this prefix")
+	args = parser.parse_args()
+
+	samples, names = ReadRecording(args.file)
+
+	if not samples:
+		print("no samples recorded")
+		return 0
+
+	## durations are in microseconds
+	timerSamples = {}
+	frameTimers = {}
+
+	for frameNum, nameHash, duration, threadNum in samples:
+		name = names.get(nameHash, "0x%08x" % nameHash)
+
+		timerSamples.setdefault(name, []).append(duration)
+		frameTimers.setdefault(frameNum, {}).setdefault(name, 0)
+		frameTimers[frameNum][name] += duration
+
+	print("%d samples, frames %d to %d\n" % (len(samples), samples[0][0], samples[-1][0]))
+	print("%-40s %8s %10s %10s %10s %10s %10s" % ("timer", "count", "mean(ms)", "p50(ms)", "p95(ms)", "p99(ms)", "max(ms)"))
+
+	for name in sorted(timerSamples):
+		if not name.startswith(args.prefix):
+			continue
+
+		values = sorted(timerSamples[name])
+		print("%-40s %8d %10.3f %10.3f %10.3f %10.3f %10.3f" % (
+			name,
+			len(values),
+			sum(values) * 0.001 / len(values),
+			Percentile(values, 0.50) * 0.001,
+			Percentile(values, 0.95) * 0.001,
+			Percentile(values, 0.99) * 0.001,
+			values[-1] * 0.001,
+		))
+
+	spikes = sorted(frameTimers.items(), key = lambda item: item[1].get(args.frame_timer, 0), reverse = True)[0: args.spikes]
+
+	print("\nslowest frames by \"%s\":" % args.frame_timer)
+
+	for frameNum, timers in spikes:
+		print("frame %d: %.3fms" % (frameNum, timers.get(args.frame_timer, 0) * 0.001))
+
+		costliest = [item for item in timers.items() if item[0] != args.frame_timer]
+
+		for name, duration in sorted(costliest, key = lambda item: item[1], reverse = True)[0: 5]:
+			print("\t%-40s %.3fms" % (name, duration * 0.001))
+
+	return 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())
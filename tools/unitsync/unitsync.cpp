@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <vector>
 #include <set>
@@ -33,6 +34,7 @@
 #include "System/Log/Level.h"
 #include "System/Log/DefaultFilter.h"
 #include "System/Misc/SpringTime.h"
+#include "System/Platform/byteorder.h"
 #include "System/Platform/Misc.h" //!!
 #include "System/Threading/ThreadPool.h"
 #include "System/Exceptions.h"
@@ -41,6 +43,7 @@
 #include "System/Option.h"
 #include "System/SafeCStrings.h"
 #include "System/SafeUtil.h"
+#include "System/SpringMath.h"
 #include "System/StringUtil.h"
 #include "System/ExportDefines.h"
 
@@ -903,21 +906,16 @@ static unsigned short* GetMinimapSM3(std::string mapFileName, int mipLevel)
 	*/
 }
 
-static unsigned short* GetMinimapSMF(std::string mapFileName, int mipLevel)
+// decodes a DXT1-compressed minimap mip into <colors> (mipsize*mipsize RGB565 texels)
+static void DecodeMinimapDXT1(const uint8_t* buffer, size_t bufferSize, int mipsize, unsigned short* colors)
 {
-	CSMFMapFile in(mapFileName);
-	std::vector<uint8_t> buffer;
-	const int mipsize = in.ReadMinimap(buffer, mipLevel);
-
-	// Do stuff
-	unsigned short* colors = (unsigned short*)((void*)imgbuf);
-	unsigned char* temp = &buffer[0];
+	const unsigned char* temp = buffer;
 
-	const int numblocks = buffer.size() / 8;
+	const int numblocks = bufferSize / 8;
 	for (int i = 0; i < numblocks; i++) {
-		unsigned short color0 = (*(unsigned short*)&temp[0]);
-		unsigned short color1 = (*(unsigned short*)&temp[2]);
-		unsigned int bits = (*(unsigned int*)&temp[4]);
+		unsigned short color0 = (*(const unsigned short*)&temp[0]);
+		unsigned short color1 = (*(const unsigned short*)&temp[2]);
+		unsigned int bits = (*(const unsigned int*)&temp[4]);
 
 		for ( int a = 0; a < 4; a++ ) {
 			for ( int b = 0; b < 4; b++ ) {
@@ -959,7 +957,16 @@ static unsigned short* GetMinimapSMF(std::string mapFileName, int mipLevel)
 		temp += 8;
 	}
 
-	return colors;
+}
+
+static unsigned short* GetMinimapSMF(std::string mapFileName, int mipLevel)
+{
+	CSMFMapFile in(mapFileName);
+	std::vector<uint8_t> buffer;
+	const int mipsize = in.ReadMinimap(buffer, mipLevel);
+
+	DecodeMinimapDXT1(buffer.data(), buffer.size(), mipsize, imgbuf);
+	return imgbuf;
 }
 
 EXPORT(unsigned short*) GetMinimap(const char* mapName, int mipLevel)
@@ -989,6 +996,154 @@ EXPORT(unsigned short*) GetMinimap(const char* mapName, int mipLevel)
 }
 
 
+// per-map state for the batch queries; resolved serially (the scanner is
+// shared), then read and decoded in parallel through private archive handles
+struct MapBatchItem {
+	std::string mapFile;
+	std::string archivePath;
+
+	SMFHeader header = {};
+	std::vector<uint8_t> smfData;
+};
+
+static bool ResolveMapBatchItem(const char* mapName, MapBatchItem& item)
+{
+	if (mapName == nullptr || mapName[0] == 0)
+		return false;
+
+	item.mapFile = archiveScanner->MapNameToMapFile(mapName);
+
+	if (item.mapFile == mapName || FileSystem::GetExtension(item.mapFile) != "smf")
+		return false;
+
+	const std::string& archiveName = archiveScanner->ArchiveFromName(mapName);
+
+	item.archivePath = archiveScanner->GetArchivePath(archiveName) + archiveName;
+	return true;
+}
+
+// reads the .smf of <item> from its own archive instance and parses the header;
+// does not touch the global VFS and can therefore run on any thread
+static bool LoadMapBatchItem(MapBatchItem& item)
+{
+	std::unique_ptr<IArchive> archive(archiveLoader.OpenArchive(item.archivePath));
+
+	if (archive == nullptr || !archive->IsOpen())
+		return false;
+	if (!archive->GetFile(item.mapFile, item.smfData))
+		return false;
+	if (item.smfData.size() < (sizeof(item.header.magic) + 17 * sizeof(int)))
+		return false;
+
+	int32_t fields[17];
+
+	memcpy(item.header.magic, item.smfData.data(), sizeof(item.header.magic));
+	memcpy(fields, item.smfData.data() + sizeof(item.header.magic), sizeof(fields));
+
+	// only what the batch queries need; see CSMFMapFile::ReadMapHeader for the full layout
+	item.header.magic[sizeof(item.header.magic) - 1] = 0;
+	item.header.version    = swabDWord(fields[ 0]);
+	item.header.mapx       = swabDWord(fields[ 2]);
+	item.header.mapy       = swabDWord(fields[ 3]);
+	item.header.minimapPtr = swabDWord(fields[12]);
+
+	return (item.header.version == 1 && std::strcmp(item.header.magic, "spring map file") == 0);
+}
+
+// runs <func> over all items on the pool, which unitsync keeps at one thread outside of Init
+template<typename F>
+static void ForEachMapBatchItem(std::vector<MapBatchItem>& items, F&& func)
+{
+	ThreadPool::SetThreadCount(ThreadPool::GetMaxThreads());
+	for_mt(0, items.size(), [&](const int i) { func(i, items[i]); });
+	ThreadPool::SetThreadCount(0);
+}
+
+
+EXPORT(int) GetMinimapBatch(const char** mapNames, int numMaps, int mipLevel, unsigned short** buffers)
+{
+	try {
+		CheckInit();
+		CheckNull(mapNames);
+		CheckNull(buffers);
+
+		if (mipLevel < 0 || mipLevel > 8)
+			throw std::out_of_range("Miplevel must be between 0 and 8 (inclusive) in GetMinimapBatch.");
+
+		std::vector<MapBatchItem> items(std::max(numMaps, 0));
+		std::vector<uint8_t> loaded(items.size(), 0);
+
+		for (size_t i = 0; i < items.size(); i++) {
+			loaded[i] = (buffers[i] != nullptr && ResolveMapBatchItem(mapNames[i], items[i]));
+		}
+
+		ForEachMapBatchItem(items, [&](const int i, MapBatchItem& item) {
+			if (!loaded[i] || !(loaded[i] = LoadMapBatchItem(item)))
+				return;
+
+			int offset = 0;
+			int mipSize = 1024;
+
+			for (int m = 0; m < mipLevel; m++) {
+				offset += (Square((mipSize + 3) / 4) * 8);
+				mipSize >>= 1;
+			}
+
+			const size_t mipStart = item.header.minimapPtr + offset;
+			const size_t mipBytes = Square((mipSize + 3) / 4) * 8;
+
+			if (item.header.minimapPtr <= 0 || (mipStart + mipBytes) > item.smfData.size()) {
+				loaded[i] = 0;
+				return;
+			}
+
+			DecodeMinimapDXT1(item.smfData.data() + mipStart, mipBytes, mipSize, buffers[i]);
+
+			// release the map data early, a batch can cover many large maps
+			std::vector<uint8_t>().swap(item.smfData);
+		});
+
+		return std::count(loaded.begin(), loaded.end(), 1);
+	}
+	UNITSYNC_CATCH_BLOCKS;
+	return -1;
+}
+
+
+EXPORT(int) GetMapMetadataBatch(const char** mapNames, int numMaps, int* widths, int* heights, unsigned int* checksums)
+{
+	try {
+		CheckInit();
+		CheckNull(mapNames);
+
+		std::vector<MapBatchItem> items(std::max(numMaps, 0));
+		std::vector<uint8_t> loaded(items.size(), 0);
+
+		for (size_t i = 0; i < items.size(); i++) {
+			loaded[i] = ResolveMapBatchItem(mapNames[i], items[i]);
+
+			// checksums are cached by the scanner (and computed under its lock)
+			if (checksums != nullptr)
+				checksums[i] = loaded[i]? archiveScanner->GetArchiveCompleteChecksum(mapNames[i]): 0;
+		}
+
+		if (widths != nullptr || heights != nullptr) {
+			ForEachMapBatchItem(items, [&](const int i, MapBatchItem& item) {
+				loaded[i] = loaded[i] && LoadMapBatchItem(item);
+				std::vector<uint8_t>().swap(item.smfData);
+
+				if (widths  != nullptr) widths [i] = loaded[i]? (item.header.mapx * SQUARE_SIZE): 0;
+				if (heights != nullptr) heights[i] = loaded[i]? (item.header.mapy * SQUARE_SIZE): 0;
+			});
+		}
+
+		return std::count(loaded.begin(), loaded.end(), 1);
+	}
+	UNITSYNC_CATCH_BLOCKS;
+	return -1;
+}
+
+
 EXPORT(int) GetInfoMapSize(const char* mapName, const char* name, int* width, int* height)
 {
 	try {
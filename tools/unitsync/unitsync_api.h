@@ -329,6 +329,40 @@ EXPORT(unsigned int) GetMapChecksumFromName(const char* mapName);
  * This would return a 16 bit packed RGB-565 256x256 (= 1024/2^2) bitmap.
  */
 EXPORT(unsigned short*) GetMinimap(const char* fileName, int mipLevel);
+/**
+ * @brief Retrieves minimap images for several maps at once.
+ * @param mapNames  Array of numMaps map names, e.g. "SmallDivide".
+ * @param numMaps   Number of entries in mapNames and buffers.
+ * @param mipLevel  Which mip-level to extract, see GetMinimap.
+ * @param buffers   Array of numMaps caller-owned buffers, each large enough to
+ *   hold (1024 >> mipLevel)^2 RGB-565 pixels; entries may be NULL to skip a map.
+ * @return negative integer (< 0) on error;
+ *   the number of minimaps written (>= 0) on success
+ *
+ * The maps are read and decoded in parallel, and unlike GetMinimap no static
+ * memory is involved. Buffers of maps that could not be read (unknown name,
+ * not an SMF map) are left untouched.
+ * @see GetMinimap
+ */
+EXPORT(int         ) GetMinimapBatch(const char** mapNames, int numMaps, int mipLevel, unsigned short** buffers);
+/**
+ * @brief Retrieves size and checksum of several maps at once.
+ * @param mapNames   Array of numMaps map names, e.g. "SmallDivide".
+ * @param numMaps    Number of entries in mapNames.
+ * @param widths     Array of numMaps ints receiving the map widths, 0 on error;
+ *   may be NULL.
+ * @param heights    Array of numMaps ints receiving the map heights, 0 on error;
+ *   may be NULL.
+ * @param checksums  Array of numMaps values receiving the checksums as returned
+ *   by GetMapChecksumFromName, 0 on error; may be NULL.
+ * @return negative integer (< 0) on error;
+ *   the number of maps found (>= 0) on success
+ *
+ * Sizes are read in parallel straight from the SMF headers, which avoids the
+ * per-map VFS setup and mapinfo parsing of GetMapInfoCount / GetMapInfo*.
+ * @see GetMapChecksumFromName
+ */
+EXPORT(int         ) GetMapMetadataBatch(const char** mapNames, int numMaps, int* widths, int* heights, unsigned int* checksums);
 /**
  * @brief Retrieves dimensions of infomap for a map.
  * @param mapName  The name of the map, e.g. "SmallDivide".